@@ -0,0 +1,124 @@
+/* compile throughput of long expressions, lexing included, against the lexer alone.  build from the
+ * repository root with
+ *
+ *   cc -O2 -I. -o compilebench bench/compilebench.c $(ls *.c | grep -v main.c) -lm
+ *
+ * it only needs kl_lexer_init and kl_compile, and also builds against older trees whose kl_compile takes
+ * no scope, so that compilers can be compared on the same workloads.  throughput is in millions of tokens
+ * a second, parse is what compiling costs beyond lexing, in nanoseconds per token.  each figure is the best
+ * of several runs */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "lexer.h"
+#include "compiler.h"
+#include "langdefs.h"
+
+#define KL_BENCH_COMPILES 0x4000
+#define KL_BENCH_RUNS     9
+#define KL_BENCH_DEPTH    200
+#define KL_BENCH_CHAIN    1000
+
+#ifdef KL_SCOPE_INITIALIZER
+static kl_scope_t scope = KL_SCOPE_INITIALIZER;
+#define KL_BENCH_COMPILE(lexer) (scope.n = 0, kl_compile((lexer), &scope))
+#else
+#define KL_BENCH_COMPILE(lexer) kl_compile(lexer)
+#endif
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static const char *src, *script;
+static int source(void) {
+  return *src ? *src++ : -1;
+}
+
+/* tokens of one statement, its end included */
+static int count(void) {
+  kl_lexer_t lexer;
+  kl_token_t token;
+  int        n = 0;
+  src = script;
+  kl_lexer_init(&lexer, source, NULL);
+  do {
+    kl_lexer_next(&lexer, &token);
+    n++;
+  } while (token.header.type != KL_END && token.header.type != KL_NONE);
+  return n;
+}
+
+static double lex(void) {
+  double best = 0;
+  for (int r=0; r < KL_BENCH_RUNS; r++) {
+    double t0 = now();
+    for (int i=0; i < KL_BENCH_COMPILES; i++) {
+      kl_lexer_t lexer;
+      kl_token_t token;
+      src = script;
+      kl_lexer_init(&lexer, source, NULL);
+      do kl_lexer_next(&lexer, &token); while (token.header.type != KL_END && token.header.type != KL_NONE);
+    }
+    double t = now() - t0;
+    if (r == 0 || t < best) best = t;
+  }
+  return best;
+}
+
+static double compile(void) {
+  double best = 0;
+  for (int r=0; r < KL_BENCH_RUNS; r++) {
+    double t0 = now();
+    for (int i=0; i < KL_BENCH_COMPILES; i++) {
+      kl_lexer_t lexer;
+      src = script;
+      kl_lexer_init(&lexer, source, NULL);
+      kl_code_t *code = KL_BENCH_COMPILE(&lexer);
+      if (code == NULL) {
+        printf("does not compile\n");
+        exit(1);
+      }
+      free(code);
+    }
+    double t = now() - t0;
+    if (r == 0 || t < best) best = t;
+  }
+  return best;
+}
+
+static void run(const char *name) {
+  int    n = count();
+  double l = lex(), c = compile();
+  double tokens = (double)n * KL_BENCH_COMPILES;
+  printf("%-8s %6d %10.1f %10.1f %10.2f\n", name, n, tokens / l * 1e3, tokens / c * 1e3, (c - l) / tokens);
+}
+
+int main(void) {
+  char *buf = malloc(8 * (KL_BENCH_DEPTH + KL_BENCH_CHAIN) + 16), *p;
+
+  /* (((1 + 1) + 1) + 1) ... nested to the right depth */
+  p = buf;
+  for (int i=0; i < KL_BENCH_DEPTH; i++) *p++ = '(';
+  *p++ = '1';
+  for (int i=0; i < KL_BENCH_DEPTH; i++) p += sprintf(p, " + 1)");
+  strcpy(p, ";");
+  script = buf;
+  printf("%-8s %6s %10s %10s %10s\n", "", "tokens", "lex", "compile", "parse");
+  run("nested");
+
+  /* 1 + 2 * 3 - 4 ... with every precedence level of a sum and a product */
+  p = buf;
+  *p++ = '1';
+  for (int i=0; i < KL_BENCH_CHAIN; i++) p += sprintf(p, " %c %d", "+*-"[i % 3], 2 + i % 7);
+  strcpy(p, ";");
+  run("flat");
+
+  free(buf);
+  return 0;
+}
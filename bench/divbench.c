@@ -0,0 +1,120 @@
+/* division by a constant, kl_num_divc, kl_num_fdivc and kl_num_modc as the vm runs DIVC, FDIVC and MODC,
+ * against kl_num_div, kl_num_fdiv and % on the divisor itself.  build from the repository root with
+ *
+ *   for f in Q16_16 Q8_24; do
+ *     cc -O2 -I. -DKL_NUM_FORMAT=KL_NUM_$f -o divbench bench/divbench.c number.c -lm
+ *     ./divbench
+ *   done
+ *
+ * every divisor from a fixed list is tried on edge dividends and random ones, or with -x on all 2^32 of
+ * them, which takes a while.  then every divisor up to 2^17 in magnitude on edge dividends, then random
+ * pairs.  the run fails if magic and hardware division ever disagree.  the formats without magic division
+ * have nothing to check.  time is in nanoseconds per division */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "number.h"
+
+#define KL_BENCH_RANDOM 0x00400000 /* dividends per listed divisor */
+#define KL_BENCH_PAIRS  0x04000000
+#define KL_BENCH_VALUES 0x10000
+#define KL_BENCH_ROUNDS 0x100
+
+#if KL_NUM_MAGIC
+static uint64_t state = 88172645463325252u;
+static uint64_t rnd(void) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/* raw divisors, integers and their fixed point values, awkward fractions and the ends of the range */
+static const kl_number_t divisors[] = {
+  3, 60, 1000, 7, -5, 10, 641, -2,
+  3 * KL_NUM_ONE, 60 * KL_NUM_ONE, -7 * KL_NUM_ONE, KL_NUM_FDIV / 10,
+  INT32_MIN, INT32_MAX, -INT32_MAX, 1 << 30,
+};
+
+static const kl_number_t edges[] = {
+  0, 1, -1, 2, -2, KL_NUM_ONE, -KL_NUM_ONE, KL_NUM_FMASK, -KL_NUM_FMASK,
+  INT32_MAX, INT32_MIN, INT32_MAX - 1, INT32_MIN + 1, INT32_MAX / 2, INT32_MIN / 2,
+  0x7FFF0000, -0x7FFF0000, 0x00FFFFFF, -0x01000000,
+};
+
+static long mismatches = 0;
+
+static void check(kl_number_t a, kl_number_t d) {
+  kl_num_magic_t m;
+  if (kl_num_magic(d, &m) < 0) return;
+
+  kl_number_t div  = (kl_number_t)kl_num_div(a, d);
+  kl_number_t fdiv = (kl_number_t)kl_num_fdiv(a, d);
+  kl_number_t mod  = (kl_number_t)kl_num_mod(a, d);
+  if (kl_num_divc(a, &m) != div || kl_num_fdivc(a, &m) != fdiv || kl_num_modc(a, &m) != mod) {
+    if (mismatches++ < 8) printf("differ: %d by %d\n", (int)a, (int)d);
+  }
+}
+
+static void dividends(kl_number_t d, int exhaustive) {
+  for (size_t i=0; i < sizeof(edges) / sizeof(edges[0]); i++) check(edges[i], d);
+  if (exhaustive) {
+    uint32_t a = 0;
+    do check((kl_number_t)a, d); while (++a != 0);
+    return;
+  }
+  for (int i=0; i < KL_BENCH_RANDOM; i++) check((kl_number_t)rnd(), d);
+}
+
+static kl_number_t values[KL_BENCH_VALUES];
+
+int main(int argc, char **argv) {
+  int exhaustive = argc > 1 && strcmp(argv[1], "-x") == 0;
+
+  for (size_t k=0; k < sizeof(divisors) / sizeof(divisors[0]); k++) dividends(divisors[k], exhaustive);
+  for (kl_number_t d=-(1 << 17); d <= 1 << 17; d++) {
+    for (size_t i=0; i < sizeof(edges) / sizeof(edges[0]); i++) check(edges[i], d);
+  }
+  for (int i=0; i < KL_BENCH_PAIRS; i++) {
+    uint64_t r = rnd();
+    check((kl_number_t)r, (kl_number_t)(r >> 32) >> (rnd() % 31)); /* divisors of every magnitude */
+  }
+
+  /* speed on one awkward divisor */
+  volatile kl_number_t opaque = 60 * KL_NUM_ONE; /* or the compiler divides by the constant itself */
+  kl_num_magic_t       m;
+  kl_number_t          d = opaque, sum[2] = { 0, 0 };
+  double               t[2];
+  kl_num_magic(d, &m);
+  for (int i=0; i < KL_BENCH_VALUES; i++) values[i] = (kl_number_t)rnd();
+  for (int k=0; k < 2; k++) {
+    double t0 = now();
+    for (int r=0; r < KL_BENCH_ROUNDS; r++) {
+      for (int i=0; i < KL_BENCH_VALUES; i++) {
+        sum[k] += k == 0 ? (kl_number_t)kl_num_div(values[i], d) : kl_num_divc(values[i], &m);
+      }
+    }
+    t[k] = (now() - t0) / ((double)KL_BENCH_ROUNDS * KL_BENCH_VALUES);
+  }
+
+  printf("%s, %s\n", KL_NUM_NAME, exhaustive ? "all dividends" : "edge and random dividends");
+  printf("kl_num_div        %8.2f ns\n", t[0]);
+  printf("kl_num_divc       %8.2f ns\n", t[1]);
+  if (mismatches) printf("%ld divisions differ\n", mismatches);
+  return mismatches != 0 || sum[0] != sum[1];
+}
+#else
+int main(void) {
+  printf("%s has no magic division, nothing to check\n", KL_NUM_NAME);
+  return 0;
+}
+#endif
@@ -0,0 +1,119 @@
+/* throughput of the interpreter in each number format, over a few workloads that stress different parts of
+ * it.  number.h picks the format at build time, so build and run once per format from the repository root:
+ *
+ *   for f in Q16_16 Q8_24 Q32_32 DOUBLE; do
+ *     cc -O2 -I. -DKL_NUM_FORMAT=KL_NUM_$f -o formatbench bench/formatbench.c $(ls *.c | grep -v main.c) -lm
+ *     ./formatbench
+ *   done
+ *
+ * each workload is compiled once and executed repeatedly.  time is in nanoseconds per statement, the
+ * value column is the result of the last statement, so that formats that overflow or lose precision on a
+ * workload show it */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "number.h"
+#include "lexer.h"
+#include "compiler.h"
+#include "vm.h"
+
+#define KL_BENCH_ROUNDS 0x40000
+#define KL_BENCH_MAXCODE 0x10
+
+typedef struct kl_bench {
+  const char *name;
+  const char *setup;
+  const char *body;
+} kl_bench_t;
+
+static const kl_bench_t benches[] = {
+  { "arith",  "x = 1.5; y = 2.25; z = 0.125;",
+              "z = x * y + z; z = z - x * 0.5; z = z / 1.25; z = z - y;" },
+  { "divide", "x = 3; y = 7;",
+              "q = x / y + x / 7; q = q % 3;" },
+  { "logic",  "x = 5; y = 9;",
+              "b = x < y ? x : y; b = b & 7 | 1; b = (x == 5) && (y != 2);" },
+  { "math",   "t = 0.75;",
+              "s = sin t + cos t; r = sqrt(t * 40) + exp2 t; a = atan2(s, r);" },
+  { "sincos", "t = 0.75;",
+              "s, c = sincos t; u = s * c;" },
+  { "array",  "a = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16]; b = a * 0.5;",
+              "c = a * b + a; d = c - b * 2; e = a dot d;" },
+};
+
+static kl_vm_t    vm    = KL_VM_INITIALIZER;
+static kl_scope_t scope = KL_SCOPE_INITIALIZER;
+
+static const char *src;
+static int source(void) {
+  return *src ? *src++ : -1;
+}
+
+/* compiles every statement of s, returns how many */
+static int compile(const char *s, kl_code_t **code) {
+  kl_lexer_t lexer;
+  int        n = 0;
+  src = s;
+  kl_lexer_init(&lexer, source, NULL);
+  while (n < KL_BENCH_MAXCODE) {
+    kl_code_t *c = kl_compile(&lexer, &scope);
+    if (c == NULL) exit(1);
+    if (c->n == 0) {
+      free(c);
+      break;
+    }
+    code[n++] = c;
+  }
+  return n;
+}
+
+static void run(kl_code_t **code, int n) {
+  for (int i=0; i < n; i++) {
+    kl_vm_exec(&vm, code[i]);
+    vm.sp--;
+  }
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+int main(void) {
+  kl_code_t *code[KL_BENCH_MAXCODE];
+
+#if KL_NUM_FIXED
+  printf("%s: last place %g, range +-%g\n", KL_NUM_NAME, 1.0 / KL_NUM_FDIV, kl_numtodouble(KL_NUM_MAX));
+#else
+  printf("%s: 53-bit significand\n", KL_NUM_NAME);
+#endif
+  printf("%-8s %10s %14s\n", "", "ns/stmt", "value");
+  for (size_t k=0; k < sizeof(benches) / sizeof(benches[0]); k++) {
+    const kl_bench_t *b = &benches[k];
+
+    int n = compile(b->setup, code);
+    run(code, n);
+    while (n > 0) free(code[--n]);
+
+    n = compile(b->body, code);
+    int    statements = n;
+    double t0 = now();
+    for (int r=0; r < KL_BENCH_ROUNDS; r++) run(code, n);
+    double t1 = now();
+
+    /* the last result, once more and left on the stack */
+    for (int i=0; i < n; i++) {
+      kl_vm_exec(&vm, code[i]);
+      if (i < n - 1) vm.sp--;
+    }
+    kl_valref_t v = vm.stack[vm.sp--];
+    while (n > 0) free(code[--n]);
+
+    printf("%-8s %10.2f %14.6f\n", b->name, (t1 - t0) / ((double)KL_BENCH_ROUNDS * statements),
+           kl_numtodouble(v.val.num));
+  }
+  return 0;
+}
@@ -0,0 +1,96 @@
+/* pauses of the incremental collector.  build from the repository root with
+ *
+ *   cc -O2 -I. -o gcbench bench/gcbench.c $(ls *.c | grep -v main.c) -lm
+ *
+ * a long chain of instances hangs off a holder in the roots.  once marking has begun, and before the
+ * holder is traced, the chain moves into a root of its own.  roots have no barrier, so the chain is found
+ * only when the roots are rescanned at the end of marking, and all of it is still to be traced.  a step
+ * may overrun its budget by the unit of work it started last, one object traced or one block swept, and
+ * by a pass over the roots.  the run fails if any step does more, if a live object is swept or if garbage
+ * is kept.  time is the longest single step, in microseconds */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "heap.h"
+
+#define KL_BENCH_CHAIN   0x00040000 /* instances */
+#define KL_BENCH_GARBAGE 0x00010000
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static kl_valref_t immediate = { .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+
+/* an instance with a single field */
+static kl_obj_inst_t* cons(kl_heap_t *heap, kl_valref_t next, kl_valref_t *ref) {
+  size_t         size = sizeof(kl_obj_inst_t) + sizeof(kl_valref_t);
+  kl_obj_inst_t *inst = (kl_obj_inst_t*)kl_heap_alloc(heap, KL_OBJ_INST, size, ref);
+  inst->shape    = 0;
+  inst->n        = 1;
+  inst->cap      = 1;
+  inst->field[0] = next;
+  return inst;
+}
+
+static kl_valref_t chain[KL_BENCH_CHAIN], garbage[KL_BENCH_GARBAGE];
+
+int main(void) {
+  kl_heap_t heap = KL_HEAP_INITIALIZER;
+
+  kl_valref_t next = immediate;
+  for (int i=KL_BENCH_CHAIN - 1; i >= 0; i--) {
+    cons(&heap, next, &chain[i]);
+    next = chain[i];
+  }
+  next = immediate;
+  for (int i=0; i < KL_BENCH_GARBAGE; i++) {
+    cons(&heap, next, &garbage[i]);
+    next = garbage[i];
+  }
+
+  kl_valref_t     root[2] = { immediate, immediate };
+  kl_heap_roots_t roots   = { root, 2 };
+  kl_obj_inst_t  *holder  = cons(&heap, chain[0], &root[0]);
+
+  /* the first step starts the cycle, the holder is shaded but not traced yet */
+  heap.threshold = 0;
+  if (kl_heap_step(&heap, &roots, 1) != KL_GC_MARK) {
+    printf("no cycle started\n");
+    return 1;
+  }
+  root[1]          = chain[0];
+  holder->field[0] = immediate;
+  kl_heap_shade(&heap, immediate); /* the store's barrier, as the vm does */
+
+  size_t limit = heap.stepsize + KL_HEAP_BLOCKSIZE + sizeof(root);
+  size_t most  = 0;
+  double pause = 0;
+  int    steps = 0, over = 0;
+  for (int phase=KL_GC_MARK; phase != KL_GC_IDLE; steps++) {
+    double t0 = now();
+    phase = kl_heap_step(&heap, &roots, 1);
+    double t  = now() - t0;
+    if (t > pause) pause = t;
+    if (heap.work > most) most = heap.work;
+    if (heap.work > limit) over++;
+  }
+
+  int lost = 0, kept = 0;
+  for (int i=0; i < KL_BENCH_CHAIN; i++) lost += kl_heap_deref(&heap, chain[i]) == NULL;
+  for (int i=0; i < KL_BENCH_GARBAGE; i++) kept += kl_heap_deref(&heap, garbage[i]) != NULL;
+
+  printf("%d live instances, %d garbage, %zu bytes per step\n", KL_BENCH_CHAIN, KL_BENCH_GARBAGE, heap.stepsize);
+  printf("steps             %8d\n", steps);
+  printf("most work         %8zu bytes\n", most);
+  printf("longest step      %8.2f us\n", pause / 1e3);
+  if (over) printf("%d steps over %zu bytes\n", over, limit);
+  if (lost) printf("%d live instances swept\n", lost);
+  if (kept) printf("%d garbage instances kept\n", kept);
+  kl_heap_free(&heap);
+  return over != 0 || lost != 0 || kept != 0;
+}
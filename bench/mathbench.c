@@ -0,0 +1,151 @@
+/* accuracy and speed of the fixed-point math functions in number.c, measured against the C library in
+ * double precision.  build from the repository root with
+ *
+ *   cc -O2 -I. -o mathbench bench/mathbench.c number.c -lm
+ *
+ * adding -DKL_NUM_FORMAT=KL_NUM_Q8_24 (or another format from number.h) measures that format.  error is
+ * in units of the last place (2^-16 in Q16.16, of the result itself for double), against the exact
+ * result for the exact argument, and only counts arguments whose result is in range.  time is in cycles
+ * per call where the time stamp counter is available, nanoseconds otherwise */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <float.h>
+#include <math.h>
+#include <time.h>
+
+#include "number.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define KL_BENCH_UNIT "cycles"
+static inline uint64_t kl_bench_clock(void) { return __rdtsc(); }
+#else
+#define KL_BENCH_UNIT "ns"
+static inline uint64_t kl_bench_clock(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+}
+#endif
+
+#define KL_BENCH_SAMPLES 0x100000
+#define KL_BENCH_BATCH   0x1000
+#define KL_BENCH_ROUNDS  0x100
+
+typedef struct kl_bench {
+  const char  *name;
+  int          arity;
+  kl_number_t (*f1)(kl_number_t);
+  kl_number_t (*f2)(kl_number_t, kl_number_t);
+  double      (*ref)(double, double);
+  double       lo, hi;   /* first argument */
+  double       lo2, hi2; /* second argument */
+} kl_bench_t;
+
+static double ref_sin(double x, double y)   { (void)y; return sin(x); }
+static double ref_cos(double x, double y)   { (void)y; return cos(x); }
+static double ref_sincos(double x, double y) { (void)y; return sin(x) + cos(x); }
+static double ref_tan(double x, double y)   { (void)y; return tan(x); }
+static double ref_lb(double x, double y)    { (void)y; return log2(x); }
+static double ref_ln(double x, double y)    { (void)y; return log(x); }
+static double ref_sqrt(double x, double y)  { (void)y; return sqrt(x); }
+static double ref_exp2(double x, double y)  { (void)y; return exp2(x); }
+static double ref_exp(double x, double y)   { (void)y; return exp(x); }
+static double ref_pow(double x, double y)   { return pow(x, y); }
+static double ref_atan2(double y, double x) { return atan2(y, x); }
+
+/* the inline ones need an address, sincos is measured by the sum of its results */
+static kl_number_t bench_ln(kl_number_t x)  { return kl_num_ln(x); }
+static kl_number_t bench_sincos(kl_number_t x) {
+  kl_number_t s, c;
+  kl_num_sincos(x, &s, &c);
+  return s + c;
+}
+
+static const kl_bench_t benches[] = {
+  { "sin",   1, kl_num_sin,  NULL, ref_sin,   -6.3,   6.3, 0, 0 },
+  { "cos",   1, kl_num_cos,  NULL, ref_cos,   -6.3,   6.3, 0, 0 },
+  { "sincos", 1, bench_sincos, NULL, ref_sincos, -6.3, 6.3, 0, 0 },
+  { "tan",   1, kl_num_tan,  NULL, ref_tan,   -0.785, 0.785, 0, 0 },
+  { "tan",   1, kl_num_tan,  NULL, ref_tan,   -1.5,   1.5, 0, 0 },
+  { "lb",    1, kl_num_lb,   NULL, ref_lb,    0.001,  32767, 0, 0 },
+  { "ln",    1, bench_ln,    NULL, ref_ln,    0.001,  32767, 0, 0 },
+  { "sqrt",  1, kl_num_sqrt, NULL, ref_sqrt,  0,      32767, 0, 0 },
+  { "exp2",  1, kl_num_exp2, NULL, ref_exp2,  -16,    14.99, 0, 0 },
+  { "exp",   1, kl_num_exp,  NULL, ref_exp,   -11,    10.39, 0, 0 },
+  { "pow",   2, NULL, kl_num_pow,   ref_pow,   0.01,   100,   -3, 3 },
+  { "atan2", 2, NULL, kl_num_atan2, ref_atan2, -32767, 32767, -32767, 32767 },
+};
+
+/* t from 0 to 1 across the domain */
+static kl_number_t sample(double lo, double hi, double t) {
+  return kl_doubletonum(lo + t * (hi - lo));
+}
+
+static double ulps(kl_number_t x, double exact) {
+#if KL_NUM_FIXED
+  return fabs(x - exact * KL_NUM_FDIV);
+#else
+  double a = fmax(fabs(exact), DBL_MIN);
+  return fabs(x - exact) / (nextafter(a, INFINITY) - a);
+#endif
+}
+
+static double uniform(void) {
+  return (double)rand() / RAND_MAX;
+}
+
+static kl_number_t eval(const kl_bench_t *b, kl_number_t x, kl_number_t y) {
+  return b->arity == 1 ? b->f1(x) : b->f2(x, y);
+}
+
+int main(void) {
+  static kl_number_t xs[KL_BENCH_BATCH], ys[KL_BENCH_BATCH];
+
+  printf("%-6s %20s %10s %10s %10s\n", KL_NUM_NAME, "domain", "max ulp", "mean ulp", KL_BENCH_UNIT);
+  for (size_t k=0; k < sizeof(benches) / sizeof(benches[0]); k++) {
+    const kl_bench_t *b = &benches[k];
+
+    /* domains cut to the range of the format */
+    double top = kl_numtodouble(KL_NUM_MAX);
+    double lo  = fmax(b->lo, -top),  hi  = fmin(b->hi, top);
+    double lo2 = fmax(b->lo2, -top), hi2 = fmin(b->hi2, top);
+
+    double worst = 0, total = 0;
+    long   count = 0;
+    srand(1);
+    for (int i=0; i < KL_BENCH_SAMPLES; i++) {
+      /* an even sweep interleaved with random arguments */
+      kl_number_t x = sample(lo, hi, i & 1 ? uniform() : (double)i / KL_BENCH_SAMPLES);
+      kl_number_t y = sample(lo2, hi2, uniform());
+      double exact = b->ref(kl_numtodouble(x), kl_numtodouble(y));
+      if (!(fabs(exact) < kl_numtodouble(KL_NUM_MAX))) continue;
+
+      double err = ulps(eval(b, x, y), exact);
+      if (err > worst) worst = err;
+      total += err;
+      count++;
+    }
+
+    for (int i=0; i < KL_BENCH_BATCH; i++) {
+      xs[i] = sample(lo, hi, uniform());
+      ys[i] = sample(lo2, hi2, uniform());
+    }
+    volatile kl_number_t sink = 0;
+    uint64_t t0 = kl_bench_clock();
+    for (int r=0; r < KL_BENCH_ROUNDS; r++) {
+      kl_number_t acc = 0;
+      for (int i=0; i < KL_BENCH_BATCH; i++) acc += eval(b, xs[i], ys[i]);
+      sink += acc;
+    }
+    uint64_t t1 = kl_bench_clock();
+
+    char domain[32];
+    snprintf(domain, sizeof(domain), "[%g, %g]", lo, hi);
+    printf("%-6s %20s %10.2f %10.3f %10.1f\n", b->name, domain, worst, count ? total / count : 0.0,
+           (double)(t1 - t0) / ((double)KL_BENCH_BATCH * KL_BENCH_ROUNDS));
+  }
+  return 0;
+}
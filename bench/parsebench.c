@@ -0,0 +1,180 @@
+/* speed of number literal parsing, the old digit-at-a-time kl_strtoinum and kl_strtofnum against
+ * kl_num_parse, and of lexing a script made of nothing but literals.  build from the repository root with
+ *
+ *   cc -O2 -I. -o parsebench bench/parsebench.c $(ls *.c | grep -v main.c) -lm
+ *
+ * literals are random, with up to five integer digits and up to nine decimals, the range over which the
+ * old functions are exact.  the run fails if the two ever disagree, or if the ends of the range don't
+ * compile to KL_NUM_MAX and KL_NUM_MIN */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "number.h"
+#include "lexer.h"
+#include "langdefs.h"
+#include "compiler.h"
+
+#define KL_BENCH_LITERALS 0x10000
+#define KL_BENCH_ROUNDS   0x40
+
+typedef struct kl_literal {
+  char str[16 + KL_NUM_PARSE_PAD];
+  int  n;
+  int  dot; /* position of the decimal point, n if none */
+} kl_literal_t;
+
+static kl_literal_t literals[KL_BENCH_LITERALS];
+
+static uint64_t state = 88172645463325252u;
+static uint64_t rnd(void) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static const char *src;
+static int source(void) {
+  return *src ? *src++ : -1;
+}
+
+#if KL_NUM_FIXED
+static int  errors = 0;
+static void count(char *msg) {
+  (void)msg;
+  errors++;
+}
+
+/* compiles a single statement to a constant, -1 if it doesn't compile or isn't one */
+static int constant(const char *script, kl_number_t *v) {
+  kl_lexer_t lexer;
+  kl_scope_t scope = KL_SCOPE_INITIALIZER;
+  src = script;
+  kl_lexer_init(&lexer, source, count);
+  kl_code_t *code = kl_compile(&lexer, &scope);
+  int        r    = code != NULL && code->n == 1 && code->ins[0].op == KL_PUSH ? 0 : -1;
+  if (r == 0) *v = code->ins[0].arg.val.num;
+  free(code);
+  return r;
+}
+
+/* KL_NUM_MIN is the one literal whose magnitude is out of range, it may only follow a unary minus */
+static int extremes(void) {
+  char        max[64], min[64], script[80];
+  kl_number_t v;
+  int         differ = 0;
+  uint64_t    ipart  = (uint64_t)KL_NUM_MAX >> KL_NUM_FBITS;
+  snprintf(max, sizeof(max), "%llu.99999999999999999999", (unsigned long long)ipart);
+  snprintf(min, sizeof(min), "%llu", (unsigned long long)ipart + 1);
+
+  snprintf(script, sizeof(script), "%s;", max);
+  if (constant(script, &v) < 0 || v != KL_NUM_MAX) differ++, printf("differ: %s\n", script);
+  snprintf(script, sizeof(script), "-%s;", max);
+  if (constant(script, &v) < 0 || v != -KL_NUM_MAX) differ++, printf("differ: %s\n", script);
+  snprintf(script, sizeof(script), "-%s;", min);
+  if (constant(script, &v) < 0 || v != KL_NUM_MIN) differ++, printf("differ: %s\n", script);
+
+  /* out of range anywhere else */
+  static const char *const bad[] = { "%s;", "1 - %s;", "-%s.5;", "-(%s);" };
+  for (size_t i=0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+    snprintf(script, sizeof(script), bad[i], min);
+    int e = errors;
+    if (constant(script, &v) == 0 || errors == e) differ++, printf("not rejected: %s\n", script);
+  }
+  return differ;
+}
+#endif
+
+int main(void) {
+  size_t total = 0;
+  for (int i=0; i < KL_BENCH_LITERALS; i++) {
+    kl_literal_t *l = &literals[i];
+    int ni = 1 + rnd() % 5;
+    int nf = rnd() % 10;
+    int n  = 0;
+    for (int k=0; k < ni; k++) l->str[n++] = '0' + rnd() % 10;
+    if (ni == 5) l->str[0] = '0' + rnd() % 3; /* within Q16.16 */
+    l->dot = n;
+    if (nf > 0) {
+      l->str[n++] = '.';
+      for (int k=0; k < nf; k++) l->str[n++] = '0' + rnd() % 10;
+    }
+    l->n   = n;
+    total += n + 1;
+  }
+
+  kl_number_t sum[2] = { 0, 0 };
+  double      t[2];
+  for (int m=0; m < 2; m++) {
+    double t0 = now();
+    for (int r=0; r < KL_BENCH_ROUNDS; r++) {
+      for (int i=0; i < KL_BENCH_LITERALS; i++) {
+        kl_literal_t *l = &literals[i];
+        kl_number_t   v;
+        if (m == 0) {
+          v = kl_strtoinum(l->str, l->dot);
+          if (l->dot < l->n) v += kl_strtofnum(l->str + l->dot + 1, l->n - l->dot - 1);
+        } else {
+          kl_num_parse(l->str, l->n, &v);
+        }
+        sum[m] += v;
+      }
+    }
+    t[m] = (now() - t0) / ((double)KL_BENCH_ROUNDS * KL_BENCH_LITERALS);
+  }
+
+  int differ = 0;
+  for (int i=0; i < KL_BENCH_LITERALS; i++) {
+    kl_literal_t *l = &literals[i];
+    kl_number_t   a = kl_strtoinum(l->str, l->dot), b;
+    if (l->dot < l->n) a += kl_strtofnum(l->str + l->dot + 1, l->n - l->dot - 1);
+    if (kl_num_parse(l->str, l->n, &b) < 0 || a != b) {
+      if (differ++ < 8) printf("differ: %.*s\n", l->n, l->str);
+    }
+  }
+
+  /* the same literals as one script, through the lexer */
+  char *script = malloc(total + 1), *p = script;
+  for (int i=0; i < KL_BENCH_LITERALS; i++) {
+    memcpy(p, literals[i].str, literals[i].n);
+    p   += literals[i].n;
+    *p++ = ';';
+  }
+  *p = '\0';
+
+  double lex = 0;
+  int    tokens = 0;
+  for (int r=0; r < KL_BENCH_ROUNDS; r++) {
+    kl_lexer_t lexer;
+    kl_token_t token;
+    src = script;
+    kl_lexer_init(&lexer, source, NULL);
+    double t0 = now();
+    do {
+      kl_lexer_next(&lexer, &token);
+      tokens++;
+    } while (token.header.type != KL_NONE);
+    lex += now() - t0;
+  }
+  free(script);
+
+  printf("%s, %d literals of %.1f characters on average\n", KL_NUM_NAME, KL_BENCH_LITERALS,
+         (double)total / KL_BENCH_LITERALS - 1);
+  printf("kl_strtoinum/fnum %8.2f ns\n", t[0]);
+  printf("kl_num_parse      %8.2f ns\n", t[1]);
+  printf("lexer             %8.2f ns per token\n", lex / tokens);
+#if KL_NUM_FIXED
+  differ += extremes();
+#endif
+  if (differ) printf("%d literals differ\n", differ);
+  return differ != 0 || sum[0] != sum[1];
+}
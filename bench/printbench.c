@@ -0,0 +1,96 @@
+/* cost of writing results out, libc's printf("%f") on the converted double against kl_num_format and the
+ * kl_numwriter_t buffer.  build from the repository root with
+ *
+ *   cc -O2 -I. -o printbench bench/printbench.c number.c -lm
+ *
+ * values are random over the whole range of the number format, each written as "result: <value>\n" to
+ * /dev/null.  time is in nanoseconds per value.  the run fails if a value does not read back exactly
+ * through kl_num_parse, or strtod for a double */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "number.h"
+
+#define KL_BENCH_VALUES 0x10000
+#define KL_BENCH_ROUNDS 0x10
+
+static kl_number_t values[KL_BENCH_VALUES];
+
+static uint64_t state = 88172645463325252u;
+static uint64_t rnd(void) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+int main(void) {
+  FILE *null = fopen("/dev/null", "w");
+  if (null == NULL) return 1;
+
+  for (int i=0; i < KL_BENCH_VALUES; i++) {
+#if KL_NUM_FIXED
+    values[i] = (kl_number_t)rnd();
+#else
+    values[i] = (double)(int64_t)rnd() / 4294967296.0;
+#endif
+  }
+
+  int bad = 0;
+  for (int i=0; i < KL_BENCH_VALUES; i++) {
+    char        buf[KL_NUM_STRLEN + KL_NUM_PARSE_PAD];
+    kl_number_t v;
+    int         n = kl_num_format(values[i], buf);
+#if KL_NUM_FIXED
+    if (kl_num_parse(buf, n, &v) < 0 || v != values[i]) {
+#else
+    (void)n;
+    if ((v = strtod(buf, NULL)) != values[i]) {
+#endif
+      if (bad++ < 8) printf("does not read back: %s\n", buf);
+    }
+  }
+
+  double t0 = now();
+  for (int r=0; r < KL_BENCH_ROUNDS; r++) {
+    for (int i=0; i < KL_BENCH_VALUES; i++) fprintf(null, "result: %f\n", kl_numtodouble(values[i]));
+  }
+  double t1 = now();
+  for (int r=0; r < KL_BENCH_ROUNDS; r++) {
+    for (int i=0; i < KL_BENCH_VALUES; i++) {
+      char buf[KL_NUM_STRLEN];
+      kl_num_format(values[i], buf);
+      fprintf(null, "result: %s\n", buf);
+    }
+  }
+  double t2 = now();
+  static kl_numwriter_t w;
+  kl_numwriter_init(&w, null);
+  for (int r=0; r < KL_BENCH_ROUNDS; r++) {
+    for (int i=0; i < KL_BENCH_VALUES; i++) {
+      kl_numwriter_str(&w, "result: ", 8);
+      kl_numwriter_num(&w, values[i]);
+      kl_numwriter_str(&w, "\n", 1);
+    }
+  }
+  kl_numwriter_flush(&w);
+  double t3 = now();
+
+  double per = (double)KL_BENCH_ROUNDS * KL_BENCH_VALUES;
+  printf("%s\n", KL_NUM_NAME);
+  printf("printf %%f          %8.2f ns\n", (t1 - t0) / per);
+  printf("kl_num_format     %8.2f ns\n", (t2 - t1) / per);
+  printf("kl_numwriter_t    %8.2f ns\n", (t3 - t2) / per);
+  if (bad) printf("%d values do not read back\n", bad);
+  fclose(null);
+  return bad != 0;
+}
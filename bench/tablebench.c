@@ -0,0 +1,223 @@
+/* accuracy, time and L1 footprint of the sine and lb lookup tables over the settings tools/tablegen.c
+ * offers, to pick the ones number.c is built with.  build from the repository root with
+ *
+ *   cc -O2 -I. -o tablebench bench/tablebench.c -lm
+ *
+ * each setting builds its table in memory and runs the lookup number.c would (KL_NUM_TABLE).  error is in
+ * units of the last place (2^-16) over every argument in [0, 2pi) for sin and a sweep of (0, 32768) for lb.
+ * time is per call with random arguments.  latency chains each call on the one before, pressure is the
+ * latency with a working set (three quarters of L1 unless given in bytes as the argument) walked one line
+ * per call, standing in for the rest of a worker's hot data */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "number.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define KL_BENCH_UNIT "cycles"
+static inline uint64_t kl_bench_clock(void) { return __rdtsc(); }
+#else
+#define KL_BENCH_UNIT "ns"
+static inline uint64_t kl_bench_clock(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+}
+#endif
+
+#define KL_BENCH_WORKSET 0x6000 /* when the L1 size can't be had */
+#define KL_BENCH_BATCH   0x400
+#define KL_BENCH_ROUNDS  0x400
+
+typedef struct kl_bench_config {
+  int          bits, width, lerp;
+  void        *values;
+  kl_number_t (*lookup)(uint64_t);
+} kl_bench_config_t;
+
+#define KL_BENCH_CONFIG(id, bits, width, lerp) \
+  static uint##width##_t id##_values[(1 << (bits)) + 1]; \
+  KL_NUM_TABLE(id, id##_values, bits, (width) == 32 ? 30 : 16, lerp)
+#define KL_BENCH_ENTRY(id, bits, width, lerp) \
+  { bits, width, lerp, id##_values, kl_num_##id##_lookup }
+
+KL_BENCH_CONFIG(n6_16,   6, 16, 0)
+KL_BENCH_CONFIG(l6_16,   6, 16, 1)
+KL_BENCH_CONFIG(l6_32,   6, 32, 1)
+KL_BENCH_CONFIG(n8_16,   8, 16, 0)
+KL_BENCH_CONFIG(l8_16,   8, 16, 1)
+KL_BENCH_CONFIG(l8_32,   8, 32, 1)
+KL_BENCH_CONFIG(n10_16, 10, 16, 0)
+KL_BENCH_CONFIG(n10_32, 10, 32, 0)
+KL_BENCH_CONFIG(l10_16, 10, 16, 1)
+KL_BENCH_CONFIG(l10_32, 10, 32, 1)
+KL_BENCH_CONFIG(n12_16, 12, 16, 0)
+KL_BENCH_CONFIG(n12_32, 12, 32, 0)
+KL_BENCH_CONFIG(l12_32, 12, 32, 1)
+KL_BENCH_CONFIG(n14_16, 14, 16, 0)
+
+static const kl_bench_config_t configs[] = {
+  KL_BENCH_ENTRY(n6_16,   6, 16, 0),
+  KL_BENCH_ENTRY(l6_16,   6, 16, 1),
+  KL_BENCH_ENTRY(l6_32,   6, 32, 1),
+  KL_BENCH_ENTRY(n8_16,   8, 16, 0),
+  KL_BENCH_ENTRY(l8_16,   8, 16, 1),
+  KL_BENCH_ENTRY(l8_32,   8, 32, 1),
+  KL_BENCH_ENTRY(n10_16, 10, 16, 0),
+  KL_BENCH_ENTRY(n10_32, 10, 32, 0),
+  KL_BENCH_ENTRY(l10_16, 10, 16, 1),
+  KL_BENCH_ENTRY(l10_32, 10, 32, 1),
+  KL_BENCH_ENTRY(n12_16, 12, 16, 0),
+  KL_BENCH_ENTRY(n12_32, 12, 32, 0),
+  KL_BENCH_ENTRY(l12_32, 12, 32, 1),
+  KL_BENCH_ENTRY(n14_16, 14, 16, 0),
+};
+
+/* as tools/tablegen.c */
+static void fill(const kl_bench_config_t *c, double (*f)(double)) {
+  int n = 1 << c->bits;
+  for (int i=0; i <= n; i++) {
+    double v = f((double)i / n);
+    if (c->width == 32) {
+      ((uint32_t*)c->values)[i] = (uint32_t)llrint(ldexp(v, 30));
+    } else {
+      long e = llrint(ldexp(v, 16));
+      ((uint16_t*)c->values)[i] = (uint16_t)(e > 0xFFFF ? 0xFFFF : e);
+    }
+  }
+}
+
+static double ref_sine(double x) { return sin(x * M_PI / 2); }
+static double ref_lb(double x)   { return log2(1 + x); }
+
+/* as kl_num_sin and kl_num_lb in number.c */
+static kl_number_t eval_sin(const kl_bench_config_t *c, kl_number_t theta) {
+  int64_t  p = ((int64_t)theta * INT64_C(0xA2F9836E)) >> 16;
+  uint64_t f = (uint32_t)p;
+  int      q = (int)(p >> 32);
+  uint64_t m = -(uint64_t)(q & 1);
+  kl_number_t s = -((q >> 1) & 1);
+  kl_number_t n = c->lookup(((f ^ m) - m) + (m & (UINT64_C(1) << 32)));
+  return (n ^ s) - s;
+}
+
+static kl_number_t eval_lb(const kl_bench_config_t *c, kl_number_t x) {
+  int n = 0;
+  for (int i = 16; i > 0; i >>= 1) {
+    if (x >> n >= 1 << i) n += i;
+  }
+  uint64_t f = ((uint64_t)(uint32_t)x << (32 - n)) & 0xFFFFFFFF;
+  return kl_inttonum(n - KL_NUM_FBITS) + c->lookup(f);
+}
+
+static void error(const kl_bench_config_t *c, int lb, double *worst, double *mean) {
+  double w = 0, total = 0;
+  long   count = 0;
+  if (!lb) {
+    for (kl_number_t t=0; t < (kl_number_t)(2 * M_PI * KL_NUM_FDIV); t++, count++) {
+      double e = fabs(eval_sin(c, t) - sin(kl_numtodouble(t)) * KL_NUM_FDIV);
+      if (e > w) w = e;
+      total += e;
+    }
+  } else {
+    for (kl_number_t x=1; x > 0 && x < INT32_MAX - 0x7FF; x += (x >> 12) + 1, count++) {
+      double e = fabs(eval_lb(c, x) - log2(kl_numtodouble(x)) * KL_NUM_FDIV);
+      if (e > w) w = e;
+      total += e;
+    }
+  }
+  *worst = w;
+  *mean  = total / count;
+}
+
+/* per call over random arguments: independent calls, a chain where each argument depends on the previous
+ * result, and the same chain interleaved with a pointer chase through the working set */
+static double timing_once(const kl_bench_config_t *c, int lb, const kl_number_t *args, int chain,
+                     const uint32_t *workset) {
+  kl_number_t r = 0, acc = 0;
+  uint32_t    line = 0;
+  uint64_t t0 = kl_bench_clock();
+  for (long i=0; i < (long)KL_BENCH_BATCH * KL_BENCH_ROUNDS; i++) {
+    if (workset) line = workset[line * 16 + (r & 1)];
+    kl_number_t x = args[i & (KL_BENCH_BATCH - 1)];
+    if (chain) x += (r & 1) + (line & 1);
+    if (c) {
+      r    = lb ? eval_lb(c, x) : eval_sin(c, x);
+      acc += r;
+    }
+  }
+  uint64_t t1 = kl_bench_clock();
+  volatile kl_number_t sink = acc + (kl_number_t)line;
+  (void)sink;
+  return (double)(t1 - t0) / ((double)KL_BENCH_BATCH * KL_BENCH_ROUNDS);
+}
+
+/* best of a few runs */
+static double timing(const kl_bench_config_t *c, int lb, const kl_number_t *args, int chain,
+                     const uint32_t *workset) {
+  double best = timing_once(c, lb, args, chain, workset);
+  for (int i=0; i < 4; i++) {
+    double t = timing_once(c, lb, args, chain, workset);
+    if (t < best) best = t;
+  }
+  return best;
+}
+
+int main(int argc, char **argv) {
+  static kl_number_t args[2][KL_BENCH_BATCH];
+  srand(1);
+  for (int i=0; i < KL_BENCH_BATCH; i++) {
+    args[0][i] = (kl_number_t)(rand() % (int)(2 * M_PI * KL_NUM_FDIV));
+    args[1][i] = (kl_number_t)(((uint32_t)rand() << 8 ^ rand()) & INT32_MAX) | 1;
+  }
+
+  /* the working set is a random cycle through 64 byte lines, both first words of a line holding the next */
+  long size = argc > 1 ? atol(argv[1]) : 0;
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  if (size <= 0) size = sysconf(_SC_LEVEL1_DCACHE_SIZE) * 3 / 4;
+#endif
+  if (size <= 0) size = KL_BENCH_WORKSET;
+  uint32_t  nlines  = (uint32_t)(size / 64);
+  uint32_t *workset = malloc((size_t)nlines * 64);
+  uint32_t *order   = malloc(nlines * sizeof(uint32_t));
+  for (uint32_t i=0; i < nlines; i++) order[i] = i;
+  for (uint32_t i=nlines - 1; i > 0; i--) {
+    uint32_t j = (uint32_t)rand() % (i + 1), t = order[i];
+    order[i] = order[j];
+    order[j] = t;
+  }
+  for (uint32_t i=0; i < nlines; i++) {
+    workset[order[i] * 16] = workset[order[i] * 16 + 1] = order[(i + 1) % nlines];
+  }
+  free(order);
+  double chase = timing(NULL, 0, args[0], 1, workset);
+
+  printf("working set %ld bytes\n", (long)nlines * 64);
+  printf("%-5s %-8s %7s %8s %8s %8s %8s %8s\n", "table", "setting", "bytes", "max ulp", "mean ulp",
+         KL_BENCH_UNIT, "latency", "pressure");
+  for (int lb=0; lb < 2; lb++) {
+    for (size_t k=0; k < sizeof(configs) / sizeof(configs[0]); k++) {
+      const kl_bench_config_t *c = &configs[k];
+      fill(c, lb ? ref_lb : ref_sine);
+
+      double worst, mean;
+      error(c, lb, &worst, &mean);
+      double thru     = timing(c, lb, args[lb], 0, NULL);
+      double latency  = timing(c, lb, args[lb], 1, NULL);
+      double pressure = timing(c, lb, args[lb], 1, workset) - chase;
+
+      char setting[16];
+      snprintf(setting, sizeof(setting), "%d %d %s", c->bits, c->width, c->lerp ? "lerp" : "near");
+      printf("%-5s %-8s %7d %8.2f %8.3f %8.1f %8.1f %8.1f\n", lb ? "lb" : "sine", setting,
+             ((1 << c->bits) + 1) * c->width / 8, worst, mean, thru, latency, pressure);
+    }
+  }
+  free(workset);
+  return 0;
+}
@@ -2,170 +2,650 @@
 
 #include "lexer.h"
 #include "langdefs.h"
+#include "symbol.h"
+#include "vm.h"
 
-#include "util/list.h"
-#include "util/array.h"
-
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <time.h>
 
-static int precedence(int op) {
-  switch(op) {
-    case KL_UADD:
-    case KL_USUB:
-    case KL_BITNOT:
-    case KL_LOGNOT:
-    case KL_SINE:
-    case KL_COSINE:
-    case KL_LOG_E:
-    case KL_LOG_2:
-    case KL_LOG_10:
-      return 7;
-    case KL_MUL:
-    case KL_DIV:
-    case KL_FDIV:
-    case KL_MOD:
-      return 6;
-    case KL_ADD:
-    case KL_SUB:
-      return 5;
-    case KL_ASHFTL:
-    case KL_ASHFTR:
-    case KL_LSHFTL:
-    case KL_LSHFTR:
-      return 4;
-    case KL_BITAND:
-    case KL_BITOR:
-    case KL_BITXOR:
-      return 3;
-    case KL_CMP:
-    case KL_NEQ:
-    case KL_EQ:
-    case KL_LT:
-    case KL_GT:
-    case KL_LEQ:
-    case KL_GEQ:
+/* fixed-capacity scratch space -- compiling does not touch the heap until the final kl_code_t */
+#define KL_COMPILER_CODESIZE 0x1000 /* instructions */
+#define KL_COMPILER_MAXDEPTH 0x0100 /* nested subexpressions */
+#define KL_COMPILER_CACHESIZE 0x0400 /* inline cache entries */
+#define KL_COMPILER_MAGICSIZE 0x0100 /* constant divisors */
+#define KL_COMPILER_MAXTARGETS 0x0010 /* names on the left of a multiple assignment */
+#define KL_COMPILER_SELECTCOST 4 /* most an arm of a conditional may cost and still be evaluated speculatively */
+
+typedef struct kl_compiler {
+  kl_lexer_t *source;
+  kl_scope_t *scope;
+  kl_token_t  token; /* lookahead */
+  int         depth;
+  int         n;
+  int         ncache;
+  int         label; /* latest jump target, nothing before it may be folded into what follows */
+  int         nmagic;
+  int         line; /* of the token consumed last, given to the instructions emitted for it */
+  kl_ins_t    ins[KL_COMPILER_CODESIZE];
+  int         lines[KL_COMPILER_CODESIZE]; /* line of each instruction, moved along with ins */
+#if KL_COMPILER_STATS
+  kl_compiler_stats_t stats;
+  kl_lexer_stats_t    lex;   /* the lexer's running counts when compiling began */
+  uint64_t            allocs;
+  uint64_t            allocbytes;
+  uint64_t            start;
+#endif
+  kl_num_magic_t magic[KL_COMPILER_MAGICSIZE];
+} kl_compiler_t;
+
+/* binding power of each token in prefix (unary) and infix (binary) position, indexed by the low byte of
+ * the token type -- unary and binary forms of the same operator share a row */
+#define KL_PREC_NONE    0
+#define KL_PREC_ASSIGN  1
+#define KL_PREC_COND    2
+#define KL_PREC_LOGIC   3
+#define KL_PREC_COMPARE 4
+#define KL_PREC_BITWISE 5
+#define KL_PREC_SHIFT   6
+#define KL_PREC_SUM     7
+#define KL_PREC_PRODUCT 8
+#define KL_PREC_UNARY   9
+
+typedef struct kl_rule {
+  unsigned char prefix;
+  unsigned char infix;
+} kl_rule_t;
+
+#define KL_RULE_INDEX(type) ((type) & 0xFF)
+#define KL_RULE(type, prefix, infix) \
+  [KL_RULE_INDEX(type)] = { (prefix), (infix) }
+
+static const kl_rule_t rules[0x100] = {
+  KL_RULE(KL_ADD,    KL_PREC_UNARY, KL_PREC_SUM),
+  KL_RULE(KL_SUB,    KL_PREC_UNARY, KL_PREC_SUM),
+  KL_RULE(KL_MUL,    KL_PREC_NONE,  KL_PREC_PRODUCT),
+  KL_RULE(KL_DIV,    KL_PREC_NONE,  KL_PREC_PRODUCT),
+  KL_RULE(KL_FDIV,   KL_PREC_NONE,  KL_PREC_PRODUCT),
+  KL_RULE(KL_MOD,    KL_PREC_NONE,  KL_PREC_PRODUCT),
+  KL_RULE(KL_ASHFTL, KL_PREC_NONE,  KL_PREC_SHIFT),
+  KL_RULE(KL_ASHFTR, KL_PREC_NONE,  KL_PREC_SHIFT),
+  KL_RULE(KL_LSHFTL, KL_PREC_NONE,  KL_PREC_SHIFT),
+  KL_RULE(KL_LSHFTR, KL_PREC_NONE,  KL_PREC_SHIFT),
+  KL_RULE(KL_BITAND, KL_PREC_NONE,  KL_PREC_BITWISE),
+  KL_RULE(KL_BITOR,  KL_PREC_NONE,  KL_PREC_BITWISE),
+  KL_RULE(KL_BITXOR, KL_PREC_NONE,  KL_PREC_BITWISE),
+  KL_RULE(KL_BITNOT, KL_PREC_UNARY, KL_PREC_NONE),
+
+  KL_RULE(KL_SINE,   KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_COSINE, KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_LOG_E,  KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_LOG_2,  KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_LOG_10, KL_PREC_UNARY, KL_PREC_NONE),
+
+  KL_RULE(KL_DOT,       KL_PREC_NONE,  KL_PREC_PRODUCT),
+  KL_RULE(KL_CROSS,     KL_PREC_NONE,  KL_PREC_PRODUCT),
+  KL_RULE(KL_ROTATE,    KL_PREC_NONE,  KL_PREC_PRODUCT),
+  KL_RULE(KL_LENGTH,    KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_NORMALIZE, KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_ABS,       KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_SIGN,      KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_SQRT,      KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_EXP_E,     KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_EXP_2,     KL_PREC_UNARY, KL_PREC_NONE),
+  KL_RULE(KL_TANGENT,   KL_PREC_UNARY, KL_PREC_NONE),
+
+  KL_RULE(KL_CMP,    KL_PREC_NONE,  KL_PREC_COMPARE),
+  KL_RULE(KL_NEQ,    KL_PREC_NONE,  KL_PREC_COMPARE),
+  KL_RULE(KL_EQ,     KL_PREC_NONE,  KL_PREC_COMPARE),
+  KL_RULE(KL_LT,     KL_PREC_NONE,  KL_PREC_COMPARE),
+  KL_RULE(KL_GT,     KL_PREC_NONE,  KL_PREC_COMPARE),
+  KL_RULE(KL_LEQ,    KL_PREC_NONE,  KL_PREC_COMPARE),
+  KL_RULE(KL_GEQ,    KL_PREC_NONE,  KL_PREC_COMPARE),
+  KL_RULE(KL_LOGAND, KL_PREC_NONE,  KL_PREC_LOGIC),
+  KL_RULE(KL_LOGOR,  KL_PREC_NONE,  KL_PREC_LOGIC),
+  KL_RULE(KL_LOGNOT, KL_PREC_UNARY, KL_PREC_NONE),
+};
+
+static int expression(kl_compiler_t *c, int prec);
+
+/* frame slot bound to a local name, -1 if unbound */
+static int resolve(kl_scope_t *scope, uint32_t sym) {
+  for (int i=0; i < scope->n; i++) {
+    if (scope->sym[i] == sym) return i;
+  }
+  return -1;
+}
+
+static inline int isname(int type) {
+  return type == KL_LOCAL || type == KL_GLOBAL || type == KL_INSTVAR;
+}
+
+static inline void advance(kl_compiler_t *c) {
+  c->line = c->token.header.line;
+  kl_lexer_next(c->source, &c->token);
+}
+
+/* a KL_ERROR token has been reported by the lexer already, the statement fails without a second message */
+static int error(kl_compiler_t *c, const char *msg) {
+  if (c->token.header.type != KL_ERROR) fprintf(stderr, "KludgeScript Compiler: %s on line %d\n", msg, c->token.header.line);
+  return -1;
+}
+
+static int emit(kl_compiler_t *c, uint32_t op, kl_valref_t arg) {
+  if (c->n >= KL_COMPILER_CODESIZE) return error(c, "Expression too long");
+#if KL_COMPILER_STATS
+  c->stats.instructions++;
+#endif
+  c->lines[c->n] = c->line;
+  kl_ins_t *ins = &c->ins[c->n++];
+  ins->op  = op;
+  ins->arg = arg;
+  return 0;
+}
+
+/* number of values an operator pops */
+static int arity(uint32_t op) {
+  switch (op) {
+    case KL_MIN:
+    case KL_MAX:
+    case KL_POW:
+    case KL_ATAN2:
       return 2;
-    case KL_LOGAND:
-    case KL_LOGOR:
-      return 1;
+    case KL_CLAMP:
+    case KL_LERP:
+    case KL_SELECT:
+    case KL_MULADD:
+    case KL_ADDMUL:
+      return 3;
   }
+  if (op & KL_FLAG_UNOP)  return 1;
+  if (op & KL_FLAG_BINOP) return 2;
   return 0;
 }
 
-static int reverse(array_t *code, list_t *stack, int *operands, int pre, int delim);
+/* division by a constant becomes a multiply and shift, the PUSH of the divisor is replaced by the
+ * instruction.  returns 0 if it did nothing */
+static int divconst(kl_compiler_t *c, uint32_t op) {
+  if (c->n < 1 || c->label >= c->n) return 0;
+  kl_ins_t *ins = &c->ins[c->n - 1];
+  if (ins->op != KL_PUSH || ins->arg.ns != KL_NS_IMMEDIATE) return 0;
+  if (c->nmagic >= KL_COMPILER_MAGICSIZE || kl_num_magic(ins->arg.val.num, &c->magic[c->nmagic]) < 0) return 0;
 
-kl_code_t* kl_compile(kl_lexer_t* source) {
-  array_t code;
-  array_init(&code, sizeof(kl_ins_t));
-  list_t  stack = LIST_INITIALIZER;
+  ins->op  = op == KL_DIV ? KL_DIVC : op == KL_FDIV ? KL_FDIVC : KL_MODC;
+  ins->arg = (kl_valref_t){ .ns = 0, .val.ref = c->nmagic++ };
+  return 1;
+}
 
-  kl_token_t token;
-  kl_ins_t ins;
+/* operators whose operands are all constants are folded into a single PUSH */
+static int emit_op(kl_compiler_t *c, uint32_t op) {
+  int k = arity(op);
+  if (k > 0 && c->n - k >= c->label) {
+    kl_valref_t arg[3] = { { 0 } }, out;
+    int i;
+    for (i=0; i < k; i++) {
+      kl_ins_t *ins = &c->ins[c->n - k + i];
+      if (ins->op != KL_PUSH || ins->arg.ns != KL_NS_IMMEDIATE) break;
+      arg[i] = ins->arg;
+    }
+    if (i == k && kl_vm_fold(op, arg, &out) == 0) {
+      c->n -= k;
+      return emit(c, KL_PUSH, out);
+    }
+  }
+  if ((op == KL_DIV || op == KL_FDIV || op == KL_MOD) && divconst(c, op)) return 0;
+  return emit(c, op, (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO });
+}
 
-  int operands = 0;
-  int failure = 0;
+/* removes one instruction that falls through.  jumps are relative, and one that targeted the removed
+ * instruction now lands on the next, just as falling through would have */
+static void cut(kl_compiler_t *c, int at) {
+  memmove(&c->ins[at], &c->ins[at + 1], (c->n - at - 1) * sizeof(kl_ins_t));
+  memmove(&c->lines[at], &c->lines[at + 1], (c->n - at - 1) * sizeof(int));
+  c->n--;
+  if (c->label > at) c->label--;
+}
 
-  for (;;) {
-    kl_lexer_next(source, &token);
-    if (token.header.type == KL_NONE) break;
-    if (token.header.type == KL_NUMBER) {
-      ins.op          = KL_PUSH;
-      ins.arg.ns      = KL_NS_IMMEDIATE;
-      ins.arg.val.num = token.num.val;
-      array_push(&code, &ins);
-
-      operands++;
-    } else if (token.header.type == KL_LPAREN) {
-      kl_token_t *t = malloc(sizeof(kl_token_t));
-      memcpy(t, &token, sizeof(kl_token_t));
-      list_push(&stack, t);
-    } else if (token.header.type == KL_RPAREN) {
-      int err = reverse(&code, &stack, &operands, 0, KL_LPAREN);
-      if (err < 0) {
-        if (err == -2) {
-          fprintf(stderr, "KludgeScript Compiler: Unmatched parenthesis on line %d\n", token.header.line);
-        }
-        failure = 1;
-      }
-    } else if (token.header.type & KL_FLAG_UNOP || token.header.type & KL_FLAG_BINOP) {
-      int pre = precedence(token.header.type);
-      int associativity = token.header.type & KL_FLAG_ASSOCIATIVITY;
-      if (reverse(&code, &stack, &operands, associativity ? pre + 1 : pre, KL_NONE) < 0) {
-        failure = 1;
-        break;
+/* cost of running ins[from..to) unconditionally, or KL_VM_COST_UNSAFE if it must not run speculatively */
+static int speculate(kl_compiler_t *c, int from, int to) {
+  int cost = 0;
+  for (int i=from; i < to; i++) {
+    int op = kl_vm_opcost(c->ins[i].op);
+    if (op >= KL_VM_COST_UNSAFE) return KL_VM_COST_UNSAFE;
+    cost += op;
+  }
+  return cost;
+}
+
+/* globals and instance variables are resolved by the vm, each access gets its own inline cache entry */
+static int cached(kl_compiler_t *c, uint32_t op, uint32_t sym) {
+  if (c->ncache >= KL_COMPILER_CACHESIZE) return error(c, "Too many variable references");
+  return emit(c, op, (kl_valref_t){ .ns = sym, .val.ref = c->ncache++ });
+}
+
+/* stores the top of stack into a name, binding a new local if it has none yet */
+static int store(kl_compiler_t *c, kl_token_t t) {
+  if (t.header.type == KL_GLOBAL)  return cached(c, KL_STOREG, t.val.sym);
+  if (t.header.type == KL_INSTVAR) return cached(c, KL_STOREI, t.val.sym);
+
+  int slot = resolve(c->scope, t.val.sym);
+  if (slot < 0) {
+    if (c->scope->n >= KL_SCOPE_MAXLOCALS) return error(c, "Too many local variables");
+    slot = c->scope->n++;
+    c->scope->sym[slot] = t.val.sym;
+  }
+  return emit(c, KL_STORE, (kl_valref_t){ .ns = 0, .val.ref = slot });
+}
+
+/* a name, already consumed, or an assignment to it if the surrounding precedence allows one */
+static int variable(kl_compiler_t *c, kl_token_t t, int prec) {
+  if (c->token.header.type == KL_ASSIGN && prec < KL_PREC_ASSIGN) {
+    advance(c);
+    if (expression(c, KL_PREC_ASSIGN - 1) < 0) return -1;
+    return store(c, t);
+  }
+
+  if (t.header.type == KL_GLOBAL)  return cached(c, KL_LOADG, t.val.sym);
+  if (t.header.type == KL_INSTVAR) return cached(c, KL_LOADI, t.val.sym);
+
+  int slot = resolve(c->scope, t.val.sym);
+  if (slot < 0) {
+    fprintf(stderr, "KludgeScript Compiler: Undefined variable '%s' on line %d\n",
+            kl_symbol_name(t.val.sym, NULL), t.header.line);
+    return -1;
+  }
+  return emit(c, KL_LOAD, (kl_valref_t){ .ns = 0, .val.ref = slot });
+}
+
+/* prefix position: literals, names, parenthesized subexpressions and unary operators */
+static int operand(kl_compiler_t *c, int prec) {
+  kl_token_t t = c->token;
+
+  if (isname(t.header.type)) {
+    advance(c);
+    return variable(c, t, prec);
+  }
+
+  if (t.header.type == KL_NUMBER) {
+    advance(c);
+    return emit(c, KL_PUSH, (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = t.val.num });
+  }
+
+  if (t.header.type == KL_LPAREN) {
+    advance(c);
+    if (expression(c, KL_PREC_NONE) < 0) return -1;
+    if (c->token.header.type == KL_ASSIGN) return error(c, "Invalid assignment target");
+    if (c->token.header.type != KL_RPAREN) return error(c, "Unmatched parenthesis");
+    advance(c);
+    return 0;
+  }
+
+  if (t.header.type == KL_LBRACKET) {
+    advance(c);
+    int n = 0;
+    while (c->token.header.type != KL_RBRACKET) {
+      if (n > 0) {
+        if (c->token.header.type != KL_COMMA) return error(c, "Expected ',' or ']'");
+        advance(c);
       }
+      if (expression(c, KL_PREC_NONE) < 0) return -1;
+      n++;
+    }
+    advance(c);
+    return emit(c, KL_ARRAY, (kl_valref_t){ .ns = 0, .val.ref = n });
+  }
 
-      kl_token_t *t = malloc(sizeof(kl_token_t));
-      memcpy(t, &token, sizeof(kl_token_t));
-      list_push(&stack, t);
-    } else if (token.header.type == KL_END) {
-      if (reverse(&code, &stack, &operands, 0, KL_NONE) < 0) {
-        failure = 1;
+  int k = arity(t.header.type);
+  if (k > 0 && !(t.header.type & (KL_FLAG_UNOP | KL_FLAG_BINOP))) {
+    /* intrinsics called with a parenthesized argument list */
+    advance(c);
+    if (c->token.header.type != KL_LPAREN) return error(c, "Expected '('");
+    advance(c);
+    for (int i=0; i < k; i++) {
+      if (i > 0) {
+        if (c->token.header.type != KL_COMMA) return error(c, "Wrong number of arguments");
+        advance(c);
       }
-      break;
+      if (expression(c, KL_PREC_NONE) < 0) return -1;
     }
+    if (c->token.header.type != KL_RPAREN) return error(c, "Wrong number of arguments");
+    advance(c);
+    return emit_op(c, t.header.type);
   }
 
-  kl_code_t *c = NULL;
-  if (!failure) {
-    c = malloc(sizeof(kl_code_t) + array_bytes(&code));
-    c->n = array_size(&code);
-    memcpy(c->ins, array_data(&code), array_bytes(&code));
+  int prefix = rules[KL_RULE_INDEX(t.header.type)].prefix;
+  if (t.header.type & KL_FLAG_UNOP && prefix != KL_PREC_NONE) {
+    advance(c);
+    if (expression(c, prefix) < 0) return -1;
+    return emit_op(c, t.header.type);
   }
-  list_clear(&stack, free);
-  array_free(&code);
 
-  return c;
+  if (t.header.type == KL_RPAREN) return error(c, "Unmatched parenthesis");
+  if (t.header.type == KL_SINCOS) return error(c, "sincos needs two assignment targets");
+  return error(c, "Missing operands");
 }
 
-static int reverse(array_t *code, list_t *stack, int *operands, int pre, int delim) {
-  kl_ins_t ins;
+/* cond ? a : b, with the condition already compiled.  both arms are compiled behind jumps; when they are
+ * cheap and safe to evaluate regardless of the condition the jumps are dropped again for a SELECT */
+static int conditional(kl_compiler_t *c) {
+  int jz = c->n;
+  if (emit(c, KL_JZ, (kl_valref_t){ .ns = 0, .val.ref = 0 }) < 0) return -1;
+  if (expression(c, KL_PREC_NONE) < 0) return -1;
+  if (c->token.header.type != KL_COLON) return error(c, "Expected ':'");
+  advance(c);
 
-  while (!list_isempty(stack)) {
-    kl_token_t *top = list_peek(stack);
+  int jmp = c->n;
+  if (emit(c, KL_JMP, (kl_valref_t){ .ns = 0, .val.ref = 0 }) < 0) return -1;
+  if (expression(c, KL_PREC_COND - 1) < 0) return -1;
 
-    if (top->header.type == delim) {
-      free(list_pop(stack));
-      return 0;
+  int a = speculate(c, jz + 1, jmp);
+  int b = speculate(c, jmp + 1, c->n);
+  if (a <= KL_COMPILER_SELECTCOST && b <= KL_COMPILER_SELECTCOST) {
+    cut(c, jmp);
+    cut(c, jz);
+    return emit_op(c, KL_SELECT);
+  }
+
+  c->ins[jz].arg.val.ref  = jmp - jz;
+  c->ins[jmp].arg.val.ref = c->n - jmp - 1;
+  c->label = c->n;
+  return 0;
+}
+
+/* x*y + z and z + x*y are fused when the product is the last instruction of its operand, and no jump
+ * lands right after it -- that would need the product on the stack */
+static int sum(kl_compiler_t *c, int lhs) {
+  if (c->ins[lhs - 1].op == KL_MUL && c->label < lhs) {
+    cut(c, lhs - 1);
+    return emit_op(c, KL_MULADD);
+  }
+  if (c->ins[c->n - 1].op == KL_MUL && c->label < c->n) {
+    c->n--;
+    return emit_op(c, KL_ADDMUL);
+  }
+  return emit_op(c, KL_ADD);
+}
+
+/* precedence climbing -- consumes binary operators that bind tighter than prec */
+static int operators(kl_compiler_t *c, int prec) {
+  for (;;) {
+    kl_token_t t = c->token;
+
+    /* indexing binds tighter than any prefix operator, so it is never cut short by prec */
+    if (t.header.type == KL_LBRACKET) {
+      advance(c);
+      if (expression(c, KL_PREC_NONE) < 0) return -1;
+      if (c->token.header.type != KL_RBRACKET) return error(c, "Expected ']'");
+      advance(c);
+      if (emit_op(c, KL_INDEX) < 0) return -1;
+      continue;
     }
 
-    if (precedence(top->header.type) >= pre) {
-      if (top->header.type == KL_LPAREN) {
-        fprintf(stderr, "KludgeScript Compiler: Unmatched parenthesis on line %d\n", top->header.line);
-        return -1;
-      } else if (top->header.type & KL_FLAG_BINOP) {
-        if (*operands < 2) {
-          fprintf(stderr, "KludgeScript Compiler: Missing operands on line %d\n", top->header.line);
-          return -1;
-        }
-        (*operands)--;
-      } else if (top->header.type & KL_FLAG_UNOP) {
-        if (*operands < 1) {
-          fprintf(stderr, "KludgeScript Compiler: Missing on line %d\n", top->header.line);
-          return -1;
-        }
-      }
+    if (t.header.type == KL_QUESTION) {
+      if (KL_PREC_COND <= prec) break;
+      advance(c);
+      if (conditional(c) < 0) return -1;
+      continue;
+    }
+
+    if (!(t.header.type & KL_FLAG_BINOP)) break;
 
-      ins.op          = top->header.type;
-      ins.arg.ns      = KL_NS_IMMEDIATE;
-      ins.arg.val.num = KL_NUM_ZERO;
-      array_push(code, &ins);
+    int infix = rules[KL_RULE_INDEX(t.header.type)].infix;
+    if (infix <= prec) break;
 
-      free(list_pop(stack));
-    } else break;
+    advance(c);
+
+    /* && and || skip their right operand when the left one decides the result.  arrays never decide
+     * it, they fall through and combine element-wise */
+    int jump = -1;
+    if (t.header.type == KL_LOGAND || t.header.type == KL_LOGOR) {
+      jump = c->n;
+      if (emit(c, t.header.type == KL_LOGAND ? KL_JMPF : KL_JMPT, (kl_valref_t){ .ns = 0, .val.ref = 0 }) < 0) return -1;
+    }
+
+    int lhs = c->n;
+    if (expression(c, t.header.type & KL_FLAG_ASSOCIATIVITY ? infix - 1 : infix) < 0) return -1;
+    if (t.header.type == KL_ADD) {
+      if (sum(c, lhs) < 0) return -1;
+    } else if (emit_op(c, t.header.type) < 0) {
+      return -1;
+    }
+
+    if (jump >= 0) {
+      c->ins[jump].arg.val.ref = c->n - jump - 1;
+      c->label = c->n;
+    }
   }
-  if (delim != KL_NONE) return -2;
   return 0;
 }
 
+static int expression(kl_compiler_t *c, int prec) {
+  if (++c->depth > KL_COMPILER_MAXDEPTH) return error(c, "Expression nested too deeply");
+#if KL_COMPILER_STATS
+  if (c->depth > c->stats.depth) c->stats.depth = c->depth;
+#endif
+  if (operand(c, prec) < 0 || operators(c, prec) < 0) return -1;
+  c->depth--;
+  return 0;
+}
+
+/* one or, for sincos, two values on the right of a multiple assignment.  returns how many */
+static int values(kl_compiler_t *c) {
+  if (c->token.header.type != KL_SINCOS) return expression(c, KL_PREC_ASSIGN - 1) < 0 ? -1 : 1;
+
+  advance(c);
+  if (expression(c, KL_PREC_UNARY) < 0) return -1;
+
+  /* a constant angle becomes two constants */
+  kl_ins_t *ins = &c->ins[c->n - 1];
+  if (c->n - 1 >= c->label && ins->op == KL_PUSH && ins->arg.ns == KL_NS_IMMEDIATE) {
+    kl_number_t cosine;
+    kl_num_sincos(ins->arg.val.num, &ins->arg.val.num, &cosine);
+    if (emit(c, KL_PUSH, (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = cosine }) < 0) return -1;
+    return 2;
+  }
+  if (emit(c, KL_SINCOS, (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO }) < 0) return -1;
+  return 2;
+}
+
+/* a, b = x, y with the first name already consumed.  all values are computed before any is stored, so
+ * a, b = b, a swaps.  the stores run last to first, each popping its value except the first, which is
+ * left as the result */
+static int multiple(kl_compiler_t *c, kl_token_t t) {
+  kl_token_t target[KL_COMPILER_MAXTARGETS];
+  int        n = 0;
+  target[n++] = t;
+  while (c->token.header.type == KL_COMMA) {
+    advance(c);
+    if (!isname(c->token.header.type)) return error(c, "Invalid assignment target");
+    if (n >= KL_COMPILER_MAXTARGETS) return error(c, "Too many assignment targets");
+    target[n++] = c->token;
+    advance(c);
+  }
+  if (c->token.header.type != KL_ASSIGN) return error(c, "Expected '='");
+
+  int k = 0;
+  do {
+    advance(c);
+    int v = values(c);
+    if (v < 0) return -1;
+    k += v;
+  } while (c->token.header.type == KL_COMMA);
+  if (k != n) return error(c, "Wrong number of values");
+
+  for (int i=n - 1; i >= 0; i--) {
+    if (store(c, target[i]) < 0) return -1;
+    if (i > 0 && emit(c, KL_POP, (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO }) < 0) return -1;
+  }
+  return 0;
+}
+
+static int statement(kl_compiler_t *c) {
+  if (c->token.header.type == KL_END || c->token.header.type == KL_NONE) return 0;
+  if (c->token.header.type == KL_PRINT) advance(c);
+
+  if (isname(c->token.header.type)) {
+    /* a name and a comma start a multiple assignment, anything else an expression */
+    kl_token_t t = c->token;
+    advance(c);
+    if (c->token.header.type == KL_COMMA) {
+      if (multiple(c, t) < 0) return -1;
+    } else if (variable(c, t, KL_PREC_NONE) < 0 || operators(c, KL_PREC_NONE) < 0) {
+      return -1;
+    }
+  } else if (expression(c, KL_PREC_NONE) < 0) {
+    return -1;
+  }
+
+  switch (c->token.header.type) {
+    case KL_END:
+    case KL_NONE:
+      return 0;
+    case KL_RPAREN:
+      return error(c, "Unmatched parenthesis");
+    case KL_ASSIGN:
+      return error(c, "Invalid assignment target");
+    default:
+      return error(c, "Missing operator");
+  }
+}
+
+#if KL_COMPILER_STATS
+static kl_compiler_stats_t last, total;
+
+static uint64_t now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+}
+
+/* counts since begin are taken as differences of the lexer's and the interner's running counts */
+static void begin(kl_compiler_t *c) {
+  c->stats = (kl_compiler_stats_t){ .statements = 1 };
+  c->lex   = c->source->stats;
+  kl_symbol_allocated(&c->allocs, &c->allocbytes);
+  c->start = now();
+}
+
+static void end(kl_compiler_t *c, kl_code_t *code, size_t size) {
+  kl_compiler_stats_t *s = &c->stats;
+  uint64_t allocs, allocbytes;
+  kl_symbol_allocated(&allocs, &allocbytes);
+  s->errors     = code == NULL;
+  s->tokens     = c->source->stats.tokens - c->lex.tokens;
+  s->bytes      = c->source->stats.bytes - c->lex.bytes;
+  s->lexns      = c->source->stats.ns - c->lex.ns;
+  s->compilens  = now() - c->start - s->lexns;
+  s->allocs     = allocs - c->allocs + (code != NULL);
+  s->allocbytes = allocbytes - c->allocbytes + size;
+
+  last = *s;
+  total.statements   += s->statements;
+  total.errors       += s->errors;
+  total.tokens       += s->tokens;
+  total.bytes        += s->bytes;
+  total.instructions += s->instructions;
+  total.allocs       += s->allocs;
+  total.allocbytes   += s->allocbytes;
+  total.lexns        += s->lexns;
+  total.compilens    += s->compilens;
+  if (s->depth > total.depth) total.depth = s->depth;
+}
+
+const kl_compiler_stats_t* kl_compiler_stats_last(void) {
+  return &last;
+}
+
+const kl_compiler_stats_t* kl_compiler_stats_total(void) {
+  return &total;
+}
+
+void kl_compiler_stats_reset(void) {
+  last  = (kl_compiler_stats_t){ 0 };
+  total = (kl_compiler_stats_t){ 0 };
+}
+#endif
+
+kl_code_t* kl_compile(kl_lexer_t* source, kl_scope_t* scope) {
+  kl_compiler_t c;
+  c.source = source;
+  c.scope  = scope;
+  c.depth  = 0;
+  c.n      = 0;
+  c.ncache = 0;
+  c.label  = 0;
+  c.nmagic = 0;
+  c.token.header.line = source->line;
+#if KL_COMPILER_STATS
+  begin(&c);
+#endif
+
+  int nlocals = scope->n;
+
+  advance(&c);
+  if (statement(&c) < 0) {
+    /* skip the rest of the statement so that the next one starts clean */
+    while (c.token.header.type != KL_END && c.token.header.type != KL_NONE) advance(&c);
+    scope->n = nlocals; /* unbind names introduced by the failed statement */
+#if KL_COMPILER_STATS
+    end(&c, NULL, 0);
+#endif
+    return NULL;
+  }
+
+  int nlines = 0;
+  for (int i=0; i < c.n; i++) {
+    if (i == 0 || c.lines[i] != c.lines[i - 1]) nlines++;
+  }
+
+  size_t pool = (sizeof(kl_code_t) + c.n * sizeof(kl_ins_t) + c.ncache * sizeof(kl_cache_t) + 7) & ~(size_t)7;
+  size_t magic = c.nmagic * sizeof(kl_num_magic_t);
+  size_t size = pool + magic + nlines * sizeof(kl_linerun_t);
+  kl_code_t *code = malloc(size);
+  code->n       = c.n;
+  code->nlocals = scope->n;
+  code->ncache  = c.ncache;
+  code->nmagic  = c.nmagic;
+  code->nlines  = nlines;
+  code->cache   = (kl_cache_t*)(code->ins + c.n);
+  code->magic   = (kl_num_magic_t*)((char*)code + pool);
+  code->lines   = (kl_linerun_t*)((char*)code + pool + magic);
+  code->name    = source->name;
+  memcpy(code->ins, c.ins, c.n * sizeof(kl_ins_t));
+  memcpy(code->magic, c.magic, c.nmagic * sizeof(kl_num_magic_t));
+  for (int i=0, k=0; i < c.n; i++) {
+    if (i == 0 || c.lines[i] != c.lines[i - 1]) code->lines[k++] = (kl_linerun_t){ .ip = i, .line = c.lines[i] };
+  }
+  for (int i=0; i < c.ncache; i++) {
+    code->cache[i] = (kl_cache_t){ .key = KL_CACHE_EMPTY, .val = 0 };
+  }
+#if KL_COMPILER_STATS
+  end(&c, code, size);
+#endif
+
+  return code;
+}
+
 void kl_code_print(kl_code_t *code) {
   for (int i=0; i < code->n; i++) {
     kl_ins_t *ins = &code->ins[i];
     if (ins->arg.ns == KL_NS_IMMEDIATE) {
-      printf("%s: IMM, %.5f\n", kl_langdef_name(ins->op), kl_numtofloat(ins->arg.val.num));
+      printf("%s: IMM, %.5f\n", kl_langdef_name(ins->op), kl_numtodouble(ins->arg.val.num));
     } else {
       printf("%s: %u, %u\n", kl_langdef_name(ins->op), ins->arg.ns, ins->arg.val.ref);
     }
   }
 }
+
+int kl_code_line(const kl_code_t *code, int ip) {
+  if (ip < 0 || ip >= code->n) return 0;
+
+  /* last run starting at or before ip */
+  int lo = 0, hi = code->nlines - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (code->lines[mid].ip <= (uint32_t)ip) lo = mid; else hi = mid - 1;
+  }
+  return code->lines[lo].line;
+}
@@ -7,11 +7,13 @@
 typedef struct kl_valref {
   uint32_t ns;  /* namespace/object id */
   union {
-    uint32_t    ref; /* reference */
-    kl_number_t num; /* immediate-mode value */
+    uint32_t      ref;  /* reference */
+    kl_number_t   num;  /* immediate-mode value */
+    kl_num_bits_t bits; /* either, as raw bits wide enough for both */
   } val;
 } kl_valref_t;
 
+/* any other ns is a reference: val.ref names a heap handle and ns is its generation */
 #define KL_NS_IMMEDIATE 0xFFFFFFFF
 
 typedef struct kl_ins {
@@ -19,12 +21,69 @@ typedef struct kl_ins {
   kl_valref_t arg;
 } kl_ins_t;
 
+/* per-instruction inline cache, filled in by the vm */
+typedef struct kl_cache {
+  uint32_t key; /* what the entry was resolved under, e.g. a table version or a shape */
+  uint32_t val; /* resolved slot */
+} kl_cache_t;
+
+#define KL_CACHE_EMPTY 0xFFFFFFFF /* key of an unfilled entry */
+
+/* source line of instructions ip onwards, up to the start of the next run */
+typedef struct kl_linerun {
+  uint32_t ip;
+  uint32_t line;
+} kl_linerun_t;
+
+/* allocated as a single block, cache entries, the (8-byte aligned) constant pool and then the line table
+ * follow the instructions.  the vm never reads the line table, it is there for errors and profiles */
 typedef struct kl_code {
-  int      n;
-  kl_ins_t ins[];
+  int             n;
+  int             nlocals; /* frame slots above vm->fp used by this code */
+  int             ncache;
+  int             nmagic;
+  int             nlines;
+  kl_cache_t     *cache;
+  kl_num_magic_t *magic;   /* divisors of DIVC, FDIVC and MODC */
+  kl_linerun_t   *lines;   /* by ip, one entry per run of instructions from the same line */
+  const char     *name;    /* of the script, from the lexer -- may be NULL */
+  kl_ins_t        ins[];
 } kl_code_t;
 
-kl_code_t* kl_compile(kl_lexer_t* source);
+/* local names bound to frame slots at compile time -- persists across statements so that later code
+ * sees earlier assignments */
+#define KL_SCOPE_MAXLOCALS 0x0100
+typedef struct kl_scope {
+  int      n;
+  uint32_t sym[KL_SCOPE_MAXLOCALS]; /* slot -> symbol */
+} kl_scope_t;
+
+#define KL_SCOPE_INITIALIZER \
+  { .n = 0 }
+
+kl_code_t* kl_compile(kl_lexer_t* source, kl_scope_t* scope);
+
+#if KL_COMPILER_STATS
+/* what compiling cost, the lexer's share included.  in the totals depth is the greatest of any
+ * compilation, everything else is summed */
+typedef struct kl_compiler_stats {
+  uint64_t statements;   /* compilations, failed ones included */
+  uint64_t errors;
+  uint64_t tokens;
+  uint64_t bytes;        /* characters consumed */
+  uint64_t instructions; /* emitted, including those folding took back */
+  uint64_t allocs;       /* heap allocations, the code block and the symbol interner's */
+  uint64_t allocbytes;
+  uint64_t lexns;        /* wall time in kl_lexer_next */
+  uint64_t compilens;    /* wall time in kl_compile less the above */
+  int      depth;        /* peak subexpression nesting */
+} kl_compiler_stats_t;
+
+const kl_compiler_stats_t* kl_compiler_stats_last(void);
+const kl_compiler_stats_t* kl_compiler_stats_total(void); /* since the last reset */
+void kl_compiler_stats_reset(void);
+#endif
 void kl_code_print(kl_code_t *code);
+int  kl_code_line(const kl_code_t *code, int ip); /* 0 if ip is out of range */
 
 #endif
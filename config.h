@@ -0,0 +1,12 @@
+#ifndef KL_CONFIG_H
+#define KL_CONFIG_H
+
+/* build options shared by several modules, each off unless set on the command line, e.g.
+ * -DKL_COMPILER_STATS=1.  options of a single module are defaulted in its own header, as vm.h does */
+
+/* lexer and compiler statistics, see kl_compiler_stats */
+#ifndef KL_COMPILER_STATS
+#define KL_COMPILER_STATS 0
+#endif
+
+#endif /* KL_CONFIG_H */
@@ -0,0 +1,1028 @@
+/* generated by tools/tablegen.c -- exp2 */
+/* base-2 exponent values for 0 <= x < 1, Q1.31 */
+static const uint32_t exp2_values[0x0400] = {
+  0x80000000,
+  0x8016302f,
+  0x802c6437,
+  0x80429c18,
+  0x8058d7d3,
+  0x806f1768,
+  0x80855ad9,
+  0x809ba226,
+  0x80b1ed50,
+  0x80c83c57,
+  0x80de8f3c,
+  0x80f4e5ff,
+  0x810b40a2,
+  0x81219f25,
+  0x81380188,
+  0x814e67cd,
+  0x8164d1f4,
+  0x817b3ffd,
+  0x8191b1ea,
+  0x81a827bb,
+  0x81bea171,
+  0x81d51f0c,
+  0x81eba08d,
+  0x820225f4,
+  0x8218af43,
+  0x822f3c7b,
+  0x8245cd9b,
+  0x825c62a4,
+  0x8272fb98,
+  0x82899876,
+  0x82a03940,
+  0x82b6ddf6,
+  0x82cd8699,
+  0x82e43329,
+  0x82fae3a8,
+  0x83119815,
+  0x83285072,
+  0x833f0cbf,
+  0x8355ccfd,
+  0x836c912d,
+  0x8383594f,
+  0x839a2564,
+  0x83b0f56d,
+  0x83c7c96a,
+  0x83dea15c,
+  0x83f57d43,
+  0x840c5d21,
+  0x842340f7,
+  0x843a28c4,
+  0x84511489,
+  0x84680448,
+  0x847ef800,
+  0x8495efb3,
+  0x84aceb61,
+  0x84c3eb0c,
+  0x84daeeb2,
+  0x84f1f656,
+  0x850901f8,
+  0x85201199,
+  0x85372539,
+  0x854e3cd9,
+  0x8565587a,
+  0x857c781c,
+  0x85939bc1,
+  0x85aac368,
+  0x85c1ef13,
+  0x85d91ec2,
+  0x85f05276,
+  0x86078a2f,
+  0x861ec5ef,
+  0x863605b6,
+  0x864d4985,
+  0x8664915c,
+  0x867bdd3c,
+  0x86932d26,
+  0x86aa811a,
+  0x86c1d91a,
+  0x86d93525,
+  0x86f0953e,
+  0x8707f963,
+  0x871f6197,
+  0x8736cdd9,
+  0x874e3e2b,
+  0x8765b28c,
+  0x877d2aff,
+  0x8794a783,
+  0x87ac281a,
+  0x87c3acc3,
+  0x87db3580,
+  0x87f2c251,
+  0x880a5338,
+  0x8821e834,
+  0x88398147,
+  0x88511e71,
+  0x8868bfb2,
+  0x8880650d,
+  0x88980e81,
+  0x88afbc0e,
+  0x88c76db7,
+  0x88df237b,
+  0x88f6dd5b,
+  0x890e9b58,
+  0x89265d73,
+  0x893e23ab,
+  0x8955ee03,
+  0x896dbc7b,
+  0x89858f13,
+  0x899d65cc,
+  0x89b540a8,
+  0x89cd1fa5,
+  0x89e502c6,
+  0x89fcea0b,
+  0x8a14d575,
+  0x8a2cc505,
+  0x8a44b8ba,
+  0x8a5cb096,
+  0x8a74ac9a,
+  0x8a8cacc7,
+  0x8aa4b11c,
+  0x8abcb99b,
+  0x8ad4c645,
+  0x8aecd71a,
+  0x8b04ec1b,
+  0x8b1d0549,
+  0x8b3522a4,
+  0x8b4d442d,
+  0x8b6569e5,
+  0x8b7d93cc,
+  0x8b95c1e4,
+  0x8badf42d,
+  0x8bc62aa7,
+  0x8bde6554,
+  0x8bf6a435,
+  0x8c0ee749,
+  0x8c272e92,
+  0x8c3f7a10,
+  0x8c57c9c4,
+  0x8c701db0,
+  0x8c8875d2,
+  0x8ca0d22e,
+  0x8cb932c2,
+  0x8cd19790,
+  0x8cea0098,
+  0x8d026ddc,
+  0x8d1adf5b,
+  0x8d335518,
+  0x8d4bcf12,
+  0x8d644d4a,
+  0x8d7ccfc1,
+  0x8d955677,
+  0x8dade16e,
+  0x8dc670a6,
+  0x8ddf0420,
+  0x8df79bdd,
+  0x8e1037dd,
+  0x8e28d820,
+  0x8e417ca9,
+  0x8e5a2578,
+  0x8e72d28c,
+  0x8e8b83e8,
+  0x8ea4398b,
+  0x8ebcf377,
+  0x8ed5b1ac,
+  0x8eee742c,
+  0x8f073af6,
+  0x8f20060b,
+  0x8f38d56d,
+  0x8f51a91b,
+  0x8f6a8118,
+  0x8f835d63,
+  0x8f9c3dfd,
+  0x8fb522e7,
+  0x8fce0c22,
+  0x8fe6f9ae,
+  0x8fffeb8d,
+  0x9018e1be,
+  0x9031dc43,
+  0x904adb1d,
+  0x9063de4b,
+  0x907ce5d0,
+  0x9095f1ac,
+  0x90af01df,
+  0x90c8166a,
+  0x90e12f4e,
+  0x90fa4c8c,
+  0x91136e24,
+  0x912c9418,
+  0x9145be67,
+  0x915eed14,
+  0x9178201e,
+  0x91915786,
+  0x91aa934d,
+  0x91c3d374,
+  0x91dd17fb,
+  0x91f660e4,
+  0x920fae2f,
+  0x9228ffdc,
+  0x924255ed,
+  0x925bb063,
+  0x92750f3d,
+  0x928e727e,
+  0x92a7da25,
+  0x92c14633,
+  0x92dab6aa,
+  0x92f42b89,
+  0x930da4d2,
+  0x93272286,
+  0x9340a4a4,
+  0x935a2b2f,
+  0x9373b627,
+  0x938d458b,
+  0x93a6d95f,
+  0x93c071a1,
+  0x93da0e53,
+  0x93f3af76,
+  0x940d550a,
+  0x9426ff10,
+  0x9440ad89,
+  0x945a6075,
+  0x947417d6,
+  0x948dd3ad,
+  0x94a793f9,
+  0x94c158bc,
+  0x94db21f6,
+  0x94f4efa9,
+  0x950ec1d5,
+  0x9528987b,
+  0x9542739b,
+  0x955c5337,
+  0x9576374e,
+  0x95901fe3,
+  0x95aa0cf6,
+  0x95c3fe87,
+  0x95ddf497,
+  0x95f7ef28,
+  0x9611ee39,
+  0x962bf1cc,
+  0x9645f9e1,
+  0x96600679,
+  0x967a1796,
+  0x96942d37,
+  0x96ae475e,
+  0x96c8660b,
+  0x96e2893f,
+  0x96fcb0fb,
+  0x9716dd40,
+  0x97310e0e,
+  0x974b4366,
+  0x97657d4a,
+  0x977fbbb9,
+  0x9799feb5,
+  0x97b4463e,
+  0x97ce9256,
+  0x97e8e2fc,
+  0x98033833,
+  0x981d91f9,
+  0x9837f052,
+  0x9852533c,
+  0x986cbab9,
+  0x988726ca,
+  0x98a1976f,
+  0x98bc0caa,
+  0x98d6867b,
+  0x98f104e3,
+  0x990b87e2,
+  0x99260f7a,
+  0x99409bac,
+  0x995b2c77,
+  0x9975c1dd,
+  0x99905bdf,
+  0x99aafa7e,
+  0x99c59db9,
+  0x99e04593,
+  0x99faf20c,
+  0x9a15a324,
+  0x9a3058dd,
+  0x9a4b1337,
+  0x9a65d233,
+  0x9a8095d2,
+  0x9a9b5e15,
+  0x9ab62afd,
+  0x9ad0fc89,
+  0x9aebd2bc,
+  0x9b06ad96,
+  0x9b218d17,
+  0x9b3c7141,
+  0x9b575a14,
+  0x9b724791,
+  0x9b8d39ba,
+  0x9ba8308e,
+  0x9bc32c0f,
+  0x9bde2c3d,
+  0x9bf93119,
+  0x9c143aa4,
+  0x9c2f48df,
+  0x9c4a5bcb,
+  0x9c657368,
+  0x9c808fb8,
+  0x9c9bb0ba,
+  0x9cb6d670,
+  0x9cd200dc,
+  0x9ced2ffc,
+  0x9d0863d3,
+  0x9d239c61,
+  0x9d3ed9a7,
+  0x9d5a1ba6,
+  0x9d75625e,
+  0x9d90add1,
+  0x9dabfdff,
+  0x9dc752ea,
+  0x9de2ac91,
+  0x9dfe0af5,
+  0x9e196e19,
+  0x9e34d5fb,
+  0x9e50429e,
+  0x9e6bb402,
+  0x9e872a27,
+  0x9ea2a510,
+  0x9ebe24bb,
+  0x9ed9a92b,
+  0x9ef53261,
+  0x9f10c05c,
+  0x9f2c531e,
+  0x9f47eaa7,
+  0x9f6386f9,
+  0x9f7f2814,
+  0x9f9acdf9,
+  0x9fb678a9,
+  0x9fd22825,
+  0x9feddc6e,
+  0xa0099584,
+  0xa0255368,
+  0xa041161b,
+  0xa05cdd9e,
+  0xa078a9f2,
+  0xa0947b18,
+  0xa0b05110,
+  0xa0cc2bdb,
+  0xa0e80b7a,
+  0xa103efee,
+  0xa11fd938,
+  0xa13bc759,
+  0xa157ba51,
+  0xa173b221,
+  0xa18faecb,
+  0xa1abb04e,
+  0xa1c7b6ac,
+  0xa1e3c1e6,
+  0xa1ffd1fc,
+  0xa21be6f0,
+  0xa23800c2,
+  0xa2541f72,
+  0xa2704303,
+  0xa28c6b74,
+  0xa2a898c7,
+  0xa2c4cafd,
+  0xa2e10215,
+  0xa2fd3e12,
+  0xa3197ef4,
+  0xa335c4bb,
+  0xa3520f69,
+  0xa36e5efe,
+  0xa38ab37c,
+  0xa3a70ce3,
+  0xa3c36b34,
+  0xa3dfce70,
+  0xa3fc3698,
+  0xa418a3ac,
+  0xa43515ae,
+  0xa4518c9e,
+  0xa46e087d,
+  0xa48a894d,
+  0xa4a70f0d,
+  0xa4c399be,
+  0xa4e02963,
+  0xa4fcbdfb,
+  0xa5195787,
+  0xa535f608,
+  0xa552997f,
+  0xa56f41ee,
+  0xa58bef53,
+  0xa5a8a1b2,
+  0xa5c5590a,
+  0xa5e2155c,
+  0xa5fed6aa,
+  0xa61b9cf3,
+  0xa638683a,
+  0xa655387e,
+  0xa6720dc1,
+  0xa68ee803,
+  0xa6abc746,
+  0xa6c8ab8a,
+  0xa6e594d0,
+  0xa7028319,
+  0xa71f7666,
+  0xa73c6eb8,
+  0xa7596c0f,
+  0xa7766e6c,
+  0xa79375d1,
+  0xa7b0823f,
+  0xa7cd93b5,
+  0xa7eaaa35,
+  0xa807c5c0,
+  0xa824e657,
+  0xa8420bfa,
+  0xa85f36ab,
+  0xa87c666a,
+  0xa8999b38,
+  0xa8b6d516,
+  0xa8d41406,
+  0xa8f15807,
+  0xa90ea11b,
+  0xa92bef42,
+  0xa949427e,
+  0xa9669acf,
+  0xa983f836,
+  0xa9a15ab5,
+  0xa9bec24b,
+  0xa9dc2efb,
+  0xa9f9a0c4,
+  0xaa1717a8,
+  0xaa3493a7,
+  0xaa5214c3,
+  0xaa6f9afc,
+  0xaa8d2653,
+  0xaaaab6c9,
+  0xaac84c5f,
+  0xaae5e716,
+  0xab0386ef,
+  0xab212beb,
+  0xab3ed60a,
+  0xab5c854d,
+  0xab7a39b6,
+  0xab97f345,
+  0xabb5b1fa,
+  0xabd375d8,
+  0xabf13edf,
+  0xac0f0d10,
+  0xac2ce06b,
+  0xac4ab8f2,
+  0xac6896a5,
+  0xac867985,
+  0xaca46194,
+  0xacc24ed2,
+  0xace04140,
+  0xacfe38df,
+  0xad1c35b0,
+  0xad3a37b3,
+  0xad583eea,
+  0xad764b56,
+  0xad945cf7,
+  0xadb273cf,
+  0xadd08fdd,
+  0xadeeb124,
+  0xae0cd7a4,
+  0xae2b035e,
+  0xae493453,
+  0xae676a83,
+  0xae85a5f1,
+  0xaea3e69b,
+  0xaec22c85,
+  0xaee077ae,
+  0xaefec817,
+  0xaf1d1dc1,
+  0xaf3b78ad,
+  0xaf59d8dd,
+  0xaf783e50,
+  0xaf96a909,
+  0xafb51907,
+  0xafd38e4c,
+  0xaff208d8,
+  0xb01088ad,
+  0xb02f0dcc,
+  0xb04d9835,
+  0xb06c27e9,
+  0xb08abce9,
+  0xb0a95736,
+  0xb0c7f6d2,
+  0xb0e69bbc,
+  0xb10545f7,
+  0xb123f582,
+  0xb142aa5f,
+  0xb161648e,
+  0xb1802411,
+  0xb19ee8e9,
+  0xb1bdb316,
+  0xb1dc8299,
+  0xb1fb5774,
+  0xb21a31a6,
+  0xb2391132,
+  0xb257f618,
+  0xb276e059,
+  0xb295cff6,
+  0xb2b4c4f0,
+  0xb2d3bf47,
+  0xb2f2befd,
+  0xb311c413,
+  0xb330ce89,
+  0xb34fde61,
+  0xb36ef39b,
+  0xb38e0e38,
+  0xb3ad2e3a,
+  0xb3cc53a1,
+  0xb3eb7e6e,
+  0xb40aaea2,
+  0xb429e43f,
+  0xb4491f44,
+  0xb4685fb3,
+  0xb487a58d,
+  0xb4a6f0d3,
+  0xb4c64185,
+  0xb4e597a5,
+  0xb504f334,
+  0xb5245432,
+  0xb543baa1,
+  0xb5632681,
+  0xb58297d4,
+  0xb5a20e9a,
+  0xb5c18ad4,
+  0xb5e10c83,
+  0xb60093a8,
+  0xb6202045,
+  0xb63fb25a,
+  0xb65f49e7,
+  0xb67ee6ef,
+  0xb69e8971,
+  0xb6be316f,
+  0xb6dddeea,
+  0xb6fd91e3,
+  0xb71d4a5b,
+  0xb73d0852,
+  0xb75ccbca,
+  0xb77c94c3,
+  0xb79c633f,
+  0xb7bc373e,
+  0xb7dc10c2,
+  0xb7fbefcb,
+  0xb81bd45a,
+  0xb83bbe71,
+  0xb85bae10,
+  0xb87ba338,
+  0xb89b9dea,
+  0xb8bb9e27,
+  0xb8dba3f1,
+  0xb8fbaf47,
+  0xb91bc02c,
+  0xb93bd69f,
+  0xb95bf2a3,
+  0xb97c1437,
+  0xb99c3b5e,
+  0xb9bc6817,
+  0xb9dc9a64,
+  0xb9fcd245,
+  0xba1d0fbd,
+  0xba3d52cb,
+  0xba5d9b70,
+  0xba7de9af,
+  0xba9e3d87,
+  0xbabe96f9,
+  0xbadef607,
+  0xbaff5ab2,
+  0xbb1fc4fa,
+  0xbb4034e1,
+  0xbb60aa67,
+  0xbb81258d,
+  0xbba1a655,
+  0xbbc22cbf,
+  0xbbe2b8cd,
+  0xbc034a7f,
+  0xbc23e1d6,
+  0xbc447ed4,
+  0xbc652178,
+  0xbc85c9c5,
+  0xbca677bc,
+  0xbcc72b5c,
+  0xbce7e4a8,
+  0xbd08a39f,
+  0xbd296844,
+  0xbd4a3297,
+  0xbd6b0299,
+  0xbd8bd84c,
+  0xbdacb3af,
+  0xbdcd94c4,
+  0xbdee7b8d,
+  0xbe0f680a,
+  0xbe305a3b,
+  0xbe515223,
+  0xbe724fc1,
+  0xbe935318,
+  0xbeb45c28,
+  0xbed56af1,
+  0xbef67f76,
+  0xbf1799b6,
+  0xbf38b9b4,
+  0xbf59df70,
+  0xbf7b0aea,
+  0xbf9c3c25,
+  0xbfbd7320,
+  0xbfdeafdd,
+  0xbffff25e,
+  0xc0213aa2,
+  0xc04288ab,
+  0xc063dc7a,
+  0xc0853610,
+  0xc0a6956f,
+  0xc0c7fa96,
+  0xc0e96587,
+  0xc10ad642,
+  0xc12c4cca,
+  0xc14dc91f,
+  0xc16f4b42,
+  0xc190d334,
+  0xc1b260f6,
+  0xc1d3f489,
+  0xc1f58ded,
+  0xc2172d25,
+  0xc238d231,
+  0xc25a7d12,
+  0xc27c2dc9,
+  0xc29de457,
+  0xc2bfa0bd,
+  0xc2e162fc,
+  0xc3032b15,
+  0xc324f90a,
+  0xc346ccda,
+  0xc368a688,
+  0xc38a8614,
+  0xc3ac6b7e,
+  0xc3ce56ca,
+  0xc3f047f6,
+  0xc4123f04,
+  0xc4343bf6,
+  0xc4563ecc,
+  0xc4784788,
+  0xc49a5629,
+  0xc4bc6ab2,
+  0xc4de8524,
+  0xc500a57f,
+  0xc522cbc4,
+  0xc544f7f4,
+  0xc5672a11,
+  0xc589621c,
+  0xc5aba015,
+  0xc5cde3fe,
+  0xc5f02dd7,
+  0xc6127da1,
+  0xc634d35f,
+  0xc6572f10,
+  0xc67990b6,
+  0xc69bf851,
+  0xc6be65e3,
+  0xc6e0d96d,
+  0xc70352f0,
+  0xc725d26d,
+  0xc74857e5,
+  0xc76ae358,
+  0xc78d74c9,
+  0xc7b00c37,
+  0xc7d2a9a5,
+  0xc7f54d12,
+  0xc817f681,
+  0xc83aa5f2,
+  0xc85d5b66,
+  0xc88016df,
+  0xc8a2d85d,
+  0xc8c59fe1,
+  0xc8e86d6c,
+  0xc90b4100,
+  0xc92e1a9d,
+  0xc950fa45,
+  0xc973dff9,
+  0xc996cbb9,
+  0xc9b9bd86,
+  0xc9dcb563,
+  0xc9ffb34f,
+  0xca22b74c,
+  0xca45c15b,
+  0xca68d17d,
+  0xca8be7b3,
+  0xcaaf03fd,
+  0xcad2265e,
+  0xcaf54ed6,
+  0xcb187d66,
+  0xcb3bb210,
+  0xcb5eecd4,
+  0xcb822db3,
+  0xcba574ae,
+  0xcbc8c1c7,
+  0xcbec14ff,
+  0xcc0f6e56,
+  0xcc32cdce,
+  0xcc563367,
+  0xcc799f24,
+  0xcc9d1104,
+  0xccc08909,
+  0xcce40734,
+  0xcd078b86,
+  0xcd2b1601,
+  0xcd4ea6a4,
+  0xcd723d72,
+  0xcd95da6b,
+  0xcdb97d90,
+  0xcddd26e3,
+  0xce00d664,
+  0xce248c15,
+  0xce4847f7,
+  0xce6c0a0a,
+  0xce8fd250,
+  0xceb3a0ca,
+  0xced77579,
+  0xcefb505e,
+  0xcf1f317b,
+  0xcf4318cf,
+  0xcf67065d,
+  0xcf8afa25,
+  0xcfaef428,
+  0xcfd2f468,
+  0xcff6fae6,
+  0xd01b07a2,
+  0xd03f1a9e,
+  0xd06333db,
+  0xd087535a,
+  0xd0ab791c,
+  0xd0cfa521,
+  0xd0f3d76c,
+  0xd1180ffe,
+  0xd13c4ed6,
+  0xd16093f8,
+  0xd184df62,
+  0xd1a93118,
+  0xd1cd8919,
+  0xd1f1e766,
+  0xd2164c02,
+  0xd23ab6ed,
+  0xd25f2828,
+  0xd2839fb4,
+  0xd2a81d92,
+  0xd2cca1c4,
+  0xd2f12c4a,
+  0xd315bd25,
+  0xd33a5458,
+  0xd35ef1e2,
+  0xd38395c5,
+  0xd3a84002,
+  0xd3ccf09a,
+  0xd3f1a78e,
+  0xd41664df,
+  0xd43b288f,
+  0xd45ff29e,
+  0xd484c30e,
+  0xd4a999df,
+  0xd4ce7714,
+  0xd4f35aac,
+  0xd51844a9,
+  0xd53d350c,
+  0xd5622bd7,
+  0xd587290a,
+  0xd5ac2ca6,
+  0xd5d136ad,
+  0xd5f6471f,
+  0xd61b5dff,
+  0xd6407b4c,
+  0xd6659f08,
+  0xd68ac934,
+  0xd6aff9d2,
+  0xd6d530e2,
+  0xd6fa6e65,
+  0xd71fb25d,
+  0xd744fccb,
+  0xd76a4daf,
+  0xd78fa50c,
+  0xd7b502e1,
+  0xd7da6731,
+  0xd7ffd1fc,
+  0xd8254344,
+  0xd84abb09,
+  0xd870394c,
+  0xd895be10,
+  0xd8bb4954,
+  0xd8e0db1b,
+  0xd9067365,
+  0xd92c1233,
+  0xd951b786,
+  0xd9776361,
+  0xd99d15c2,
+  0xd9c2cead,
+  0xd9e88e22,
+  0xda0e5422,
+  0xda3420ae,
+  0xda59f3c7,
+  0xda7fcd6f,
+  0xdaa5ada7,
+  0xdacb946f,
+  0xdaf181ca,
+  0xdb1775b7,
+  0xdb3d7039,
+  0xdb637150,
+  0xdb8978fd,
+  0xdbaf8742,
+  0xdbd59c20,
+  0xdbfbb798,
+  0xdc21d9ab,
+  0xdc48025a,
+  0xdc6e31a6,
+  0xdc946791,
+  0xdcbaa41c,
+  0xdce0e747,
+  0xdd073115,
+  0xdd2d8185,
+  0xdd53d89a,
+  0xdd7a3654,
+  0xdda09ab4,
+  0xddc705bd,
+  0xdded776e,
+  0xde13efc9,
+  0xde3a6ed0,
+  0xde60f482,
+  0xde8780e3,
+  0xdeae13f1,
+  0xded4adb0,
+  0xdefb4e20,
+  0xdf21f541,
+  0xdf48a316,
+  0xdf6f57a0,
+  0xdf9612df,
+  0xdfbcd4d5,
+  0xdfe39d82,
+  0xe00a6ce9,
+  0xe031430a,
+  0xe0581fe7,
+  0xe07f0380,
+  0xe0a5edd6,
+  0xe0ccdeec,
+  0xe0f3d6c2,
+  0xe11ad559,
+  0xe141dab3,
+  0xe168e6d0,
+  0xe18ff9b2,
+  0xe1b7135a,
+  0xe1de33c9,
+  0xe2055b00,
+  0xe22c8901,
+  0xe253bdcc,
+  0xe27af964,
+  0xe2a23bc8,
+  0xe2c984fa,
+  0xe2f0d4fc,
+  0xe3182bcf,
+  0xe33f8973,
+  0xe366edea,
+  0xe38e5935,
+  0xe3b5cb55,
+  0xe3dd444c,
+  0xe404c41b,
+  0xe42c4ac2,
+  0xe453d844,
+  0xe47b6ca0,
+  0xe4a307d9,
+  0xe4caa9f0,
+  0xe4f252e5,
+  0xe51a02bb,
+  0xe541b971,
+  0xe569770a,
+  0xe5913b86,
+  0xe5b906e7,
+  0xe5e0d92f,
+  0xe608b25d,
+  0xe6309273,
+  0xe6587973,
+  0xe680675e,
+  0xe6a85c35,
+  0xe6d057f9,
+  0xe6f85aab,
+  0xe720644d,
+  0xe74874df,
+  0xe7708c63,
+  0xe798aadb,
+  0xe7c0d047,
+  0xe7e8fca8,
+  0xe8113000,
+  0xe8396a50,
+  0xe861ab99,
+  0xe889f3dd,
+  0xe8b2431c,
+  0xe8da9958,
+  0xe902f692,
+  0xe92b5acb,
+  0xe953c605,
+  0xe97c3840,
+  0xe9a4b17f,
+  0xe9cd31c1,
+  0xe9f5b908,
+  0xea1e4756,
+  0xea46dcac,
+  0xea6f790b,
+  0xea981c74,
+  0xeac0c6e8,
+  0xeae97869,
+  0xeb1230f7,
+  0xeb3af095,
+  0xeb63b743,
+  0xeb8c8503,
+  0xebb559d5,
+  0xebde35bb,
+  0xec0718b6,
+  0xec3002c8,
+  0xec58f3f1,
+  0xec81ec34,
+  0xecaaeb90,
+  0xecd3f208,
+  0xecfcff9c,
+  0xed26144e,
+  0xed4f301f,
+  0xed785310,
+  0xeda17d23,
+  0xedcaae58,
+  0xedf3e6b2,
+  0xee1d2630,
+  0xee466cd6,
+  0xee6fbaa2,
+  0xee990f98,
+  0xeec26bb8,
+  0xeeebcf03,
+  0xef15397b,
+  0xef3eab21,
+  0xef6823f6,
+  0xef91a3fb,
+  0xefbb2b32,
+  0xefe4b99c,
+  0xf00e4f3a,
+  0xf037ec0d,
+  0xf0619017,
+  0xf08b3b59,
+  0xf0b4edd4,
+  0xf0dea789,
+  0xf108687a,
+  0xf13230a8,
+  0xf15c0014,
+  0xf185d6bf,
+  0xf1afb4ab,
+  0xf1d999d9,
+  0xf203864a,
+  0xf22d79ff,
+  0xf25774fa,
+  0xf281773c,
+  0xf2ab80c7,
+  0xf2d5919a,
+  0xf2ffa9b9,
+  0xf329c923,
+  0xf353efdb,
+  0xf37e1de1,
+  0xf3a85337,
+  0xf3d28fde,
+  0xf3fcd3d8,
+  0xf4271f25,
+  0xf45171c6,
+  0xf47bcbbe,
+  0xf4a62d0e,
+  0xf4d095b6,
+  0xf4fb05b8,
+  0xf5257d15,
+  0xf54ffbcf,
+  0xf57a81e6,
+  0xf5a50f5d,
+  0xf5cfa434,
+  0xf5fa406c,
+  0xf624e408,
+  0xf64f8f07,
+  0xf67a416c,
+  0xf6a4fb38,
+  0xf6cfbc6c,
+  0xf6fa8509,
+  0xf7255511,
+  0xf7502c84,
+  0xf77b0b65,
+  0xf7a5f1b4,
+  0xf7d0df73,
+  0xf7fbd4a3,
+  0xf826d145,
+  0xf851d55b,
+  0xf87ce0e6,
+  0xf8a7f3e7,
+  0xf8d30e5f,
+  0xf8fe3050,
+  0xf92959bb,
+  0xf9548aa2,
+  0xf97fc305,
+  0xf9ab02e6,
+  0xf9d64a47,
+  0xfa019928,
+  0xfa2cef8b,
+  0xfa584d71,
+  0xfa83b2db,
+  0xfaaf1fcc,
+  0xfada9443,
+  0xfb061043,
+  0xfb3193cc,
+  0xfb5d1ee1,
+  0xfb88b181,
+  0xfbb44bb0,
+  0xfbdfed6d,
+  0xfc0b96ba,
+  0xfc374799,
+  0xfc63000b,
+  0xfc8ec011,
+  0xfcba87ad,
+  0xfce656df,
+  0xfd122da9,
+  0xfd3e0c0d,
+  0xfd69f20b,
+  0xfd95dfa6,
+  0xfdc1d4de,
+  0xfdedd1b5,
+  0xfe19d62b,
+  0xfe45e243,
+  0xfe71f5fe,
+  0xfe9e115c,
+  0xfeca3460,
+  0xfef65f0b,
+  0xff22915e,
+  0xff4ecb59,
+  0xff7b0d00,
+  0xffa75652,
+  0xffd3a752,
+};
@@ -0,0 +1,86 @@
+#include "globals.h"
+
+#include "symbol.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define KL_GLOBALS_MINSIZE 0x0040
+
+/* shared by all tables so that a cache resolved against one table never validates against another */
+static uint32_t epoch = 0;
+
+static inline uint32_t hash(uint32_t sym) {
+  return sym * 0x9E3779B1; /* symbol ids are dense, scatter them */
+}
+
+static void rehash(kl_globals_t *g, uint32_t size) {
+  free(g->bucket);
+  g->bucket = malloc(size * sizeof(kl_globals_bucket_t));
+  g->mask   = size - 1;
+  memset(g->bucket, 0xFF, size * sizeof(kl_globals_bucket_t));
+
+  for (uint32_t slot=0; slot < g->n; slot++) {
+    uint32_t i = hash(g->sym[slot]) & g->mask;
+    while (g->bucket[i].sym != KL_SYMBOL_NONE) i = (i + 1) & g->mask;
+    g->bucket[i] = (kl_globals_bucket_t){ .sym = g->sym[slot], .slot = slot };
+  }
+}
+
+uint32_t kl_globals_find(kl_globals_t *g, uint32_t sym) {
+  if (g->bucket == NULL) return KL_GLOBALS_NOSLOT;
+
+  uint32_t i = hash(sym) & g->mask;
+  for (;;) {
+    kl_globals_bucket_t *b = &g->bucket[i];
+    if (b->sym == sym) return b->slot;
+    if (b->sym == KL_SYMBOL_NONE) return KL_GLOBALS_NOSLOT;
+    i = (i + 1) & g->mask;
+  }
+}
+
+uint32_t kl_globals_slot(kl_globals_t *g, uint32_t sym) {
+  uint32_t slot = kl_globals_find(g, sym);
+  if (slot != KL_GLOBALS_NOSLOT) return slot;
+
+  if (g->bucket == NULL) {
+    g->version = ++epoch;
+    rehash(g, KL_GLOBALS_MINSIZE);
+  }
+
+  if (g->n == g->cap) {
+    g->cap = g->cap ? g->cap * 2 : KL_GLOBALS_MINSIZE;
+    g->sym = realloc(g->sym, g->cap * sizeof(uint32_t));
+    g->val = realloc(g->val, g->cap * sizeof(kl_valref_t));
+  }
+
+  slot = g->n++;
+  g->sym[slot] = sym;
+  g->val[slot] = (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+
+  /* keep the load factor at or below one half */
+  if (g->n * 2 > g->mask + 1) {
+    rehash(g, (g->mask + 1) * 2);
+  } else {
+    uint32_t i = hash(sym) & g->mask;
+    while (g->bucket[i].sym != KL_SYMBOL_NONE) i = (i + 1) & g->mask;
+    g->bucket[i] = (kl_globals_bucket_t){ .sym = sym, .slot = slot };
+  }
+
+  return slot;
+}
+
+void kl_globals_clear(kl_globals_t *g) {
+  if (g->bucket == NULL) return;
+  g->n       = 0;
+  g->version = ++epoch; /* every cached slot is stale now */
+  memset(g->bucket, 0xFF, (g->mask + 1) * sizeof(kl_globals_bucket_t));
+}
+
+void kl_globals_free(kl_globals_t *g) {
+  free(g->bucket);
+  free(g->sym);
+  free(g->val);
+  memset(g, 0, sizeof(kl_globals_t));
+  g->version = ++epoch;
+}
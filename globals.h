@@ -0,0 +1,55 @@
+#ifndef KL_GLOBALS_H
+#define KL_GLOBALS_H
+
+#include "compiler.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* global namespace keyed by interned symbol.  every global owns a dense slot which stays put until the
+ * table is cleared, so code and hosts may cache slot indices.  a cached slot is valid as long as the
+ * table's version matches the version it was resolved under -- versions are unique across all tables */
+
+#define KL_GLOBALS_NOSLOT    0xFFFFFFFF
+#define KL_GLOBALS_NOVERSION KL_CACHE_EMPTY /* never assigned to a table */
+
+typedef struct kl_globals_bucket {
+  uint32_t sym;
+  uint32_t slot;
+} kl_globals_bucket_t;
+
+typedef struct kl_globals {
+  uint32_t             version;
+  uint32_t             mask;   /* bucket count - 1 */
+  kl_globals_bucket_t *bucket; /* open addressing, linear probing */
+  uint32_t             n;      /* slots in use */
+  uint32_t             cap;
+  uint32_t            *sym;    /* slot -> symbol */
+  kl_valref_t         *val;    /* slot -> value */
+} kl_globals_t;
+
+#define KL_GLOBALS_INITIALIZER \
+  { .version = 0, .bucket = NULL }
+
+uint32_t kl_globals_find(kl_globals_t *g, uint32_t sym); /* KL_GLOBALS_NOSLOT if undefined */
+uint32_t kl_globals_slot(kl_globals_t *g, uint32_t sym); /* defines the global as zero if needed */
+void     kl_globals_clear(kl_globals_t *g);
+void     kl_globals_free(kl_globals_t *g);
+
+/* the returned pointer is invalidated when a new global is defined, the slot index is not */
+static inline kl_valref_t* kl_globals_ref(kl_globals_t *g, uint32_t slot) {
+  return &g->val[slot];
+}
+
+static inline kl_valref_t kl_globals_get(kl_globals_t *g, uint32_t sym) {
+  uint32_t slot = kl_globals_find(g, sym);
+  if (slot == KL_GLOBALS_NOSLOT) return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+  return g->val[slot];
+}
+
+static inline void kl_globals_set(kl_globals_t *g, uint32_t sym, kl_valref_t val) {
+  uint32_t slot = kl_globals_slot(g, sym); /* may grow g->val */
+  g->val[slot] = val;
+}
+
+#endif /* KL_GLOBALS_H */
@@ -0,0 +1,262 @@
+#include "heap.h"
+
+#include "shape.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KL_HEAP_ALIGN 64
+
+static void shade(kl_heap_t *heap, uint32_t handle);
+static inline void shade_value(kl_heap_t *heap, kl_valref_t val);
+
+/* bytes of marking work charged for tracing an object's children */
+static size_t trace(kl_heap_t *heap, kl_object_t *obj) {
+  switch (obj->type) {
+    case KL_OBJ_INST: {
+      kl_obj_inst_t *inst = (kl_obj_inst_t*)obj;
+      for (int i=0; i < inst->n; i++) {
+        if (inst->field[i].ns != KL_NS_IMMEDIATE) shade_value(heap, inst->field[i]);
+      }
+      return inst->n * sizeof(kl_valref_t);
+    }
+    case KL_OBJ_NUM:
+    case KL_OBJ_ARRAY:
+    default:
+      return 0;
+  }
+}
+
+/* releases resources owned by an object that is about to be reclaimed */
+static void finalize(kl_heap_t *heap, kl_object_t *obj) {
+  (void)heap;
+  switch (obj->type) {
+    case KL_OBJ_NUM:
+    default:
+      break;
+  }
+}
+
+void kl_heap_init(kl_heap_t *heap) {
+  *heap = (kl_heap_t)KL_HEAP_INITIALIZER;
+}
+
+void kl_heap_free(kl_heap_t *heap) {
+  for (uint32_t id=0; id < heap->nblocks; id++) {
+    kl_heap_block_t *b = heap->blocks[id];
+    if (b == NULL) continue;
+    for (int i=0; i < b->used; i++) {
+      kl_object_t *obj = (kl_object_t*)(b->cells + (size_t)i * b->size);
+      if (obj->gc != KL_GC_FREE && obj->gc != KL_GC_DEAD) finalize(heap, obj);
+    }
+    free(b->cells);
+    free(b);
+  }
+  free(heap->blocks);
+  free(heap->freeblocks);
+  free(heap->handles);
+  free(heap->gray);
+  kl_heap_init(heap);
+}
+
+static kl_heap_block_t* newblock(kl_heap_t *heap, int cls, size_t size, int ncells) {
+  uint32_t id;
+  if (heap->nfreeblocks > 0) {
+    id = heap->freeblocks[--heap->nfreeblocks];
+  } else {
+    if (heap->nblocks == heap->capblocks) {
+      heap->capblocks  = heap->capblocks ? heap->capblocks * 2 : 0x40;
+      heap->blocks     = realloc(heap->blocks, heap->capblocks * sizeof(kl_heap_block_t*));
+      heap->freeblocks = realloc(heap->freeblocks, heap->capblocks * sizeof(uint32_t));
+    }
+    id = heap->nblocks++;
+  }
+  assert(id < (1u << (32 - KL_HEAP_CELLBITS)));
+
+  kl_heap_block_t *b = malloc(sizeof(kl_heap_block_t));
+  b->id     = id;
+  b->cls    = cls;
+  b->size   = size;
+  b->ncells = ncells;
+  b->used   = 0;
+  if (posix_memalign((void**)&b->cells, KL_HEAP_ALIGN, size * ncells) != 0) abort();
+
+  heap->blocks[id] = b;
+  return b;
+}
+
+kl_object_t* kl_heap_cellalloc_slow(kl_heap_t *heap, size_t size) {
+  int c = kl_heap_class(size);
+
+  kl_heap_block_t *b;
+  if (c >= KL_HEAP_NCLASSES) {
+    b = newblock(heap, KL_HEAP_NCLASSES, (size + KL_HEAP_ALIGN - 1) & ~(size_t)(KL_HEAP_ALIGN - 1), 1);
+  } else {
+    size_t cell = (size_t)KL_HEAP_MINCELL << c;
+    b = newblock(heap, c, cell, KL_HEAP_BLOCKSIZE / cell);
+    heap->cls[c].block = b;
+  }
+
+  heap->live += b->size;
+  heap->debt += b->size;
+
+  return (kl_object_t*)(b->cells + (size_t)b->used++ * b->size);
+}
+
+uint32_t kl_heap_handle_slow(kl_heap_t *heap) {
+  if (heap->nhandles == heap->caphandles) {
+    heap->caphandles = heap->caphandles ? heap->caphandles * 2 : 0x100;
+    heap->handles    = realloc(heap->handles, heap->caphandles * sizeof(kl_handle_t));
+  }
+  uint32_t handle = heap->nhandles++;
+  heap->handles[handle].gen = 0;
+  return handle;
+}
+
+/* invalidates every reference to the handle and queues it for reuse */
+static void retire(kl_heap_t *heap, uint32_t handle) {
+  kl_handle_t *h = &heap->handles[handle];
+  h->obj  = NULL;
+  h->gen  = h->gen + 1 == KL_NS_IMMEDIATE ? 0 : h->gen + 1;
+  h->next = heap->freehandle;
+  heap->freehandle = handle + 1;
+}
+
+kl_object_t* kl_heap_resize(kl_heap_t *heap, kl_valref_t ref, size_t oldsize, size_t size) {
+  kl_object_t *old = kl_heap_deref(heap, ref);
+  assert(old != NULL);
+
+  /* the copy keeps the mark, so it is traced exactly when the original would have been */
+  kl_object_t *obj = kl_heap_cellalloc(heap, size);
+  memcpy(obj, old, oldsize < size ? oldsize : size);
+  heap->handles[ref.val.ref].obj = obj;
+
+  old->gc = KL_GC_DEAD;
+  return obj;
+}
+
+static void shade(kl_heap_t *heap, uint32_t handle) {
+  kl_object_t *obj = heap->handles[handle].obj;
+  if (obj->gc == heap->mark) return;
+  obj->gc = heap->mark;
+
+  if (heap->ngray == heap->capgray) {
+    heap->capgray = heap->capgray ? heap->capgray * 2 : 0x100;
+    heap->gray    = realloc(heap->gray, heap->capgray * sizeof(uint32_t));
+  }
+  heap->gray[heap->ngray++] = handle;
+}
+
+static inline void shade_value(kl_heap_t *heap, kl_valref_t val) {
+  kl_object_t *obj = kl_heap_deref(heap, val);
+  if (obj != NULL) shade(heap, obj->handle);
+}
+
+void kl_heap_shade(kl_heap_t *heap, kl_valref_t val) {
+  if (heap->phase == KL_GC_MARK) shade_value(heap, val);
+}
+
+/* shades without tracing, returns the work charged for it */
+static size_t mark_roots(kl_heap_t *heap, kl_heap_roots_t *roots, int nroots) {
+  size_t work = 0;
+  for (int i=0; i < nroots; i++) {
+    for (int j=0; j < roots[i].n; j++) {
+      if (roots[i].val[j].ns != KL_NS_IMMEDIATE) shade_value(heap, roots[i].val[j]);
+    }
+    work += roots[i].n * sizeof(kl_valref_t);
+  }
+  return work;
+}
+
+static size_t propagate(kl_heap_t *heap) {
+  uint32_t handle = heap->gray[--heap->ngray];
+  return KL_HEAP_MINCELL + trace(heap, heap->handles[handle].obj);
+}
+
+/* returns a cell to its free list, retiring its handle unless the object moved elsewhere */
+static void reclaim(kl_heap_t *heap, kl_heap_block_t *b, int i, kl_object_t *obj) {
+  if (obj->gc != KL_GC_DEAD) {
+    finalize(heap, obj);
+    retire(heap, obj->handle);
+  }
+  heap->live -= b->size;
+
+  if (b->cls == KL_HEAP_NCLASSES) {
+    heap->blocks[b->id] = NULL;
+    heap->freeblocks[heap->nfreeblocks++] = b->id;
+    free(b->cells);
+    free(b);
+    return;
+  }
+
+  kl_heap_class_t *k = &heap->cls[b->cls];
+  obj->gc = KL_GC_FREE;
+  ((kl_heap_free_t*)obj)->next = k->free;
+  k->free = ((b->id << KL_HEAP_CELLBITS) | i) + 1;
+}
+
+static size_t sweep(kl_heap_t *heap, uint32_t id) {
+  kl_heap_block_t *b = heap->blocks[id];
+  if (b == NULL) return 0;
+
+  size_t work = (size_t)b->used * (b->cls == KL_HEAP_NCLASSES ? KL_HEAP_MINCELL : b->size);
+  for (int i=0, n=b->used; i < n; i++) {
+    kl_object_t *obj = (kl_object_t*)(b->cells + (size_t)i * b->size);
+    if (obj->gc == KL_GC_FREE || obj->gc == heap->mark) continue;
+    reclaim(heap, b, i, obj);
+  }
+  return work;
+}
+
+static size_t start(kl_heap_t *heap, kl_heap_roots_t *roots, int nroots) {
+  heap->mark ^= 1; /* everything reached in the last cycle is unmarked again */
+  heap->phase = KL_GC_MARK;
+  return mark_roots(heap, roots, nroots);
+}
+
+int kl_heap_step(kl_heap_t *heap, kl_heap_roots_t *roots, int nroots) {
+  size_t work = 0;
+  heap->debt  = 0;
+
+  switch (heap->phase) {
+    case KL_GC_IDLE:
+      if (heap->live >= heap->threshold) work += start(heap, roots, nroots);
+      break;
+
+    case KL_GC_MARK:
+      while (heap->ngray > 0 && work < heap->stepsize) work += propagate(heap);
+      if (heap->ngray > 0 || work >= heap->stepsize) break;
+
+      /* roots were mutated without barriers and may hold objects marking has not reached.  they are
+       * rescanned once nothing is gray, and what that shades is traced by the following steps like
+       * everything else.  objects never turn white again within a cycle, so a rescan eventually finds
+       * nothing new, and marking is complete */
+      work += mark_roots(heap, roots, nroots);
+      if (heap->ngray > 0) break;
+
+      heap->phase = KL_GC_SWEEP;
+      heap->sweep = 0;
+      break;
+
+    case KL_GC_SWEEP:
+      while (heap->sweep < heap->nblocks && work < heap->stepsize) work += sweep(heap, heap->sweep++);
+      if (heap->sweep < heap->nblocks) break;
+
+      heap->threshold = heap->live + heap->live / 100 * heap->pause;
+      if (heap->threshold < KL_HEAP_MINTHRESHOLD) heap->threshold = KL_HEAP_MINTHRESHOLD;
+      heap->phase = KL_GC_IDLE;
+      break;
+  }
+  heap->work = work;
+  return heap->phase;
+}
+
+void kl_heap_collect(kl_heap_t *heap, kl_heap_roots_t *roots, int nroots) {
+  /* a cycle already in progress is finished first, it may have missed garbage created since it began */
+  if (heap->phase != KL_GC_IDLE) {
+    while (kl_heap_step(heap, roots, nroots) != KL_GC_IDLE);
+  }
+  start(heap, roots, nroots);
+  while (kl_heap_step(heap, roots, nroots) != KL_GC_IDLE);
+}
@@ -0,0 +1,187 @@
+#ifndef KL_HEAP_H
+#define KL_HEAP_H
+
+#include "object.h"
+#include "compiler.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* object heap -- small objects are bump-allocated from per-size-class blocks and recycled through free
+ * lists, large objects get a block of their own.  internally a cell is named by its block index shifted
+ * left by KL_HEAP_CELLBITS plus its index within the block.
+ *
+ * values never hold cells directly.  a reference is a kl_valref_t whose val.ref indexes the handle
+ * table and whose ns is the generation the handle had when the object was allocated.  handles are
+ * retired by bumping their generation, so a stale reference fails one compare.  objects can move
+ * between cells (see kl_heap_resize) without rewriting any reference to them.
+ *
+ * collection is incremental mark-sweep.  kl_object_t.gc holds the mark of the cycle the object was last
+ * reached in, alternating between 0 and 1, so survivors never need their marks cleared.  each step does
+ * about stepsize bytes of marking or sweeping, so pauses are bounded by the tuning rather than by the
+ * heap size.  roots have no write barrier and are shaded in a single pass, at the start of a cycle and
+ * each time the gray list runs dry, which adds the size of the roots but never traces from them within
+ * the step.  a new cycle begins once live bytes have grown by pause percent since the last one. */
+
+#define KL_HEAP_CELLBITS  12
+#define KL_HEAP_CELLMASK  ((1 << KL_HEAP_CELLBITS) - 1)
+#define KL_HEAP_BLOCKSIZE 0x00010000 /* bytes of cells in a small-object block */
+#define KL_HEAP_NCLASSES  6          /* 16, 32, ..., 512 bytes */
+#define KL_HEAP_MINCELL   16
+
+#define KL_HEAP_STEPSIZE     0x00004000 /* default work per step, in bytes */
+#define KL_HEAP_PAUSE        100        /* default growth before the next cycle, in percent */
+#define KL_HEAP_MINTHRESHOLD 0x00040000 /* never start cycles below this many live bytes */
+
+#define KL_GC_FREE -1 /* kl_object_t.gc of a cell on a free list */
+#define KL_GC_DEAD -2 /* kl_object_t.gc of a cell abandoned by kl_heap_resize, reclaimed by the next sweep */
+
+#define KL_GC_IDLE  0
+#define KL_GC_MARK  1
+#define KL_GC_SWEEP 2
+
+typedef struct kl_heap_block {
+  uint32_t id;
+  int      cls;    /* size class, KL_HEAP_NCLASSES for a large object */
+  size_t   size;   /* cell size */
+  int      ncells;
+  int      used;   /* cells handed out by the bump pointer */
+  char    *cells;
+} kl_heap_block_t;
+
+typedef struct kl_heap_class {
+  uint32_t         free;  /* cell + 1 of the first free cell, zero if the list is empty */
+  kl_heap_block_t *block; /* block being bump-allocated from */
+} kl_heap_class_t;
+
+/* a free cell links to the next one by cell + 1 */
+typedef struct kl_heap_free {
+  kl_object_t obj;
+  uint32_t    next;
+} kl_heap_free_t;
+
+typedef struct kl_handle {
+  kl_object_t *obj;
+  uint32_t     gen;
+  uint32_t     next; /* handle + 1 of the next retired handle */
+} kl_handle_t;
+
+/* a run of values the collector treats as roots */
+typedef struct kl_heap_roots {
+  kl_valref_t *val;
+  int          n;
+} kl_heap_roots_t;
+
+typedef struct kl_heap {
+  int    phase;
+  int    mark;      /* gc value of objects reached in the current cycle */
+  size_t stepsize;  /* tuning */
+  int    pause;
+
+  size_t    live;      /* bytes in use */
+  size_t    threshold; /* start the next cycle at this many live bytes */
+  ptrdiff_t debt;      /* bytes allocated since the last step */
+  size_t    work;      /* done by the last step, in bytes */
+
+  kl_heap_class_t   cls[KL_HEAP_NCLASSES];
+  kl_heap_block_t **blocks;
+  uint32_t          nblocks;
+  uint32_t          capblocks;
+  uint32_t         *freeblocks; /* ids of released large-object blocks */
+  uint32_t          nfreeblocks;
+
+  kl_handle_t *handles;
+  uint32_t     nhandles;
+  uint32_t     caphandles;
+  uint32_t     freehandle; /* handle + 1 of the first retired handle, zero if none */
+
+  uint32_t *gray;  /* handles reached but not yet traced */
+  uint32_t  ngray;
+  uint32_t  capgray;
+  uint32_t  sweep; /* next block to sweep */
+} kl_heap_t;
+
+#define KL_HEAP_INITIALIZER \
+  { .phase = KL_GC_IDLE, .mark = 0, .stepsize = KL_HEAP_STEPSIZE, .pause = KL_HEAP_PAUSE, \
+    .threshold = KL_HEAP_MINTHRESHOLD }
+
+void kl_heap_init(kl_heap_t *heap);
+void kl_heap_free(kl_heap_t *heap);
+
+kl_object_t* kl_heap_cellalloc_slow(kl_heap_t *heap, size_t size);
+uint32_t     kl_heap_handle_slow(kl_heap_t *heap);
+
+/* moves an object into a cell of a different size, preserving min(old, new) bytes -- references to it
+ * stay valid, pointers to the old cell do not */
+kl_object_t* kl_heap_resize(kl_heap_t *heap, kl_valref_t ref, size_t oldsize, size_t size);
+
+/* performs one bounded unit of collection work, returns the phase the collector is left in */
+int  kl_heap_step(kl_heap_t *heap, kl_heap_roots_t *roots, int nroots);
+void kl_heap_collect(kl_heap_t *heap, kl_heap_roots_t *roots, int nroots); /* complete a full cycle */
+
+/* shades a value stored into a heap object, required while marking so that the store is not missed */
+void kl_heap_shade(kl_heap_t *heap, kl_valref_t val);
+
+/* NULL for immediates and stale references */
+static inline kl_object_t* kl_heap_deref(kl_heap_t *heap, kl_valref_t ref) {
+  if (ref.val.ref >= heap->nhandles) return NULL;
+  kl_handle_t *h = &heap->handles[ref.val.ref];
+  return h->gen == ref.ns ? h->obj : NULL;
+}
+
+static inline int kl_heap_class(size_t size) {
+  if (size <= KL_HEAP_MINCELL) return 0;
+  return (int)(sizeof(unsigned long) * 8) - __builtin_clzl((unsigned long)(size - 1)) - 4;
+}
+
+static inline kl_object_t* kl_heap_cell(kl_heap_t *heap, uint32_t cell) {
+  kl_heap_block_t *b = heap->blocks[cell >> KL_HEAP_CELLBITS];
+  return (kl_object_t*)(b->cells + (size_t)(cell & KL_HEAP_CELLMASK) * b->size);
+}
+
+/* the common case pops a free list or bumps a pointer -- collection work is left to the caller, see
+ * kl_vm_alloc */
+static inline kl_object_t* kl_heap_cellalloc(kl_heap_t *heap, size_t size) {
+  int c = kl_heap_class(size);
+  if (c >= KL_HEAP_NCLASSES) return kl_heap_cellalloc_slow(heap, size);
+
+  kl_heap_class_t *k = &heap->cls[c];
+  kl_object_t     *obj;
+  if (k->free) {
+    obj     = kl_heap_cell(heap, k->free - 1);
+    k->free = ((kl_heap_free_t*)obj)->next;
+  } else if (k->block != NULL && k->block->used < k->block->ncells) {
+    kl_heap_block_t *b = k->block;
+    obj = (kl_object_t*)(b->cells + (size_t)b->used++ * b->size);
+  } else {
+    return kl_heap_cellalloc_slow(heap, size);
+  }
+
+  size_t bytes = (size_t)KL_HEAP_MINCELL << c;
+  heap->live += bytes;
+  heap->debt += bytes;
+  return obj;
+}
+
+static inline kl_object_t* kl_heap_alloc(kl_heap_t *heap, int type, size_t size, kl_valref_t *ref) {
+  kl_object_t *obj = kl_heap_cellalloc(heap, size);
+
+  uint32_t handle;
+  if (heap->freehandle) {
+    handle = heap->freehandle - 1;
+    heap->freehandle = heap->handles[handle].next;
+  } else {
+    handle = kl_heap_handle_slow(heap);
+  }
+  heap->handles[handle].obj = obj;
+
+  obj->type   = type;
+  obj->gc     = heap->mark;
+  obj->handle = handle;
+
+  ref->ns      = heap->handles[handle].gen;
+  ref->val.ref = handle;
+  return obj;
+}
+
+#endif /* KL_HEAP_H */
@@ -12,6 +12,10 @@ ENUMSTRING(NUMBER)
 ENUMSTRING(BLOCK)
 ENUMSTRING(END)
 ENUMSTRING(PRINT)
+ENUMSTRING(COMMA)
+ENUMSTRING(QUESTION)
+ENUMSTRING(COLON)
+ENUMSTRING(ERROR)
 
 ENUMSTRING(ADD)
 ENUMSTRING(UADD)
@@ -36,8 +40,31 @@ ENUMSTRING(LOG_E)
 ENUMSTRING(LOG_2)
 ENUMSTRING(LOG_10)
 
+ENUMSTRING(DOT)
+ENUMSTRING(CROSS)
+ENUMSTRING(ROTATE)
+ENUMSTRING(LENGTH)
+ENUMSTRING(NORMALIZE)
+
+ENUMSTRING(ABS)
+ENUMSTRING(SIGN)
+ENUMSTRING(MIN)
+ENUMSTRING(MAX)
+ENUMSTRING(CLAMP)
+ENUMSTRING(LERP)
+
 ENUMSTRING(LPAREN)
 ENUMSTRING(RPAREN)
+ENUMSTRING(LBRACKET)
+ENUMSTRING(RBRACKET)
+
+ENUMSTRING(SQRT)
+ENUMSTRING(EXP_E)
+ENUMSTRING(EXP_2)
+ENUMSTRING(TANGENT)
+ENUMSTRING(POW)
+ENUMSTRING(ATAN2)
+ENUMSTRING(SINCOS)
 
 ENUMSTRING(CMP)
 ENUMSTRING(NEQ)
@@ -53,6 +80,25 @@ ENUMSTRING(LOGNOT)
 ENUMSTRING(ASSIGN)
 
 ENUMSTRING(PUSH)
+ENUMSTRING(LOAD)
+ENUMSTRING(STORE)
+ENUMSTRING(LOADG)
+ENUMSTRING(STOREG)
+ENUMSTRING(LOADI)
+ENUMSTRING(STOREI)
+ENUMSTRING(ARRAY)
+ENUMSTRING(INDEX)
+ENUMSTRING(JMPF)
+ENUMSTRING(JMPT)
+ENUMSTRING(JZ)
+ENUMSTRING(JMP)
+ENUMSTRING(SELECT)
+ENUMSTRING(MULADD)
+ENUMSTRING(ADDMUL)
+ENUMSTRING(DIVC)
+ENUMSTRING(FDIVC)
+ENUMSTRING(MODC)
+ENUMSTRING(POP)
 
 static char dunno[] = "????????";
 
@@ -71,6 +117,10 @@ char* kl_langdef_name(int value) {
     ENUMCASE(BLOCK)
     ENUMCASE(END)
     ENUMCASE(PRINT)
+    ENUMCASE(COMMA)
+    ENUMCASE(QUESTION)
+    ENUMCASE(COLON)
+    ENUMCASE(ERROR)
 
     ENUMCASE(ADD)
     ENUMCASE(UADD)
@@ -95,8 +145,31 @@ char* kl_langdef_name(int value) {
     ENUMCASE(LOG_2)
     ENUMCASE(LOG_10)
 
+    ENUMCASE(DOT)
+    ENUMCASE(CROSS)
+    ENUMCASE(ROTATE)
+    ENUMCASE(LENGTH)
+    ENUMCASE(NORMALIZE)
+
+    ENUMCASE(ABS)
+    ENUMCASE(SIGN)
+    ENUMCASE(MIN)
+    ENUMCASE(MAX)
+    ENUMCASE(CLAMP)
+    ENUMCASE(LERP)
+
     ENUMCASE(LPAREN)
     ENUMCASE(RPAREN)
+    ENUMCASE(LBRACKET)
+    ENUMCASE(RBRACKET)
+
+    ENUMCASE(SQRT)
+    ENUMCASE(EXP_E)
+    ENUMCASE(EXP_2)
+    ENUMCASE(TANGENT)
+    ENUMCASE(POW)
+    ENUMCASE(ATAN2)
+    ENUMCASE(SINCOS)
 
     ENUMCASE(CMP)
     ENUMCASE(NEQ)
@@ -112,6 +185,25 @@ char* kl_langdef_name(int value) {
     ENUMCASE(ASSIGN)
 
     ENUMCASE(PUSH)
+    ENUMCASE(LOAD)
+    ENUMCASE(STORE)
+    ENUMCASE(LOADG)
+    ENUMCASE(STOREG)
+    ENUMCASE(LOADI)
+    ENUMCASE(STOREI)
+    ENUMCASE(ARRAY)
+    ENUMCASE(INDEX)
+    ENUMCASE(JMPF)
+    ENUMCASE(JMPT)
+    ENUMCASE(JZ)
+    ENUMCASE(JMP)
+    ENUMCASE(SELECT)
+    ENUMCASE(MULADD)
+    ENUMCASE(ADDMUL)
+    ENUMCASE(DIVC)
+    ENUMCASE(FDIVC)
+    ENUMCASE(MODC)
+    ENUMCASE(POP)
 
     default:
       return dunno;
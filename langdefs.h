@@ -35,6 +35,10 @@
 #define KL_BLOCK    0x06 /* parser->compiler */
 #define KL_END      0x07 /* ; */
 #define KL_PRINT    0x08 /* print */
+#define KL_COMMA    0x09 /* , */
+#define KL_QUESTION 0x0A /* ? */
+#define KL_COLON    0x0B /* : */
+#define KL_ERROR    0x0C /* lexer->compiler, a token the lexer could not read and has reported */
 
 /* lexer->parser->compiler->opcodes */
 #define KL_ADD    KL_LEFTASSOCIATIVE(KL_BINOP(0x20)) /* + */
@@ -60,9 +64,38 @@
 #define KL_LOG_2  KL_RIGHTASSOCIATIVE(KL_UNOP(0x33))
 #define KL_LOG_10 KL_RIGHTASSOCIATIVE(KL_UNOP(0x34))
 
+/* vector operators, see numarray.h */
+#define KL_DOT       KL_LEFTASSOCIATIVE(KL_BINOP(0x35))  /* dot */
+#define KL_CROSS     KL_LEFTASSOCIATIVE(KL_BINOP(0x36))  /* cross */
+#define KL_ROTATE    KL_LEFTASSOCIATIVE(KL_BINOP(0x37))  /* rotate (counterclockwise in the xy plane) */
+#define KL_LENGTH    KL_RIGHTASSOCIATIVE(KL_UNOP(0x38))  /* length */
+#define KL_NORMALIZE KL_RIGHTASSOCIATIVE(KL_UNOP(0x39))  /* normalize */
+
+/* branch-free intrinsics, see number.h -- abs and sign are prefix operators, the rest are called like
+ * min(a, b), clamp(x, lo, hi) and lerp(a, b, t) */
+#define KL_ABS   KL_RIGHTASSOCIATIVE(KL_UNOP(0x3A))
+#define KL_SIGN  KL_RIGHTASSOCIATIVE(KL_UNOP(0x3B))
+#define KL_MIN   0x3C
+#define KL_MAX   0x3D
+#define KL_CLAMP 0x3E
+#define KL_LERP  0x3F
+
 /* lexer->parser */
 #define KL_LPAREN KL_GROUP(0x40) /* ( */
 #define KL_RPAREN KL_GROUP(0x41) /* ) */
+#define KL_LBRACKET KL_GROUP(0x42) /* [ (array literal, or index when postfix) */
+#define KL_RBRACKET KL_GROUP(0x43) /* ] */
+
+/* math engine, see number.h -- pow(x, y) and atan2(y, x) are called like min */
+#define KL_SQRT    KL_RIGHTASSOCIATIVE(KL_UNOP(0x44))
+#define KL_EXP_E   KL_RIGHTASSOCIATIVE(KL_UNOP(0x45))
+#define KL_EXP_2   KL_RIGHTASSOCIATIVE(KL_UNOP(0x46))
+#define KL_TANGENT KL_RIGHTASSOCIATIVE(KL_UNOP(0x47))
+#define KL_POW     0x48
+#define KL_ATAN2   0x49
+/* both results of one reduction, sine then cosine -- only as the value of a multiple assignment,
+ * s, c = sincos theta */
+#define KL_SINCOS  0x4A
 
 /* lexer->parser->compiler->opcodes */
 #define KL_CMP    KL_LEFTASSOCIATIVE(KL_BINOP(0x50)) /* <=> (ruby style general comparison operator) */
@@ -80,7 +113,27 @@
 #define KL_ASSIGN KL_RIGHTASSOCIATIVE(KL_BINOP(0x60))
 
 /* compiler->opcode */
-#define KL_PUSH 0x80
+#define KL_PUSH  0x80
+#define KL_LOAD  0x81 /* push frame slot arg.val.ref */
+#define KL_STORE 0x82 /* copy top of stack into frame slot arg.val.ref */
+#define KL_LOADG  0x83 /* push global arg.ns (symbol), cached in code->cache[arg.val.ref] */
+#define KL_STOREG 0x84 /* copy top of stack into global arg.ns, cached as above */
+#define KL_LOADI  0x85 /* push field arg.ns (symbol) of vm->self, cached in code->cache[arg.val.ref] */
+#define KL_STOREI 0x86 /* copy top of stack into field arg.ns of vm->self, cached as above */
+#define KL_ARRAY  0x87 /* pop arg.val.ref elements and push them as a new array */
+#define KL_INDEX  0x88 /* pop an index and an array, push the element (zero if out of range) */
+/* jumps skip arg.val.ref instructions forward, counted from the next one */
+#define KL_JMPF   0x89 /* jump if top of stack is the number zero, leaving it as the result */
+#define KL_JMPT   0x8A /* jump if top of stack is a nonzero number, replacing it with one */
+#define KL_JZ     0x8B /* pop, jump if it was the number zero */
+#define KL_JMP    0x8C /* jump */
+#define KL_SELECT 0x8D /* pop else, then and condition values, push then if the condition is true */
+#define KL_MULADD 0x8E /* pop z, y, x and push x*y + z, with a single shift of the kl_num_wide_t product */
+#define KL_ADDMUL 0x8F /* pop y, x, z and push z + x*y, as above */
+#define KL_DIVC   0x90 /* divide top of stack by code->magic[arg.val.ref], see kl_num_magic */
+#define KL_FDIVC  0x91 /* as above, floor division */
+#define KL_MODC   0x92 /* as above, remainder */
+#define KL_POP    0x93 /* discard top of stack */
 
 char* kl_langdef_name(int value);
 
@@ -2,9 +2,11 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #include "number.h"
 #include "langdefs.h"
+#include "symbol.h"
 
 
 #define ISALPHA(c)\
@@ -16,9 +18,13 @@
 #define ISALPHANUM(c)\
   (ISALPHA(c) || ISDECIMAL(c))
 
+/* whether a + or - after a token of this type is binary.  KL_NONE has every flag bit set */
+#define ENDSOPERAND(t)\
+  ((t) == KL_NUMBER || ((t) != KL_NONE && (t) & KL_FLAG_VAR) || (t) == KL_RPAREN || (t) == KL_RBRACKET)
+
 static void kl_lexer_alphanum(kl_lexer_t *source, char* buf, int *n, int max);
-static void kl_lexer_number(kl_lexer_t *source, kl_token_num_t *token, char* buf, int n);
-static int  kl_lexer_keyword(char *buf, int n);
+static void kl_lexer_number(kl_lexer_t *source, kl_token_t *token, char* buf, int n);
+static int  kl_lexer_keyword(uint32_t sym);
 static void kl_lexer_error(char *msg);
 static int  peek(kl_lexer_t *source);
 static void next(kl_lexer_t *source);
@@ -30,17 +36,54 @@ void kl_lexer_init(kl_lexer_t *source, kl_lexer_read_cb read, kl_lexer_err_cb er
   source->cur   = read(); /* load first char */
   source->line  = 1;
   source->last  = KL_NONE;
+
+  /* reserved words are tagged on their symbols once, so keyword lookup is a single load */
+  static const struct { const char *str; int type; } keywords[] = {
+    { "print",     KL_PRINT },
+    { "sin",       KL_SINE },
+    { "cos",       KL_COSINE },
+    { "ln",        KL_LOG_E },
+    { "lb",        KL_LOG_2 },
+    { "lg",        KL_LOG_10 },
+    { "dot",       KL_DOT },
+    { "cross",     KL_CROSS },
+    { "rotate",    KL_ROTATE },
+    { "length",    KL_LENGTH },
+    { "normalize", KL_NORMALIZE },
+    { "abs",       KL_ABS },
+    { "sign",      KL_SIGN },
+    { "min",       KL_MIN },
+    { "max",       KL_MAX },
+    { "clamp",     KL_CLAMP },
+    { "lerp",      KL_LERP },
+    { "sqrt",      KL_SQRT },
+    { "exp",       KL_EXP_E },
+    { "exp2",      KL_EXP_2 },
+    { "tan",       KL_TANGENT },
+    { "pow",       KL_POW },
+    { "atan2",     KL_ATAN2 },
+    { "sincos",    KL_SINCOS },
+  };
+  for (int i=0; i < (int)(sizeof(keywords) / sizeof(keywords[0])); i++) {
+    kl_symbol_setkeyword(kl_symbol_intern(keywords[i].str, strlen(keywords[i].str)), keywords[i].type);
+  }
 }
 
 #define KL_LEXER_BUFSIZE 0x0100
+/* with statistics on, kl_lexer_next is a wrapper that counts and times this */
+#if KL_COMPILER_STATS
+static void scan(kl_lexer_t *s, kl_token_t *token) {
+#else
 void kl_lexer_next(kl_lexer_t *s, kl_token_t *token) {
+#endif
   kl_token_header_t* h = &token->header;
   h->type = KL_NONE;
   h->line = s->line;
 
   char c;
-  char buf[KL_LEXER_BUFSIZE];
+  char buf[KL_LEXER_BUFSIZE + KL_NUM_PARSE_PAD];
   while ((c = peek(s)) >= 0) {
+    h->line = s->line; /* of the token's first character, not of the whitespace before it */
     next(s);
     switch(c) {
       case '\x04': /* End of Transmission */
@@ -48,7 +91,7 @@ void kl_lexer_next(kl_lexer_t *s, kl_token_t *token) {
         s->last = KL_NONE;
         return;
       case '#':    /* single-line comment */
-        while (peek(s) != '\n') { next(s); }
+        while (peek(s) != '\n' && peek(s) >= 0) { next(s); }
         break;
       case '\n':
         s->line++;
@@ -58,7 +101,7 @@ void kl_lexer_next(kl_lexer_t *s, kl_token_t *token) {
         s->last = KL_END;
         return;
       case '+':
-        if (s->last == KL_NUMBER || s->last & KL_FLAG_VAR || s->last == KL_RPAREN) {
+        if (ENDSOPERAND(s->last)) {
           h->type = KL_ADD;
           s->last = KL_ADD;
           return;
@@ -67,7 +110,7 @@ void kl_lexer_next(kl_lexer_t *s, kl_token_t *token) {
         s->last = KL_UADD;
         return;
       case '-':
-        if (s->last == KL_NUMBER || s->last & KL_FLAG_VAR || s->last == KL_RPAREN) {
+        if (ENDSOPERAND(s->last)) {
           h->type = KL_SUB;
           s->last = KL_SUB;
           return;
@@ -197,34 +240,80 @@ void kl_lexer_next(kl_lexer_t *s, kl_token_t *token) {
         h->type = KL_RPAREN;
         s->last = KL_RPAREN;
         return;
+      case '[':
+        h->type = KL_LBRACKET;
+        s->last = KL_LBRACKET;
+        return;
+      case ']':
+        h->type = KL_RBRACKET;
+        s->last = KL_RBRACKET;
+        return;
+      case ',':
+        h->type = KL_COMMA;
+        s->last = KL_COMMA;
+        return;
+      case '?':
+        h->type = KL_QUESTION;
+        s->last = KL_QUESTION;
+        return;
+      case ':':
+        h->type = KL_COLON;
+        s->last = KL_COLON;
+        return;
+      case '$':   /* global variable */
+      case '@': { /* instance variable */
+        int type = c == '$' ? KL_GLOBAL : KL_INSTVAR;
+        if (!ISALPHA(peek(s))) {
+          s->error("Expected a variable name!");
+          h->type = KL_ERROR;
+          return;
+        }
+        buf[0] = peek(s);
+        next(s);
+        int n  = 1;
+        kl_lexer_alphanum(s, buf, &n, KL_LEXER_BUFSIZE);
+
+        if (n > KL_TOKEN_STRLEN) {
+          s->error("Variable name exceeds maximum length!");
+          h->type = KL_ERROR;
+          return;
+        }
+        h->type        = type;
+        token->val.sym = kl_symbol_intern(buf, n);
+
+        s->last = type;
+        return;
+      }
       default:
         if (ISALPHA(c)) {
           buf[0] = c;
           int n  = 1;
           kl_lexer_alphanum(s, buf, &n, KL_LEXER_BUFSIZE);
 
-          int kw = kl_lexer_keyword(buf, n);
+          if (n > KL_TOKEN_STRLEN) {
+            s->error("Variable name exceeds maximum length!");
+            h->type = KL_ERROR;
+            return;
+          }
+          uint32_t sym = kl_symbol_intern(buf, n);
+
+          int kw = kl_lexer_keyword(sym);
           if (kw != KL_NONE) {
             h->type = kw;
             s->last = kw;
             return;
           }
 
-          kl_token_str_t* stoken = &token->str;
-          if (n > KL_TOKEN_STRLEN) {
-            s->error("Variable name exceeds maximum length!");
-            return;
-          }
-          stoken->header.type = KL_LOCAL;
-          memcpy(stoken->str, buf, n);
+          h->type        = KL_LOCAL;
+          token->val.sym = sym;
 
-          s->last            = KL_LOCAL;
+          s->last = KL_LOCAL;
           return;
         }
 
         if (ISDECIMAL(c)) {
           buf[0] = c;
-          kl_lexer_number(s, (kl_token_num_t*)token, buf, 1);
+          kl_lexer_number(s, token, buf, 1);
 
           s->last = KL_NUMBER;
           return;
@@ -233,60 +322,101 @@ void kl_lexer_next(kl_lexer_t *s, kl_token_t *token) {
   }
 }
 
-/* continues reading a string of alphanumeric characters */
+/* continues reading a string of alphanumeric characters.  all of it is consumed, but only the first max
+ * are kept -- *n is the full length, for the caller to reject */
 static void kl_lexer_alphanum(kl_lexer_t *source, char* buf, int *n, int max) {
-  int c;
-  for (int i=*n; i < max; i++) {
+  int c, i;
+  for (i=*n; ; i++) {
     c = peek(source);
-    if (!(ISALPHANUM(c) || c == '_')) {
-      *n = i;
-      return;
-    }
-    buf[i] = c;
+    if (!(ISALPHANUM(c) || c == '_')) break;
+    if (i < max) buf[i] = c;
     next(source);
   }
-  source->error("Label exceeds maximum length!");
+  *n = i;
 }
 
-/* continues reading and parses a numeric value -- partial number string (up to decimal) may be loaded into buf */
-static void kl_lexer_number(kl_lexer_t *source, kl_token_num_t *token, char* buf, int n) {
-  int c;
+/* continues reading and parses a numeric value -- the digits read so far are in buf.  in fixed point the
+ * digits are also packed eight to a word as they come, and each full word converted at once: reading them
+ * back from buf right after writing them a byte at a time would stall on store forwarding */
+static void kl_lexer_number(kl_lexer_t *source, kl_token_t *token, char* buf, int n) {
   kl_number_t number;
-
-  for(int i=n; i < KL_LEXER_BUFSIZE; i++) {
-    c = peek(source);
-    if (!ISDECIMAL(c)) {
-      number = kl_strtoinum(buf, i);
-      break;
+  int         c;
+#if KL_NUM_FIXED
+  /* integer digits enter at the top lane, so that a part word is the value under leading zeros */
+  uint64_t ipart = 0, w = KL_NUM_ZEROS8;
+  int      ni = 0, k = 0;
+#endif
+  for (int i=0; ; i++) {
+    if (i == n) {
+      if (!ISDECIMAL(c = peek(source)) || n == KL_LEXER_BUFSIZE) break;
+      buf[n++] = c;
+      next(source);
     }
-    buf[i] = c;
-    next(source);
+#if KL_NUM_FIXED
+    if (ni == 0 && buf[i] == '0') continue;
+    w = w >> 8 | (uint64_t)buf[i] << 56;
+    ni++;
+    if (++k == 8) {
+      ipart = ipart * 100000000 + kl_num_digit8(w);
+      w     = KL_NUM_ZEROS8;
+      k     = 0;
+    }
+#endif
   }
-  if (c == '.') {
+#if KL_NUM_FIXED
+  if (k > 0) ipart = ipart * kl_num_tens[k] + kl_num_digit8(w);
+
+  /* decimals enter at the bottom lane, so that a part word is the value over trailing zeros */
+  uint64_t group[KL_NUM_GROUPS];
+  int      ng = 0;
+  w = KL_NUM_ZEROS8;
+  k = 0;
+#endif
+  if (c == '.' && n < KL_LEXER_BUFSIZE) {
+    buf[n++] = c;
     next(source);
-    for(int i=0; i < KL_LEXER_BUFSIZE; i++) {
-      c = peek(source);
-      if (!ISDECIMAL(c)) {
-        number += kl_strtofnum(buf, i);
-        break;
-      }
-      buf[i] = c;
+    while (ISDECIMAL(c = peek(source)) && n < KL_LEXER_BUFSIZE) {
+      buf[n++] = c;
       next(source);
+#if KL_NUM_FIXED
+      if (ng == KL_NUM_GROUPS) continue;
+      w ^= (uint64_t)(c - '0') << (8 * k);
+      if (++k == 8) {
+        group[ng++] = kl_num_digit8(w);
+        w           = KL_NUM_ZEROS8;
+        k           = 0;
+      }
+#endif
     }
   }
+  if (n == KL_LEXER_BUFSIZE) {
+    source->error("Number exceeds maximum length!");
+    token->header.type = KL_ERROR;
+    return;
+  }
 
+#if KL_NUM_FIXED
+  /* after a unary minus the literal may reach one further, as far as KL_NUM_MIN.  it keeps the bits of
+   * its magnitude, which for KL_NUM_MAX + 1 are those of KL_NUM_MIN, and the negation folds back onto it */
+  int neg = source->last == KL_USUB;
+  if (k > 0 && ng < KL_NUM_GROUPS) group[ng++] = kl_num_digit8(w);
+  if (ni > 19 || kl_num_fromdecimal(neg, ipart, group, ng, &number) < 0) {
+#else
+  if (kl_num_parse(buf, n, &number) < 0) {
+#endif
+    source->error("Number out of range!");
+    token->header.type = KL_ERROR;
+    return;
+  }
+#if KL_NUM_FIXED
+  if (neg) number = (kl_number_t)(0 - (kl_num_bits_t)number);
+#endif
   token->header.type = KL_NUMBER;
-  token->val        = number;
+  token->val.num     = number;
 }
 
-static int kl_lexer_keyword(char *buf, int n) {
-  if (strncmp(buf, "print", n) == 0) { return KL_PRINT; }
-  if (strncmp(buf, "sin", n) == 0) { return KL_SINE; }
-  if (strncmp(buf, "cos", n) == 0) { return KL_COSINE; }
-  if (strncmp(buf, "ln", n) == 0) { return KL_LOG_E; }
-  if (strncmp(buf, "lb", n) == 0) { return KL_LOG_2; }
-  if (strncmp(buf, "lg", n) == 0) { return KL_LOG_10; }
-  return KL_NONE;
+static int kl_lexer_keyword(uint32_t sym) {
+  return kl_symbol_keyword(sym);
 }
 static void kl_lexer_error(char *msg) {
   fprintf(stderr, "KludgeScript -> Lexical Analysis Error: %s\n", msg);
@@ -295,5 +425,19 @@ static int  peek(kl_lexer_t *source) {
   return source->cur;
 }
 static void next(kl_lexer_t *source) {
+#if KL_COMPILER_STATS
+  source->stats.bytes += source->cur >= 0;
+#endif
   source->cur = source->read();
 }
+
+#if KL_COMPILER_STATS
+void kl_lexer_next(kl_lexer_t *source, kl_token_t *token) {
+  struct timespec t0, t1;
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  scan(source, token);
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  source->stats.tokens++;
+  source->stats.ns += (t1.tv_sec - t0.tv_sec) * 1000000000LL + (t1.tv_nsec - t0.tv_nsec);
+}
+#endif
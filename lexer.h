@@ -3,6 +3,15 @@
 
 #include <stdint.h>
 #include "number.h"
+#include "config.h"
+
+#if KL_COMPILER_STATS
+typedef struct kl_lexer_stats {
+  uint64_t tokens;
+  uint64_t bytes; /* characters consumed */
+  uint64_t ns;    /* wall time in kl_lexer_next */
+} kl_lexer_stats_t;
+#endif
 
 typedef int  (*kl_lexer_read_cb)(void);
 typedef void (*kl_lexer_err_cb)(char*);
@@ -13,30 +22,24 @@ typedef struct kl_lexer {
   int cur;  /* current character */
   int line; /* current line */
   int last; /* type of last token */
+  const char* name; /* of the script, carried into compiled code -- NULL if unnamed, set after init */
+#if KL_COMPILER_STATS
+  kl_lexer_stats_t stats; /* since init */
+#endif
 } kl_lexer_t;
 
-#define KL_TOKEN_SIZE   0x0100
 #define KL_TOKEN_STRLEN 0x00FC
 typedef struct kl_token_header {
   int type;
   int line;
 } kl_token_header_t;
 
-typedef struct kl_token_str {
-  kl_token_header_t header;
-  int32_t n;
-  char    str[KL_TOKEN_STRLEN];
-} kl_token_str_t;
-
-typedef struct kl_token_num {
-  kl_token_header_t header;
-  kl_number_t val;
-} kl_token_num_t;
-
-typedef union kl_token {
+typedef struct kl_token {
   kl_token_header_t header;
-  kl_token_str_t    str;
-  kl_token_num_t    num;
+  union {
+    kl_number_t num; /* KL_NUMBER */
+    uint32_t    sym; /* names -- interned symbol id */
+  } val;
 } kl_token_t;
 
 void kl_lexer_init(kl_lexer_t *source, kl_lexer_read_cb read, kl_lexer_err_cb error);
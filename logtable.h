@@ -1,1028 +1,264 @@
+/* generated by tools/tablegen.c -- lb 8 32 lerp */
 /* base-2 log values for 1 <= x <= 2 */
-static int32_t lb_values[0x0401] = {
+#define KL_LB_BITS  8 /* 2^bits intervals */
+#define KL_LB_FBITS 30 /* fractional bits of an entry */
+#define KL_LB_LERP  1 /* interpolate between entries, rather than take the nearest */
+static const int32_t lb_values[0x0101] = {
   0x00000000,
-  0x0000005c,
-  0x000000b8,
-  0x00000114,
-  0x00000170,
-  0x000001cc,
-  0x00000228,
-  0x00000284,
-  0x000002df,
-  0x0000033b,
-  0x00000396,
-  0x000003f2,
-  0x0000044d,
-  0x000004a8,
-  0x00000503,
-  0x0000055e,
-  0x000005b9,
-  0x00000614,
-  0x0000066f,
-  0x000006ca,
-  0x00000724,
-  0x0000077f,
-  0x000007d9,
-  0x00000834,
-  0x0000088e,
-  0x000008e8,
-  0x00000942,
-  0x0000099c,
-  0x000009f6,
-  0x00000a50,
-  0x00000aaa,
-  0x00000b03,
-  0x00000b5d,
-  0x00000bb6,
-  0x00000c10,
-  0x00000c69,
-  0x00000cc2,
-  0x00000d1c,
-  0x00000d75,
-  0x00000dce,
-  0x00000e26,
-  0x00000e7f,
-  0x00000ed8,
-  0x00000f31,
-  0x00000f89,
-  0x00000fe2,
-  0x0000103a,
-  0x00001092,
-  0x000010eb,
-  0x00001143,
-  0x0000119b,
-  0x000011f3,
-  0x0000124b,
-  0x000012a3,
-  0x000012fa,
-  0x00001352,
-  0x000013aa,
-  0x00001401,
-  0x00001459,
-  0x000014b0,
-  0x00001507,
-  0x0000155e,
-  0x000015b6,
-  0x0000160d,
-  0x00001663,
-  0x000016ba,
-  0x00001711,
-  0x00001768,
-  0x000017be,
-  0x00001815,
-  0x0000186b,
-  0x000018c2,
-  0x00001918,
-  0x0000196e,
-  0x000019c5,
-  0x00001a1b,
-  0x00001a71,
-  0x00001ac6,
-  0x00001b1c,
-  0x00001b72,
-  0x00001bc8,
-  0x00001c1d,
-  0x00001c73,
-  0x00001cc8,
-  0x00001d1e,
-  0x00001d73,
-  0x00001dc8,
-  0x00001e1d,
-  0x00001e72,
-  0x00001ec7,
-  0x00001f1c,
-  0x00001f71,
-  0x00001fc6,
-  0x0000201b,
-  0x0000206f,
-  0x000020c4,
-  0x00002118,
-  0x0000216d,
-  0x000021c1,
-  0x00002215,
-  0x00002269,
-  0x000022bd,
-  0x00002311,
-  0x00002365,
-  0x000023b9,
-  0x0000240d,
-  0x00002461,
-  0x000024b4,
-  0x00002508,
-  0x0000255b,
-  0x000025af,
-  0x00002602,
-  0x00002655,
-  0x000026a9,
-  0x000026fc,
-  0x0000274f,
-  0x000027a2,
-  0x000027f5,
-  0x00002847,
-  0x0000289a,
-  0x000028ed,
-  0x0000293f,
-  0x00002992,
-  0x000029e4,
-  0x00002a37,
-  0x00002a89,
-  0x00002adb,
-  0x00002b2e,
-  0x00002b80,
-  0x00002bd2,
-  0x00002c24,
-  0x00002c76,
-  0x00002cc7,
-  0x00002d19,
-  0x00002d6b,
-  0x00002dbc,
-  0x00002e0e,
-  0x00002e5f,
-  0x00002eb1,
-  0x00002f02,
-  0x00002f53,
-  0x00002fa5,
-  0x00002ff6,
-  0x00003047,
-  0x00003098,
-  0x000030e9,
-  0x0000313a,
-  0x0000318a,
-  0x000031db,
-  0x0000322c,
-  0x0000327c,
-  0x000032cd,
-  0x0000331d,
-  0x0000336e,
-  0x000033be,
-  0x0000340e,
-  0x0000345e,
-  0x000034ae,
-  0x000034fe,
-  0x0000354e,
-  0x0000359e,
-  0x000035ee,
-  0x0000363e,
-  0x0000368d,
-  0x000036dd,
-  0x0000372d,
-  0x0000377c,
-  0x000037cc,
-  0x0000381b,
-  0x0000386a,
-  0x000038b9,
-  0x00003909,
-  0x00003958,
-  0x000039a7,
-  0x000039f6,
-  0x00003a45,
-  0x00003a93,
-  0x00003ae2,
-  0x00003b31,
-  0x00003b7f,
-  0x00003bce,
-  0x00003c1c,
-  0x00003c6b,
-  0x00003cb9,
-  0x00003d08,
-  0x00003d56,
-  0x00003da4,
-  0x00003df2,
-  0x00003e40,
-  0x00003e8e,
-  0x00003edc,
-  0x00003f2a,
-  0x00003f78,
-  0x00003fc5,
-  0x00004013,
-  0x00004061,
-  0x000040ae,
-  0x000040fc,
-  0x00004149,
-  0x00004196,
-  0x000041e4,
-  0x00004231,
-  0x0000427e,
-  0x000042cb,
-  0x00004318,
-  0x00004365,
-  0x000043b2,
-  0x000043ff,
-  0x0000444c,
-  0x00004498,
-  0x000044e5,
-  0x00004532,
-  0x0000457e,
-  0x000045cb,
-  0x00004617,
-  0x00004663,
-  0x000046b0,
-  0x000046fc,
-  0x00004748,
-  0x00004794,
-  0x000047e0,
-  0x0000482c,
-  0x00004878,
-  0x000048c4,
-  0x00004910,
-  0x0000495b,
-  0x000049a7,
-  0x000049f3,
-  0x00004a3e,
-  0x00004a8a,
-  0x00004ad5,
-  0x00004b20,
-  0x00004b6c,
-  0x00004bb7,
-  0x00004c02,
-  0x00004c4d,
-  0x00004c98,
-  0x00004ce3,
-  0x00004d2e,
-  0x00004d79,
-  0x00004dc4,
-  0x00004e0f,
-  0x00004e5a,
-  0x00004ea4,
-  0x00004eef,
-  0x00004f39,
-  0x00004f84,
-  0x00004fce,
-  0x00005019,
-  0x00005063,
-  0x000050ad,
-  0x000050f7,
-  0x00005141,
-  0x0000518c,
-  0x000051d6,
-  0x0000521f,
-  0x00005269,
-  0x000052b3,
-  0x000052fd,
-  0x00005347,
-  0x00005390,
-  0x000053da,
-  0x00005424,
-  0x0000546d,
-  0x000054b6,
-  0x00005500,
-  0x00005549,
-  0x00005592,
-  0x000055dc,
-  0x00005625,
-  0x0000566e,
-  0x000056b7,
-  0x00005700,
-  0x00005749,
-  0x00005792,
-  0x000057db,
-  0x00005823,
-  0x0000586c,
-  0x000058b5,
-  0x000058fd,
-  0x00005946,
-  0x0000598e,
-  0x000059d7,
-  0x00005a1f,
-  0x00005a67,
-  0x00005ab0,
-  0x00005af8,
-  0x00005b40,
-  0x00005b88,
-  0x00005bd0,
-  0x00005c18,
-  0x00005c60,
-  0x00005ca8,
-  0x00005cf0,
-  0x00005d37,
-  0x00005d7f,
-  0x00005dc7,
-  0x00005e0e,
-  0x00005e56,
-  0x00005e9d,
-  0x00005ee5,
-  0x00005f2c,
-  0x00005f74,
-  0x00005fbb,
-  0x00006002,
-  0x00006049,
-  0x00006090,
-  0x000060d7,
-  0x0000611e,
-  0x00006165,
-  0x000061ac,
-  0x000061f3,
-  0x0000623a,
-  0x00006281,
-  0x000062c7,
-  0x0000630e,
-  0x00006355,
-  0x0000639b,
-  0x000063e2,
-  0x00006428,
-  0x0000646e,
-  0x000064b5,
-  0x000064fb,
-  0x00006541,
-  0x00006587,
-  0x000065ce,
-  0x00006614,
-  0x0000665a,
-  0x000066a0,
-  0x000066e5,
-  0x0000672b,
-  0x00006771,
-  0x000067b7,
-  0x000067fd,
-  0x00006842,
-  0x00006888,
-  0x000068cd,
-  0x00006913,
-  0x00006958,
-  0x0000699e,
-  0x000069e3,
-  0x00006a28,
-  0x00006a6e,
-  0x00006ab3,
-  0x00006af8,
-  0x00006b3d,
-  0x00006b82,
-  0x00006bc7,
-  0x00006c0c,
-  0x00006c51,
-  0x00006c96,
-  0x00006cda,
-  0x00006d1f,
-  0x00006d64,
-  0x00006da9,
-  0x00006ded,
-  0x00006e32,
-  0x00006e76,
-  0x00006ebb,
-  0x00006eff,
-  0x00006f43,
-  0x00006f88,
-  0x00006fcc,
-  0x00007010,
-  0x00007054,
-  0x00007098,
-  0x000070dc,
-  0x00007120,
-  0x00007164,
-  0x000071a8,
-  0x000071ec,
-  0x00007230,
-  0x00007274,
-  0x000072b7,
-  0x000072fb,
-  0x0000733f,
-  0x00007382,
-  0x000073c6,
-  0x00007409,
-  0x0000744c,
-  0x00007490,
-  0x000074d3,
-  0x00007516,
-  0x0000755a,
-  0x0000759d,
-  0x000075e0,
-  0x00007623,
-  0x00007666,
-  0x000076a9,
-  0x000076ec,
-  0x0000772f,
-  0x00007772,
-  0x000077b4,
-  0x000077f7,
-  0x0000783a,
-  0x0000787d,
-  0x000078bf,
-  0x00007902,
-  0x00007944,
-  0x00007987,
-  0x000079c9,
-  0x00007a0c,
-  0x00007a4e,
-  0x00007a90,
-  0x00007ad2,
-  0x00007b15,
-  0x00007b57,
-  0x00007b99,
-  0x00007bdb,
-  0x00007c1d,
-  0x00007c5f,
-  0x00007ca1,
-  0x00007ce3,
-  0x00007d24,
-  0x00007d66,
-  0x00007da8,
-  0x00007dea,
-  0x00007e2b,
-  0x00007e6d,
-  0x00007eae,
-  0x00007ef0,
-  0x00007f31,
-  0x00007f73,
-  0x00007fb4,
-  0x00007ff5,
-  0x00008037,
-  0x00008078,
-  0x000080b9,
-  0x000080fa,
-  0x0000813b,
-  0x0000817c,
-  0x000081bd,
-  0x000081fe,
-  0x0000823f,
-  0x00008280,
-  0x000082c1,
-  0x00008302,
-  0x00008342,
-  0x00008383,
-  0x000083c4,
-  0x00008404,
-  0x00008445,
-  0x00008485,
-  0x000084c6,
-  0x00008506,
-  0x00008547,
-  0x00008587,
-  0x000085c7,
-  0x00008608,
-  0x00008648,
-  0x00008688,
-  0x000086c8,
-  0x00008708,
-  0x00008748,
-  0x00008788,
-  0x000087c8,
-  0x00008808,
-  0x00008848,
-  0x00008888,
-  0x000088c8,
-  0x00008907,
-  0x00008947,
-  0x00008987,
-  0x000089c6,
-  0x00008a06,
-  0x00008a45,
-  0x00008a85,
-  0x00008ac4,
-  0x00008b04,
-  0x00008b43,
-  0x00008b82,
-  0x00008bc2,
-  0x00008c01,
-  0x00008c40,
-  0x00008c7f,
-  0x00008cbe,
-  0x00008cfd,
-  0x00008d3c,
-  0x00008d7b,
-  0x00008dba,
-  0x00008df9,
-  0x00008e38,
-  0x00008e77,
-  0x00008eb5,
-  0x00008ef4,
-  0x00008f33,
-  0x00008f71,
-  0x00008fb0,
-  0x00008fef,
-  0x0000902d,
-  0x0000906c,
-  0x000090aa,
-  0x000090e8,
-  0x00009127,
-  0x00009165,
-  0x000091a3,
-  0x000091e2,
-  0x00009220,
-  0x0000925e,
-  0x0000929c,
-  0x000092da,
-  0x00009318,
-  0x00009356,
-  0x00009394,
-  0x000093d2,
-  0x00009410,
-  0x0000944e,
-  0x0000948b,
-  0x000094c9,
-  0x00009507,
-  0x00009544,
-  0x00009582,
-  0x000095c0,
-  0x000095fd,
-  0x0000963b,
-  0x00009678,
-  0x000096b6,
-  0x000096f3,
-  0x00009730,
-  0x0000976e,
-  0x000097ab,
-  0x000097e8,
-  0x00009825,
-  0x00009862,
-  0x0000989f,
-  0x000098dc,
-  0x00009919,
-  0x00009956,
-  0x00009993,
-  0x000099d0,
-  0x00009a0d,
-  0x00009a4a,
-  0x00009a87,
-  0x00009ac4,
-  0x00009b00,
-  0x00009b3d,
-  0x00009b79,
-  0x00009bb6,
-  0x00009bf3,
-  0x00009c2f,
-  0x00009c6c,
-  0x00009ca8,
-  0x00009ce4,
-  0x00009d21,
-  0x00009d5d,
-  0x00009d99,
-  0x00009dd6,
-  0x00009e12,
-  0x00009e4e,
-  0x00009e8a,
-  0x00009ec6,
-  0x00009f02,
-  0x00009f3e,
-  0x00009f7a,
-  0x00009fb6,
-  0x00009ff2,
-  0x0000a02e,
-  0x0000a06a,
-  0x0000a0a6,
-  0x0000a0e1,
-  0x0000a11d,
-  0x0000a159,
-  0x0000a194,
-  0x0000a1d0,
-  0x0000a20b,
-  0x0000a247,
-  0x0000a282,
-  0x0000a2be,
-  0x0000a2f9,
-  0x0000a335,
-  0x0000a370,
-  0x0000a3ab,
-  0x0000a3e7,
-  0x0000a422,
-  0x0000a45d,
-  0x0000a498,
-  0x0000a4d3,
-  0x0000a50e,
-  0x0000a549,
-  0x0000a584,
-  0x0000a5bf,
-  0x0000a5fa,
-  0x0000a635,
-  0x0000a670,
-  0x0000a6ab,
-  0x0000a6e6,
-  0x0000a720,
-  0x0000a75b,
-  0x0000a796,
-  0x0000a7d0,
-  0x0000a80b,
-  0x0000a846,
-  0x0000a880,
-  0x0000a8bb,
-  0x0000a8f5,
-  0x0000a92f,
-  0x0000a96a,
-  0x0000a9a4,
-  0x0000a9de,
-  0x0000aa19,
-  0x0000aa53,
-  0x0000aa8d,
-  0x0000aac7,
-  0x0000ab01,
-  0x0000ab3c,
-  0x0000ab76,
-  0x0000abb0,
-  0x0000abea,
-  0x0000ac24,
-  0x0000ac5d,
-  0x0000ac97,
-  0x0000acd1,
-  0x0000ad0b,
-  0x0000ad45,
-  0x0000ad7f,
-  0x0000adb8,
-  0x0000adf2,
-  0x0000ae2c,
-  0x0000ae65,
-  0x0000ae9f,
-  0x0000aed8,
-  0x0000af12,
-  0x0000af4b,
-  0x0000af85,
-  0x0000afbe,
-  0x0000aff7,
-  0x0000b031,
-  0x0000b06a,
-  0x0000b0a3,
-  0x0000b0dc,
-  0x0000b116,
-  0x0000b14f,
-  0x0000b188,
-  0x0000b1c1,
-  0x0000b1fa,
-  0x0000b233,
-  0x0000b26c,
-  0x0000b2a5,
-  0x0000b2de,
-  0x0000b317,
-  0x0000b350,
-  0x0000b388,
-  0x0000b3c1,
-  0x0000b3fa,
-  0x0000b433,
-  0x0000b46b,
-  0x0000b4a4,
-  0x0000b4dc,
-  0x0000b515,
-  0x0000b54e,
-  0x0000b586,
-  0x0000b5be,
-  0x0000b5f7,
-  0x0000b62f,
-  0x0000b668,
-  0x0000b6a0,
-  0x0000b6d8,
-  0x0000b711,
-  0x0000b749,
-  0x0000b781,
-  0x0000b7b9,
-  0x0000b7f1,
-  0x0000b829,
-  0x0000b861,
-  0x0000b899,
-  0x0000b8d1,
-  0x0000b909,
-  0x0000b941,
-  0x0000b979,
-  0x0000b9b1,
-  0x0000b9e9,
-  0x0000ba21,
-  0x0000ba58,
-  0x0000ba90,
-  0x0000bac8,
-  0x0000bb00,
-  0x0000bb37,
-  0x0000bb6f,
-  0x0000bba6,
-  0x0000bbde,
-  0x0000bc15,
-  0x0000bc4d,
-  0x0000bc84,
-  0x0000bcbc,
-  0x0000bcf3,
-  0x0000bd2a,
-  0x0000bd62,
-  0x0000bd99,
-  0x0000bdd0,
-  0x0000be07,
-  0x0000be3f,
-  0x0000be76,
-  0x0000bead,
-  0x0000bee4,
-  0x0000bf1b,
-  0x0000bf52,
-  0x0000bf89,
-  0x0000bfc0,
-  0x0000bff7,
-  0x0000c02e,
-  0x0000c065,
-  0x0000c09c,
-  0x0000c0d2,
-  0x0000c109,
-  0x0000c140,
-  0x0000c177,
-  0x0000c1ad,
-  0x0000c1e4,
-  0x0000c21a,
-  0x0000c251,
-  0x0000c288,
-  0x0000c2be,
-  0x0000c2f5,
-  0x0000c32b,
-  0x0000c361,
-  0x0000c398,
-  0x0000c3ce,
-  0x0000c404,
-  0x0000c43b,
-  0x0000c471,
-  0x0000c4a7,
-  0x0000c4dd,
-  0x0000c514,
-  0x0000c54a,
-  0x0000c580,
-  0x0000c5b6,
-  0x0000c5ec,
-  0x0000c622,
-  0x0000c658,
-  0x0000c68e,
-  0x0000c6c4,
-  0x0000c6fa,
-  0x0000c730,
-  0x0000c765,
-  0x0000c79b,
-  0x0000c7d1,
-  0x0000c807,
-  0x0000c83c,
-  0x0000c872,
-  0x0000c8a8,
-  0x0000c8dd,
-  0x0000c913,
-  0x0000c948,
-  0x0000c97e,
-  0x0000c9b3,
-  0x0000c9e9,
-  0x0000ca1e,
-  0x0000ca54,
-  0x0000ca89,
-  0x0000cabe,
-  0x0000caf4,
-  0x0000cb29,
-  0x0000cb5e,
-  0x0000cb94,
-  0x0000cbc9,
-  0x0000cbfe,
-  0x0000cc33,
-  0x0000cc68,
-  0x0000cc9d,
-  0x0000ccd2,
-  0x0000cd07,
-  0x0000cd3c,
-  0x0000cd71,
-  0x0000cda6,
-  0x0000cddb,
-  0x0000ce10,
-  0x0000ce45,
-  0x0000ce7a,
-  0x0000ceae,
-  0x0000cee3,
-  0x0000cf18,
-  0x0000cf4c,
-  0x0000cf81,
-  0x0000cfb6,
-  0x0000cfea,
-  0x0000d01f,
-  0x0000d053,
-  0x0000d088,
-  0x0000d0bc,
-  0x0000d0f1,
-  0x0000d125,
-  0x0000d15a,
-  0x0000d18e,
-  0x0000d1c2,
-  0x0000d1f7,
-  0x0000d22b,
-  0x0000d25f,
-  0x0000d294,
-  0x0000d2c8,
-  0x0000d2fc,
-  0x0000d330,
-  0x0000d364,
-  0x0000d398,
-  0x0000d3cc,
-  0x0000d400,
-  0x0000d434,
-  0x0000d468,
-  0x0000d49c,
-  0x0000d4d0,
-  0x0000d504,
-  0x0000d538,
-  0x0000d56c,
-  0x0000d59f,
-  0x0000d5d3,
-  0x0000d607,
-  0x0000d63b,
-  0x0000d66e,
-  0x0000d6a2,
-  0x0000d6d6,
-  0x0000d709,
-  0x0000d73d,
-  0x0000d770,
-  0x0000d7a4,
-  0x0000d7d7,
-  0x0000d80b,
-  0x0000d83e,
-  0x0000d872,
-  0x0000d8a5,
-  0x0000d8d8,
-  0x0000d90c,
-  0x0000d93f,
-  0x0000d972,
-  0x0000d9a5,
-  0x0000d9d9,
-  0x0000da0c,
-  0x0000da3f,
-  0x0000da72,
-  0x0000daa5,
-  0x0000dad8,
-  0x0000db0b,
-  0x0000db3e,
-  0x0000db71,
-  0x0000dba4,
-  0x0000dbd7,
-  0x0000dc0a,
-  0x0000dc3d,
-  0x0000dc70,
-  0x0000dca3,
-  0x0000dcd5,
-  0x0000dd08,
-  0x0000dd3b,
-  0x0000dd6e,
-  0x0000dda0,
-  0x0000ddd3,
-  0x0000de05,
-  0x0000de38,
-  0x0000de6b,
-  0x0000de9d,
-  0x0000ded0,
-  0x0000df02,
-  0x0000df35,
-  0x0000df67,
-  0x0000df9a,
-  0x0000dfcc,
-  0x0000dffe,
-  0x0000e031,
-  0x0000e063,
-  0x0000e095,
-  0x0000e0c7,
-  0x0000e0fa,
-  0x0000e12c,
-  0x0000e15e,
-  0x0000e190,
-  0x0000e1c2,
-  0x0000e1f4,
-  0x0000e226,
-  0x0000e258,
-  0x0000e28b,
-  0x0000e2bc,
-  0x0000e2ee,
-  0x0000e320,
-  0x0000e352,
-  0x0000e384,
-  0x0000e3b6,
-  0x0000e3e8,
-  0x0000e41a,
-  0x0000e44b,
-  0x0000e47d,
-  0x0000e4af,
-  0x0000e4e1,
-  0x0000e512,
-  0x0000e544,
-  0x0000e576,
-  0x0000e5a7,
-  0x0000e5d9,
-  0x0000e60a,
-  0x0000e63c,
-  0x0000e66d,
-  0x0000e69f,
-  0x0000e6d0,
-  0x0000e702,
-  0x0000e733,
-  0x0000e764,
-  0x0000e796,
-  0x0000e7c7,
-  0x0000e7f8,
-  0x0000e829,
-  0x0000e85b,
-  0x0000e88c,
-  0x0000e8bd,
-  0x0000e8ee,
-  0x0000e91f,
-  0x0000e950,
-  0x0000e982,
-  0x0000e9b3,
-  0x0000e9e4,
-  0x0000ea15,
-  0x0000ea46,
-  0x0000ea77,
-  0x0000eaa7,
-  0x0000ead8,
-  0x0000eb09,
-  0x0000eb3a,
-  0x0000eb6b,
-  0x0000eb9c,
-  0x0000ebcd,
-  0x0000ebfd,
-  0x0000ec2e,
-  0x0000ec5f,
-  0x0000ec8f,
-  0x0000ecc0,
-  0x0000ecf1,
-  0x0000ed21,
-  0x0000ed52,
-  0x0000ed82,
-  0x0000edb3,
-  0x0000ede3,
-  0x0000ee14,
-  0x0000ee44,
-  0x0000ee75,
-  0x0000eea5,
-  0x0000eed6,
-  0x0000ef06,
-  0x0000ef36,
-  0x0000ef66,
-  0x0000ef97,
-  0x0000efc7,
-  0x0000eff7,
-  0x0000f027,
-  0x0000f058,
-  0x0000f088,
-  0x0000f0b8,
-  0x0000f0e8,
-  0x0000f118,
-  0x0000f148,
-  0x0000f178,
-  0x0000f1a8,
-  0x0000f1d8,
-  0x0000f208,
-  0x0000f238,
-  0x0000f268,
-  0x0000f298,
-  0x0000f2c8,
-  0x0000f2f8,
-  0x0000f327,
-  0x0000f357,
-  0x0000f387,
-  0x0000f3b7,
-  0x0000f3e6,
-  0x0000f416,
-  0x0000f446,
-  0x0000f475,
-  0x0000f4a5,
-  0x0000f4d5,
-  0x0000f504,
-  0x0000f534,
-  0x0000f563,
-  0x0000f593,
-  0x0000f5c2,
-  0x0000f5f2,
-  0x0000f621,
-  0x0000f650,
-  0x0000f680,
-  0x0000f6af,
-  0x0000f6df,
-  0x0000f70e,
-  0x0000f73d,
-  0x0000f76c,
-  0x0000f79c,
-  0x0000f7cb,
-  0x0000f7fa,
-  0x0000f829,
-  0x0000f858,
-  0x0000f887,
-  0x0000f8b7,
-  0x0000f8e6,
-  0x0000f915,
-  0x0000f944,
-  0x0000f973,
-  0x0000f9a2,
-  0x0000f9d1,
-  0x0000fa00,
-  0x0000fa2f,
-  0x0000fa5d,
-  0x0000fa8c,
-  0x0000fabb,
-  0x0000faea,
-  0x0000fb19,
-  0x0000fb47,
-  0x0000fb76,
-  0x0000fba5,
-  0x0000fbd4,
-  0x0000fc02,
-  0x0000fc31,
-  0x0000fc60,
-  0x0000fc8e,
-  0x0000fcbd,
-  0x0000fceb,
-  0x0000fd1a,
-  0x0000fd48,
-  0x0000fd77,
-  0x0000fda5,
-  0x0000fdd4,
-  0x0000fe02,
-  0x0000fe31,
-  0x0000fe5f,
-  0x0000fe8d,
-  0x0000febc,
-  0x0000feea,
-  0x0000ff18,
-  0x0000ff47,
-  0x0000ff75,
-  0x0000ffa3,
-  0x0000ffd1,
-  0x00010000,
+  0x005c2712,
+  0x00b7f286,
+  0x01136311,
+  0x016e7968,
+  0x01c9363c,
+  0x02239a3b,
+  0x027da613,
+  0x02d75a6f,
+  0x0330b7f8,
+  0x0389bf57,
+  0x03e27130,
+  0x043ace28,
+  0x0492d6e0,
+  0x04ea8bf7,
+  0x0541ee0e,
+  0x0598fdbf,
+  0x05efbba6,
+  0x0646285c,
+  0x069c4478,
+  0x06f21090,
+  0x07478d39,
+  0x079cbb04,
+  0x07f19a84,
+  0x08462c46,
+  0x089a70da,
+  0x08ee68cc,
+  0x094214a6,
+  0x099574f1,
+  0x09e88a37,
+  0x0a3b54fd,
+  0x0a8dd5c8,
+  0x0ae00d1d,
+  0x0b31fb7d,
+  0x0b83a16a,
+  0x0bd4ff64,
+  0x0c2615e8,
+  0x0c76e574,
+  0x0cc76e84,
+  0x0d17b192,
+  0x0d67af17,
+  0x0db7678c,
+  0x0e06db67,
+  0x0e560b1e,
+  0x0ea4f726,
+  0x0ef39ff2,
+  0x0f4205f4,
+  0x0f90299d,
+  0x0fde0b5d,
+  0x102baba2,
+  0x10790adc,
+  0x10c62975,
+  0x111307db,
+  0x115fa677,
+  0x11ac05b3,
+  0x11f825f7,
+  0x124407ab,
+  0x128fab36,
+  0x12db10fc,
+  0x13263963,
+  0x137124cf,
+  0x13bbd3a1,
+  0x1406463b,
+  0x14507cff,
+  0x149a784c,
+  0x14e43881,
+  0x152dbdfc,
+  0x1577091b,
+  0x15c01a3a,
+  0x1608f1b4,
+  0x16518fe4,
+  0x1699f525,
+  0x16e221ce,
+  0x172a1638,
+  0x1771d2ba,
+  0x17b957ac,
+  0x1800a563,
+  0x1847bc34,
+  0x188e9c73,
+  0x18d54674,
+  0x191bba89,
+  0x1961f905,
+  0x19a80239,
+  0x19edd676,
+  0x1a33760a,
+  0x1a78e147,
+  0x1abe1879,
+  0x1b031bf0,
+  0x1b47ebf7,
+  0x1b8c88dc,
+  0x1bd0f2ea,
+  0x1c152a6c,
+  0x1c592fad,
+  0x1c9d02f7,
+  0x1ce0a492,
+  0x1d2414c8,
+  0x1d6753e0,
+  0x1daa6222,
+  0x1ded3fd4,
+  0x1e2fed3d,
+  0x1e726aa2,
+  0x1eb4b848,
+  0x1ef6d673,
+  0x1f38c568,
+  0x1f7a8569,
+  0x1fbc16b9,
+  0x1ffd799b,
+  0x203eae4f,
+  0x207fb517,
+  0x20c08e34,
+  0x210139e5,
+  0x2141b86a,
+  0x21820a02,
+  0x21c22eeb,
+  0x22022763,
+  0x2241f3a7,
+  0x228193f5,
+  0x22c10889,
+  0x2300519f,
+  0x233f6f72,
+  0x237e623d,
+  0x23bd2a3b,
+  0x23fbc7a6,
+  0x243a3ab7,
+  0x247883a8,
+  0x24b6a2b1,
+  0x24f4980b,
+  0x253263ed,
+  0x2570068e,
+  0x25ad8027,
+  0x25ead0ec,
+  0x2627f914,
+  0x2664f8d5,
+  0x26a1d065,
+  0x26de7ff7,
+  0x271b07c0,
+  0x275767f5,
+  0x2793a0c9,
+  0x27cfb26f,
+  0x280b9d1a,
+  0x284760fd,
+  0x2882fe4a,
+  0x28be7531,
+  0x28f9c5e6,
+  0x2934f098,
+  0x296ff578,
+  0x29aad4b6,
+  0x29e58e83,
+  0x2a20230e,
+  0x2a5a9286,
+  0x2a94dd19,
+  0x2acf02f7,
+  0x2b09044d,
+  0x2b42e149,
+  0x2b7c9a19,
+  0x2bb62eea,
+  0x2bef9fe8,
+  0x2c28ed40,
+  0x2c62171f,
+  0x2c9b1daf,
+  0x2cd4011d,
+  0x2d0cc193,
+  0x2d455f3d,
+  0x2d7dda45,
+  0x2db632d5,
+  0x2dee6918,
+  0x2e267d36,
+  0x2e5e6f5a,
+  0x2e963fad,
+  0x2ecdee56,
+  0x2f057b80,
+  0x2f3ce751,
+  0x2f7431f2,
+  0x2fab5b8b,
+  0x2fe26443,
+  0x30194c41,
+  0x305013ab,
+  0x3086baaa,
+  0x30bd4161,
+  0x30f3a7f9,
+  0x3129ee96,
+  0x3160155e,
+  0x31961c77,
+  0x31cc0404,
+  0x3201cc2c,
+  0x32377512,
+  0x326cfedb,
+  0x32a269ab,
+  0x32d7b5a5,
+  0x330ce2ee,
+  0x3341f1a7,
+  0x3376e1f5,
+  0x33abb3fb,
+  0x33e067da,
+  0x3414fdb5,
+  0x344975ae,
+  0x347dcfe7,
+  0x34b20c82,
+  0x34e62ba0,
+  0x351a2d63,
+  0x354e11eb,
+  0x3581d959,
+  0x35b583ce,
+  0x35e9116a,
+  0x361c824d,
+  0x364fd698,
+  0x36830e69,
+  0x36b629e1,
+  0x36e9291f,
+  0x371c0c41,
+  0x374ed367,
+  0x37817eb0,
+  0x37b40e3a,
+  0x37e68223,
+  0x3818da89,
+  0x384b178b,
+  0x387d3946,
+  0x38af3fd7,
+  0x38e12b5d,
+  0x3912fbf4,
+  0x3944b1b9,
+  0x39764cca,
+  0x39a7cd42,
+  0x39d9333e,
+  0x3a0a7eda,
+  0x3a3bb033,
+  0x3a6cc765,
+  0x3a9dc48b,
+  0x3acea7c0,
+  0x3aff7121,
+  0x3b3020c8,
+  0x3b60b6d1,
+  0x3b913356,
+  0x3bc19673,
+  0x3bf1e041,
+  0x3c2210db,
+  0x3c52285c,
+  0x3c8226dd,
+  0x3cb20c79,
+  0x3ce1d949,
+  0x3d118d67,
+  0x3d4128ec,
+  0x3d70abf2,
+  0x3da01691,
+  0x3dcf68e3,
+  0x3dfea301,
+  0x3e2dc504,
+  0x3e5ccf03,
+  0x3e8bc118,
+  0x3eba9b5a,
+  0x3ee95de2,
+  0x3f1808c8,
+  0x3f469c23,
+  0x3f75180c,
+  0x3fa37c99,
+  0x3fd1c9e3,
+  0x40000000,
 };
@@ -0,0 +1,4104 @@
+/* generated by tools/tablegen.c -- lb 12 32 lerp */
+/* base-2 log values for 1 <= x <= 2 */
+#define KL_LB_BITS  12 /* 2^bits intervals */
+#define KL_LB_FBITS 30 /* fractional bits of an entry */
+#define KL_LB_LERP  1 /* interpolate between entries, rather than take the nearest */
+static const int32_t lb_values[0x1001] = {
+  0x00000000,
+  0x0005c524,
+  0x000b89eb,
+  0x00114e56,
+  0x00171265,
+  0x001cd618,
+  0x0022996f,
+  0x00285c69,
+  0x002e1f08,
+  0x0033e14b,
+  0x0039a331,
+  0x003f64bc,
+  0x004525eb,
+  0x004ae6be,
+  0x0050a736,
+  0x00566752,
+  0x005c2712,
+  0x0061e676,
+  0x0067a57f,
+  0x006d642c,
+  0x0073227e,
+  0x0078e075,
+  0x007e9e10,
+  0x00845b50,
+  0x008a1834,
+  0x008fd4bd,
+  0x009590eb,
+  0x009b4cbe,
+  0x00a10836,
+  0x00a6c352,
+  0x00ac7e14,
+  0x00b2387a,
+  0x00b7f286,
+  0x00bdac36,
+  0x00c3658c,
+  0x00c91e87,
+  0x00ced727,
+  0x00d48f6d,
+  0x00da4758,
+  0x00dffee8,
+  0x00e5b61d,
+  0x00eb6cf8,
+  0x00f12379,
+  0x00f6d99f,
+  0x00fc8f6a,
+  0x010244dc,
+  0x0107f9f3,
+  0x010daeaf,
+  0x01136311,
+  0x0119171a,
+  0x011ecac8,
+  0x01247e1b,
+  0x012a3115,
+  0x012fe3b5,
+  0x013595fb,
+  0x013b47e6,
+  0x0140f978,
+  0x0146aab0,
+  0x014c5b8f,
+  0x01520c13,
+  0x0157bc3e,
+  0x015d6c0f,
+  0x01631b86,
+  0x0168caa4,
+  0x016e7968,
+  0x017427d3,
+  0x0179d5e4,
+  0x017f839c,
+  0x018530fb,
+  0x018ade00,
+  0x01908aac,
+  0x019636fe,
+  0x019be2f7,
+  0x01a18e98,
+  0x01a739df,
+  0x01ace4cd,
+  0x01b28f62,
+  0x01b8399d,
+  0x01bde380,
+  0x01c38d0a,
+  0x01c9363c,
+  0x01cedf14,
+  0x01d48794,
+  0x01da2fba,
+  0x01dfd789,
+  0x01e57efe,
+  0x01eb261b,
+  0x01f0ccdf,
+  0x01f6734b,
+  0x01fc195e,
+  0x0201bf19,
+  0x0207647b,
+  0x020d0985,
+  0x0212ae37,
+  0x02185290,
+  0x021df692,
+  0x02239a3b,
+  0x02293d8b,
+  0x022ee084,
+  0x02348325,
+  0x023a256e,
+  0x023fc75e,
+  0x024568f7,
+  0x024b0a38,
+  0x0250ab21,
+  0x02564bb2,
+  0x025bebeb,
+  0x02618bcd,
+  0x02672b57,
+  0x026cca89,
+  0x02726964,
+  0x027807e7,
+  0x027da613,
+  0x028343e7,
+  0x0288e163,
+  0x028e7e89,
+  0x02941b57,
+  0x0299b7cd,
+  0x029f53ec,
+  0x02a4efb5,
+  0x02aa8b25,
+  0x02b0263f,
+  0x02b5c102,
+  0x02bb5b6d,
+  0x02c0f582,
+  0x02c68f40,
+  0x02cc28a6,
+  0x02d1c1b6,
+  0x02d75a6f,
+  0x02dcf2d1,
+  0x02e28adc,
+  0x02e82290,
+  0x02edb9ee,
+  0x02f350f5,
+  0x02f8e7a6,
+  0x02fe7e00,
+  0x03041403,
+  0x0309a9b0,
+  0x030f3f07,
+  0x0314d407,
+  0x031a68b1,
+  0x031ffd04,
+  0x03259101,
+  0x032b24a8,
+  0x0330b7f8,
+  0x03364af3,
+  0x033bdd97,
+  0x03416fe5,
+  0x034701de,
+  0x034c9380,
+  0x035224cc,
+  0x0357b5c2,
+  0x035d4663,
+  0x0362d6ad,
+  0x036866a2,
+  0x036df641,
+  0x0373858a,
+  0x0379147e,
+  0x037ea31c,
+  0x03843164,
+  0x0389bf57,
+  0x038f4cf4,
+  0x0394da3c,
+  0x039a672f,
+  0x039ff3cc,
+  0x03a58013,
+  0x03ab0c05,
+  0x03b097a2,
+  0x03b622ea,
+  0x03bbaddd,
+  0x03c1387a,
+  0x03c6c2c2,
+  0x03cc4cb6,
+  0x03d1d654,
+  0x03d75f9d,
+  0x03dce891,
+  0x03e27130,
+  0x03e7f97b,
+  0x03ed8170,
+  0x03f30911,
+  0x03f8905d,
+  0x03fe1754,
+  0x04039df7,
+  0x04092445,
+  0x040eaa3e,
+  0x04142fe3,
+  0x0419b533,
+  0x041f3a2f,
+  0x0424bed6,
+  0x042a4329,
+  0x042fc728,
+  0x04354ad2,
+  0x043ace28,
+  0x0440512a,
+  0x0445d3d7,
+  0x044b5630,
+  0x0450d836,
+  0x045659e7,
+  0x045bdb44,
+  0x04615c4d,
+  0x0466dd02,
+  0x046c5d63,
+  0x0471dd70,
+  0x04775d29,
+  0x047cdc8f,
+  0x04825ba1,
+  0x0487da5f,
+  0x048d58c9,
+  0x0492d6e0,
+  0x049854a3,
+  0x049dd212,
+  0x04a34f2e,
+  0x04a8cbf6,
+  0x04ae486b,
+  0x04b3c48d,
+  0x04b9405b,
+  0x04bebbd5,
+  0x04c436fd,
+  0x04c9b1d1,
+  0x04cf2c52,
+  0x04d4a680,
+  0x04da205a,
+  0x04df99e2,
+  0x04e51316,
+  0x04ea8bf7,
+  0x04f00486,
+  0x04f57cc1,
+  0x04faf4a9,
+  0x05006c3f,
+  0x0505e382,
+  0x050b5a71,
+  0x0510d10e,
+  0x05164759,
+  0x051bbd50,
+  0x052132f5,
+  0x0526a848,
+  0x052c1d48,
+  0x053191f5,
+  0x0537064f,
+  0x053c7a58,
+  0x0541ee0e,
+  0x05476171,
+  0x054cd482,
+  0x05524741,
+  0x0557b9ad,
+  0x055d2bc7,
+  0x05629d8f,
+  0x05680f05,
+  0x056d8029,
+  0x0572f0fb,
+  0x0578617a,
+  0x057dd1a8,
+  0x05834183,
+  0x0588b10d,
+  0x058e2045,
+  0x05938f2b,
+  0x0598fdbf,
+  0x059e6c01,
+  0x05a3d9f1,
+  0x05a94790,
+  0x05aeb4dd,
+  0x05b421d9,
+  0x05b98e83,
+  0x05befadb,
+  0x05c466e2,
+  0x05c9d297,
+  0x05cf3dfb,
+  0x05d4a90d,
+  0x05da13ce,
+  0x05df7e3e,
+  0x05e4e85d,
+  0x05ea522a,
+  0x05efbba6,
+  0x05f524d0,
+  0x05fa8daa,
+  0x05fff632,
+  0x06055e6a,
+  0x060ac650,
+  0x06102de5,
+  0x0615952a,
+  0x061afc1d,
+  0x062062c0,
+  0x0625c911,
+  0x062b2f12,
+  0x063094c2,
+  0x0635fa22,
+  0x063b5f30,
+  0x0640c3ee,
+  0x0646285c,
+  0x064b8c78,
+  0x0650f044,
+  0x065653c0,
+  0x065bb6eb,
+  0x066119c6,
+  0x06667c50,
+  0x066bde8a,
+  0x06714073,
+  0x0676a20d,
+  0x067c0356,
+  0x0681644e,
+  0x0686c4f7,
+  0x068c254f,
+  0x06918558,
+  0x0696e510,
+  0x069c4478,
+  0x06a1a390,
+  0x06a70258,
+  0x06ac60d0,
+  0x06b1bef8,
+  0x06b71cd1,
+  0x06bc7a59,
+  0x06c1d792,
+  0x06c7347b,
+  0x06cc9114,
+  0x06d1ed5e,
+  0x06d74958,
+  0x06dca502,
+  0x06e2005d,
+  0x06e75b68,
+  0x06ecb624,
+  0x06f21090,
+  0x06f76aad,
+  0x06fcc47a,
+  0x07021df8,
+  0x07077727,
+  0x070cd006,
+  0x07122897,
+  0x071780d8,
+  0x071cd8c9,
+  0x0722306c,
+  0x072787bf,
+  0x072cdec4,
+  0x07323579,
+  0x07378bdf,
+  0x073ce1f7,
+  0x074237bf,
+  0x07478d39,
+  0x074ce264,
+  0x0752373f,
+  0x07578bcc,
+  0x075ce00b,
+  0x076233fa,
+  0x0767879b,
+  0x076cdaee,
+  0x07722df1,
+  0x077780a6,
+  0x077cd30d,
+  0x07822525,
+  0x078776ee,
+  0x078cc869,
+  0x07921996,
+  0x07976a74,
+  0x079cbb04,
+  0x07a20b46,
+  0x07a75b3a,
+  0x07acaadf,
+  0x07b1fa36,
+  0x07b7493f,
+  0x07bc97f9,
+  0x07c1e666,
+  0x07c73485,
+  0x07cc8255,
+  0x07d1cfd8,
+  0x07d71d0c,
+  0x07dc69f3,
+  0x07e1b68c,
+  0x07e702d7,
+  0x07ec4ed4,
+  0x07f19a84,
+  0x07f6e5e5,
+  0x07fc30f9,
+  0x08017bc0,
+  0x0806c639,
+  0x080c1064,
+  0x08115a41,
+  0x0816a3d1,
+  0x081bed14,
+  0x08213609,
+  0x08267eb1,
+  0x082bc70b,
+  0x08310f18,
+  0x083656d7,
+  0x083b9e4a,
+  0x0840e56f,
+  0x08462c46,
+  0x084b72d1,
+  0x0850b90f,
+  0x0855feff,
+  0x085b44a2,
+  0x086089f9,
+  0x0865cf02,
+  0x086b13be,
+  0x0870582d,
+  0x08759c50,
+  0x087ae025,
+  0x088023ae,
+  0x088566ea,
+  0x088aa9d9,
+  0x088fec7c,
+  0x08952ed1,
+  0x089a70da,
+  0x089fb297,
+  0x08a4f406,
+  0x08aa352a,
+  0x08af7600,
+  0x08b4b68b,
+  0x08b9f6c8,
+  0x08bf36ba,
+  0x08c4765f,
+  0x08c9b5b7,
+  0x08cef4c3,
+  0x08d43383,
+  0x08d971f7,
+  0x08deb01e,
+  0x08e3edfa,
+  0x08e92b89,
+  0x08ee68cc,
+  0x08f3a5c3,
+  0x08f8e26d,
+  0x08fe1ecc,
+  0x09035adf,
+  0x090896a6,
+  0x090dd221,
+  0x09130d50,
+  0x09184833,
+  0x091d82ca,
+  0x0922bd16,
+  0x0927f716,
+  0x092d30ca,
+  0x09326a32,
+  0x0937a34f,
+  0x093cdc20,
+  0x094214a6,
+  0x09474cdf,
+  0x094c84ce,
+  0x0951bc71,
+  0x0956f3c8,
+  0x095c2ad5,
+  0x09616195,
+  0x0966980b,
+  0x096bce35,
+  0x09710413,
+  0x097639a7,
+  0x097b6eef,
+  0x0980a3ec,
+  0x0985d89e,
+  0x098b0d05,
+  0x09904121,
+  0x099574f1,
+  0x099aa877,
+  0x099fdbb1,
+  0x09a50ea1,
+  0x09aa4146,
+  0x09af73a0,
+  0x09b4a5af,
+  0x09b9d773,
+  0x09bf08ec,
+  0x09c43a1b,
+  0x09c96aff,
+  0x09ce9b98,
+  0x09d3cbe7,
+  0x09d8fbeb,
+  0x09de2ba4,
+  0x09e35b13,
+  0x09e88a37,
+  0x09edb911,
+  0x09f2e7a0,
+  0x09f815e5,
+  0x09fd43df,
+  0x0a02718f,
+  0x0a079ef5,
+  0x0a0ccc10,
+  0x0a11f8e1,
+  0x0a172568,
+  0x0a1c51a5,
+  0x0a217d98,
+  0x0a26a940,
+  0x0a2bd49e,
+  0x0a30ffb2,
+  0x0a362a7d,
+  0x0a3b54fd,
+  0x0a407f33,
+  0x0a45a91f,
+  0x0a4ad2c1,
+  0x0a4ffc1a,
+  0x0a552529,
+  0x0a5a4ded,
+  0x0a5f7668,
+  0x0a649e9a,
+  0x0a69c681,
+  0x0a6eee1f,
+  0x0a741573,
+  0x0a793c7e,
+  0x0a7e633f,
+  0x0a8389b6,
+  0x0a88afe4,
+  0x0a8dd5c8,
+  0x0a92fb63,
+  0x0a9820b5,
+  0x0a9d45bd,
+  0x0aa26a7b,
+  0x0aa78ef1,
+  0x0aacb31d,
+  0x0ab1d700,
+  0x0ab6fa99,
+  0x0abc1dea,
+  0x0ac140f1,
+  0x0ac663af,
+  0x0acb8624,
+  0x0ad0a850,
+  0x0ad5ca32,
+  0x0adaebcc,
+  0x0ae00d1d,
+  0x0ae52e25,
+  0x0aea4ee4,
+  0x0aef6f5a,
+  0x0af48f87,
+  0x0af9af6b,
+  0x0afecf07,
+  0x0b03ee5a,
+  0x0b090d64,
+  0x0b0e2c25,
+  0x0b134a9e,
+  0x0b1868ce,
+  0x0b1d86b5,
+  0x0b22a454,
+  0x0b27c1aa,
+  0x0b2cdeb8,
+  0x0b31fb7d,
+  0x0b3717fa,
+  0x0b3c342f,
+  0x0b41501b,
+  0x0b466bbe,
+  0x0b4b871a,
+  0x0b50a22d,
+  0x0b55bcf8,
+  0x0b5ad77a,
+  0x0b5ff1b5,
+  0x0b650ba7,
+  0x0b6a2551,
+  0x0b6f3eb3,
+  0x0b7457cd,
+  0x0b79709f,
+  0x0b7e8929,
+  0x0b83a16a,
+  0x0b88b964,
+  0x0b8dd116,
+  0x0b92e880,
+  0x0b97ffa3,
+  0x0b9d167d,
+  0x0ba22d10,
+  0x0ba7435b,
+  0x0bac595e,
+  0x0bb16f19,
+  0x0bb6848d,
+  0x0bbb99b9,
+  0x0bc0ae9d,
+  0x0bc5c33a,
+  0x0bcad790,
+  0x0bcfeb9e,
+  0x0bd4ff64,
+  0x0bda12e3,
+  0x0bdf261a,
+  0x0be4390a,
+  0x0be94bb3,
+  0x0bee5e14,
+  0x0bf3702e,
+  0x0bf88201,
+  0x0bfd938d,
+  0x0c02a4d1,
+  0x0c07b5ce,
+  0x0c0cc684,
+  0x0c11d6f3,
+  0x0c16e71b,
+  0x0c1bf6fc,
+  0x0c210695,
+  0x0c2615e8,
+  0x0c2b24f4,
+  0x0c3033b9,
+  0x0c354236,
+  0x0c3a506e,
+  0x0c3f5e5e,
+  0x0c446c07,
+  0x0c49796a,
+  0x0c4e8685,
+  0x0c53935a,
+  0x0c589fe9,
+  0x0c5dac31,
+  0x0c62b832,
+  0x0c67c3ec,
+  0x0c6ccf60,
+  0x0c71da8d,
+  0x0c76e574,
+  0x0c7bf014,
+  0x0c80fa6e,
+  0x0c860482,
+  0x0c8b0e4f,
+  0x0c9017d6,
+  0x0c952116,
+  0x0c9a2a10,
+  0x0c9f32c4,
+  0x0ca43b31,
+  0x0ca94359,
+  0x0cae4b3a,
+  0x0cb352d5,
+  0x0cb85a2a,
+  0x0cbd6138,
+  0x0cc26801,
+  0x0cc76e84,
+  0x0ccc74c0,
+  0x0cd17ab7,
+  0x0cd68068,
+  0x0cdb85d3,
+  0x0ce08af8,
+  0x0ce58fd7,
+  0x0cea9470,
+  0x0cef98c3,
+  0x0cf49cd1,
+  0x0cf9a099,
+  0x0cfea41b,
+  0x0d03a758,
+  0x0d08aa4f,
+  0x0d0dad00,
+  0x0d12af6b,
+  0x0d17b192,
+  0x0d1cb372,
+  0x0d21b50d,
+  0x0d26b663,
+  0x0d2bb773,
+  0x0d30b83e,
+  0x0d35b8c3,
+  0x0d3ab903,
+  0x0d3fb8fe,
+  0x0d44b8b3,
+  0x0d49b823,
+  0x0d4eb74e,
+  0x0d53b634,
+  0x0d58b4d4,
+  0x0d5db330,
+  0x0d62b146,
+  0x0d67af17,
+  0x0d6caca3,
+  0x0d71a9ea,
+  0x0d76a6ec,
+  0x0d7ba3a9,
+  0x0d80a021,
+  0x0d859c54,
+  0x0d8a9842,
+  0x0d8f93ec,
+  0x0d948f50,
+  0x0d998a70,
+  0x0d9e854b,
+  0x0da37fe2,
+  0x0da87a33,
+  0x0dad7440,
+  0x0db26e08,
+  0x0db7678c,
+  0x0dbc60cb,
+  0x0dc159c5,
+  0x0dc6527b,
+  0x0dcb4aec,
+  0x0dd04319,
+  0x0dd53b02,
+  0x0dda32a6,
+  0x0ddf2a05,
+  0x0de42120,
+  0x0de917f7,
+  0x0dee0e8a,
+  0x0df304d8,
+  0x0df7fae2,
+  0x0dfcf0a8,
+  0x0e01e629,
+  0x0e06db67,
+  0x0e0bd060,
+  0x0e10c515,
+  0x0e15b987,
+  0x0e1aadb4,
+  0x0e1fa19d,
+  0x0e249542,
+  0x0e2988a3,
+  0x0e2e7bc0,
+  0x0e336e99,
+  0x0e38612e,
+  0x0e3d5380,
+  0x0e42458d,
+  0x0e473757,
+  0x0e4c28dd,
+  0x0e511a20,
+  0x0e560b1e,
+  0x0e5afbd9,
+  0x0e5fec50,
+  0x0e64dc84,
+  0x0e69cc74,
+  0x0e6ebc21,
+  0x0e73ab8a,
+  0x0e789aaf,
+  0x0e7d8991,
+  0x0e82782f,
+  0x0e87668a,
+  0x0e8c54a2,
+  0x0e914276,
+  0x0e963007,
+  0x0e9b1d55,
+  0x0ea00a5f,
+  0x0ea4f726,
+  0x0ea9e3aa,
+  0x0eaecfeb,
+  0x0eb3bbe8,
+  0x0eb8a7a2,
+  0x0ebd9319,
+  0x0ec27e4d,
+  0x0ec7693e,
+  0x0ecc53ec,
+  0x0ed13e57,
+  0x0ed6287f,
+  0x0edb1264,
+  0x0edffc06,
+  0x0ee4e565,
+  0x0ee9ce82,
+  0x0eeeb75b,
+  0x0ef39ff2,
+  0x0ef88846,
+  0x0efd7057,
+  0x0f025825,
+  0x0f073fb1,
+  0x0f0c26fa,
+  0x0f110e00,
+  0x0f15f4c4,
+  0x0f1adb45,
+  0x0f1fc183,
+  0x0f24a77f,
+  0x0f298d39,
+  0x0f2e72b0,
+  0x0f3357e4,
+  0x0f383cd7,
+  0x0f3d2186,
+  0x0f4205f4,
+  0x0f46ea1f,
+  0x0f4bce07,
+  0x0f50b1ae,
+  0x0f559512,
+  0x0f5a7834,
+  0x0f5f5b13,
+  0x0f643db1,
+  0x0f69200c,
+  0x0f6e0225,
+  0x0f72e3fd,
+  0x0f77c592,
+  0x0f7ca6e5,
+  0x0f8187f5,
+  0x0f8668c4,
+  0x0f8b4951,
+  0x0f90299d,
+  0x0f9509a6,
+  0x0f99e96d,
+  0x0f9ec8f2,
+  0x0fa3a836,
+  0x0fa88738,
+  0x0fad65f8,
+  0x0fb24476,
+  0x0fb722b3,
+  0x0fbc00ae,
+  0x0fc0de67,
+  0x0fc5bbde,
+  0x0fca9914,
+  0x0fcf7609,
+  0x0fd452bb,
+  0x0fd92f2d,
+  0x0fde0b5d,
+  0x0fe2e74b,
+  0x0fe7c2f8,
+  0x0fec9e63,
+  0x0ff1798d,
+  0x0ff65476,
+  0x0ffb2f1d,
+  0x10000983,
+  0x1004e3a8,
+  0x1009bd8b,
+  0x100e972d,
+  0x1013708e,
+  0x101849ae,
+  0x101d228d,
+  0x1021fb2a,
+  0x1026d387,
+  0x102baba2,
+  0x1030837d,
+  0x10355b16,
+  0x103a326e,
+  0x103f0986,
+  0x1043e05c,
+  0x1048b6f1,
+  0x104d8d46,
+  0x1052635a,
+  0x1057392d,
+  0x105c0ebf,
+  0x1060e410,
+  0x1065b921,
+  0x106a8df0,
+  0x106f627f,
+  0x107436ce,
+  0x10790adc,
+  0x107ddea9,
+  0x1082b235,
+  0x10878581,
+  0x108c588d,
+  0x10912b58,
+  0x1095fde2,
+  0x109ad02c,
+  0x109fa236,
+  0x10a473ff,
+  0x10a94588,
+  0x10ae16d0,
+  0x10b2e7d8,
+  0x10b7b8a0,
+  0x10bc8927,
+  0x10c1596e,
+  0x10c62975,
+  0x10caf93c,
+  0x10cfc8c3,
+  0x10d49809,
+  0x10d9670f,
+  0x10de35d6,
+  0x10e3045c,
+  0x10e7d2a2,
+  0x10eca0a8,
+  0x10f16e6e,
+  0x10f63bf4,
+  0x10fb093a,
+  0x10ffd640,
+  0x1104a307,
+  0x11096f8d,
+  0x110e3bd4,
+  0x111307db,
+  0x1117d3a2,
+  0x111c9f29,
+  0x11216a71,
+  0x11263579,
+  0x112b0041,
+  0x112fcac9,
+  0x11349512,
+  0x11395f1b,
+  0x113e28e5,
+  0x1142f26f,
+  0x1147bbba,
+  0x114c84c5,
+  0x11514d90,
+  0x1156161d,
+  0x115ade69,
+  0x115fa677,
+  0x11646e45,
+  0x116935d3,
+  0x116dfd23,
+  0x1172c433,
+  0x11778b03,
+  0x117c5195,
+  0x118117e7,
+  0x1185ddfa,
+  0x118aa3ce,
+  0x118f6963,
+  0x11942eb8,
+  0x1198f3cf,
+  0x119db8a6,
+  0x11a27d3f,
+  0x11a74198,
+  0x11ac05b3,
+  0x11b0c98e,
+  0x11b58d2b,
+  0x11ba5088,
+  0x11bf13a7,
+  0x11c3d687,
+  0x11c89928,
+  0x11cd5b8a,
+  0x11d21dad,
+  0x11d6df92,
+  0x11dba138,
+  0x11e0629f,
+  0x11e523c7,
+  0x11e9e4b1,
+  0x11eea55c,
+  0x11f365c9,
+  0x11f825f7,
+  0x11fce5e6,
+  0x1201a597,
+  0x1206650a,
+  0x120b243d,
+  0x120fe333,
+  0x1214a1ea,
+  0x12196062,
+  0x121e1e9d,
+  0x1222dc98,
+  0x12279a56,
+  0x122c57d5,
+  0x12311516,
+  0x1235d219,
+  0x123a8edd,
+  0x123f4b63,
+  0x124407ab,
+  0x1248c3b5,
+  0x124d7f81,
+  0x12523b0e,
+  0x1256f65e,
+  0x125bb16f,
+  0x12606c42,
+  0x126526d8,
+  0x1269e12f,
+  0x126e9b49,
+  0x12735524,
+  0x12780ec2,
+  0x127cc821,
+  0x12818143,
+  0x12863a27,
+  0x128af2cd,
+  0x128fab36,
+  0x12946360,
+  0x12991b4d,
+  0x129dd2fc,
+  0x12a28a6e,
+  0x12a741a2,
+  0x12abf898,
+  0x12b0af50,
+  0x12b565cb,
+  0x12ba1c09,
+  0x12bed208,
+  0x12c387cb,
+  0x12c83d50,
+  0x12ccf297,
+  0x12d1a7a1,
+  0x12d65c6d,
+  0x12db10fc,
+  0x12dfc54e,
+  0x12e47962,
+  0x12e92d39,
+  0x12ede0d3,
+  0x12f29430,
+  0x12f7474f,
+  0x12fbfa31,
+  0x1300acd6,
+  0x13055f3d,
+  0x130a1168,
+  0x130ec355,
+  0x13137505,
+  0x13182678,
+  0x131cd7ae,
+  0x132188a7,
+  0x13263963,
+  0x132ae9e2,
+  0x132f9a25,
+  0x13344a2a,
+  0x1338f9f2,
+  0x133da97d,
+  0x134258cc,
+  0x134707dd,
+  0x134bb6b2,
+  0x1350654a,
+  0x135513a6,
+  0x1359c1c4,
+  0x135e6fa6,
+  0x13631d4b,
+  0x1367cab4,
+  0x136c77df,
+  0x137124cf,
+  0x1375d181,
+  0x137a7df7,
+  0x137f2a31,
+  0x1383d62e,
+  0x138881ee,
+  0x138d2d72,
+  0x1391d8ba,
+  0x139683c5,
+  0x139b2e93,
+  0x139fd926,
+  0x13a4837c,
+  0x13a92d95,
+  0x13add772,
+  0x13b28113,
+  0x13b72a78,
+  0x13bbd3a1,
+  0x13c07c8d,
+  0x13c5253d,
+  0x13c9cdb1,
+  0x13ce75e9,
+  0x13d31de4,
+  0x13d7c5a4,
+  0x13dc6d27,
+  0x13e1146f,
+  0x13e5bb7a,
+  0x13ea624a,
+  0x13ef08dd,
+  0x13f3af34,
+  0x13f85550,
+  0x13fcfb30,
+  0x1401a0d3,
+  0x1406463b,
+  0x140aeb67,
+  0x140f9057,
+  0x1414350c,
+  0x1418d984,
+  0x141d7dc1,
+  0x142221c3,
+  0x1426c588,
+  0x142b6912,
+  0x14300c60,
+  0x1434af73,
+  0x14395249,
+  0x143df4e5,
+  0x14429745,
+  0x14473969,
+  0x144bdb52,
+  0x14507cff,
+  0x14551e71,
+  0x1459bfa7,
+  0x145e60a2,
+  0x14630162,
+  0x1467a1e6,
+  0x146c422f,
+  0x1470e23c,
+  0x1475820e,
+  0x147a21a5,
+  0x147ec101,
+  0x14836021,
+  0x1487ff06,
+  0x148c9db1,
+  0x14913c1f,
+  0x1495da53,
+  0x149a784c,
+  0x149f1609,
+  0x14a3b38c,
+  0x14a850d3,
+  0x14acede0,
+  0x14b18ab1,
+  0x14b62747,
+  0x14bac3a3,
+  0x14bf5fc3,
+  0x14c3fba9,
+  0x14c89754,
+  0x14cd32c4,
+  0x14d1cdf9,
+  0x14d668f3,
+  0x14db03b2,
+  0x14df9e37,
+  0x14e43881,
+  0x14e8d290,
+  0x14ed6c65,
+  0x14f205fe,
+  0x14f69f5e,
+  0x14fb3882,
+  0x14ffd16c,
+  0x15046a1b,
+  0x15090290,
+  0x150d9aca,
+  0x151232ca,
+  0x1516ca8f,
+  0x151b621a,
+  0x151ff96a,
+  0x15249080,
+  0x1529275b,
+  0x152dbdfc,
+  0x15325463,
+  0x1536ea8f,
+  0x153b8081,
+  0x15401639,
+  0x1544abb7,
+  0x154940fa,
+  0x154dd603,
+  0x15526ad2,
+  0x1556ff66,
+  0x155b93c1,
+  0x156027e1,
+  0x1564bbc7,
+  0x15694f73,
+  0x156de2e5,
+  0x1572761d,
+  0x1577091b,
+  0x157b9bdf,
+  0x15802e69,
+  0x1584c0b9,
+  0x158952cf,
+  0x158de4ac,
+  0x1592764e,
+  0x159707b6,
+  0x159b98e5,
+  0x15a029da,
+  0x15a4ba95,
+  0x15a94b16,
+  0x15addb5d,
+  0x15b26b6b,
+  0x15b6fb3f,
+  0x15bb8ad9,
+  0x15c01a3a,
+  0x15c4a961,
+  0x15c9384e,
+  0x15cdc702,
+  0x15d2557c,
+  0x15d6e3bd,
+  0x15db71c4,
+  0x15dfff92,
+  0x15e48d26,
+  0x15e91a81,
+  0x15eda7a2,
+  0x15f2348a,
+  0x15f6c138,
+  0x15fb4dad,
+  0x15ffd9e9,
+  0x160465eb,
+  0x1608f1b4,
+  0x160d7d44,
+  0x1612089a,
+  0x161693b8,
+  0x161b1e9c,
+  0x161fa946,
+  0x162433b8,
+  0x1628bdf1,
+  0x162d47f0,
+  0x1631d1b6,
+  0x16365b43,
+  0x163ae497,
+  0x163f6db2,
+  0x1643f694,
+  0x16487f3d,
+  0x164d07ad,
+  0x16518fe4,
+  0x165617e3,
+  0x165a9fa8,
+  0x165f2734,
+  0x1663ae87,
+  0x166835a2,
+  0x166cbc84,
+  0x1671432d,
+  0x1675c99d,
+  0x167a4fd4,
+  0x167ed5d3,
+  0x16835b99,
+  0x1687e126,
+  0x168c667b,
+  0x1690eb97,
+  0x1695707a,
+  0x1699f525,
+  0x169e7997,
+  0x16a2fdd0,
+  0x16a781d1,
+  0x16ac059a,
+  0x16b08929,
+  0x16b50c81,
+  0x16b98fa0,
+  0x16be1286,
+  0x16c29535,
+  0x16c717aa,
+  0x16cb99e8,
+  0x16d01bed,
+  0x16d49db9,
+  0x16d91f4e,
+  0x16dda0aa,
+  0x16e221ce,
+  0x16e6a2b9,
+  0x16eb236d,
+  0x16efa3e8,
+  0x16f4242b,
+  0x16f8a435,
+  0x16fd2408,
+  0x1701a3a3,
+  0x17062305,
+  0x170aa22f,
+  0x170f2122,
+  0x17139fdc,
+  0x17181e5e,
+  0x171c9ca9,
+  0x17211abb,
+  0x17259895,
+  0x172a1638,
+  0x172e93a2,
+  0x173310d5,
+  0x17378dd0,
+  0x173c0a93,
+  0x1740871e,
+  0x17450371,
+  0x17497f8d,
+  0x174dfb71,
+  0x1752771d,
+  0x1756f291,
+  0x175b6dce,
+  0x175fe8d3,
+  0x176463a0,
+  0x1768de36,
+  0x176d5894,
+  0x1771d2ba,
+  0x17764ca9,
+  0x177ac661,
+  0x177f3fe1,
+  0x1783b929,
+  0x1788323a,
+  0x178cab14,
+  0x179123b6,
+  0x17959c20,
+  0x179a1453,
+  0x179e8c4f,
+  0x17a30414,
+  0x17a77ba1,
+  0x17abf2f7,
+  0x17b06a15,
+  0x17b4e0fc,
+  0x17b957ac,
+  0x17bdce25,
+  0x17c24467,
+  0x17c6ba71,
+  0x17cb3044,
+  0x17cfa5e0,
+  0x17d41b45,
+  0x17d89073,
+  0x17dd056a,
+  0x17e17a29,
+  0x17e5eeb2,
+  0x17ea6304,
+  0x17eed71e,
+  0x17f34b02,
+  0x17f7beaf,
+  0x17fc3224,
+  0x1800a563,
+  0x1805186b,
+  0x18098b3c,
+  0x180dfdd6,
+  0x1812703a,
+  0x1816e266,
+  0x181b545c,
+  0x181fc61b,
+  0x182437a3,
+  0x1828a8f4,
+  0x182d1a0f,
+  0x18318af3,
+  0x1835fba1,
+  0x183a6c17,
+  0x183edc57,
+  0x18434c61,
+  0x1847bc34,
+  0x184c2bd0,
+  0x18509b36,
+  0x18550a65,
+  0x1859795e,
+  0x185de820,
+  0x186256ac,
+  0x1866c501,
+  0x186b3320,
+  0x186fa109,
+  0x18740ebb,
+  0x18787c37,
+  0x187ce97c,
+  0x1881568b,
+  0x1885c364,
+  0x188a3007,
+  0x188e9c73,
+  0x189308a9,
+  0x189774a9,
+  0x189be072,
+  0x18a04c06,
+  0x18a4b763,
+  0x18a9228a,
+  0x18ad8d7b,
+  0x18b1f836,
+  0x18b662bb,
+  0x18bacd09,
+  0x18bf3722,
+  0x18c3a105,
+  0x18c80ab1,
+  0x18cc7428,
+  0x18d0dd69,
+  0x18d54674,
+  0x18d9af49,
+  0x18de17e8,
+  0x18e28051,
+  0x18e6e884,
+  0x18eb5081,
+  0x18efb849,
+  0x18f41fdb,
+  0x18f88737,
+  0x18fcee5d,
+  0x1901554d,
+  0x1905bc08,
+  0x190a228d,
+  0x190e88dd,
+  0x1912eef7,
+  0x191754db,
+  0x191bba89,
+  0x19202002,
+  0x19248545,
+  0x1928ea53,
+  0x192d4f2b,
+  0x1931b3ce,
+  0x1936183b,
+  0x193a7c73,
+  0x193ee075,
+  0x19434442,
+  0x1947a7d9,
+  0x194c0b3b,
+  0x19506e68,
+  0x1954d15f,
+  0x19593421,
+  0x195d96ae,
+  0x1961f905,
+  0x19665b27,
+  0x196abd14,
+  0x196f1ecb,
+  0x1973804e,
+  0x1977e19b,
+  0x197c42b3,
+  0x1980a395,
+  0x19850443,
+  0x198964bc,
+  0x198dc4ff,
+  0x1992250d,
+  0x199684e6,
+  0x199ae48b,
+  0x199f43fa,
+  0x19a3a334,
+  0x19a80239,
+  0x19ac6109,
+  0x19b0bfa5,
+  0x19b51e0b,
+  0x19b97c3c,
+  0x19bdda39,
+  0x19c23800,
+  0x19c69593,
+  0x19caf2f1,
+  0x19cf501a,
+  0x19d3ad0f,
+  0x19d809ce,
+  0x19dc6659,
+  0x19e0c2af,
+  0x19e51ed1,
+  0x19e97abe,
+  0x19edd676,
+  0x19f231f9,
+  0x19f68d48,
+  0x19fae862,
+  0x19ff4347,
+  0x1a039df8,
+  0x1a07f875,
+  0x1a0c52bd,
+  0x1a10acd0,
+  0x1a1506af,
+  0x1a196059,
+  0x1a1db9cf,
+  0x1a221311,
+  0x1a266c1e,
+  0x1a2ac4f6,
+  0x1a2f1d9b,
+  0x1a33760a,
+  0x1a37ce46,
+  0x1a3c264d,
+  0x1a407e20,
+  0x1a44d5bf,
+  0x1a492d29,
+  0x1a4d845f,
+  0x1a51db61,
+  0x1a56322f,
+  0x1a5a88c8,
+  0x1a5edf2e,
+  0x1a63355f,
+  0x1a678b5c,
+  0x1a6be125,
+  0x1a7036ba,
+  0x1a748c1a,
+  0x1a78e147,
+  0x1a7d3640,
+  0x1a818b04,
+  0x1a85df95,
+  0x1a8a33f1,
+  0x1a8e881a,
+  0x1a92dc0f,
+  0x1a972fd0,
+  0x1a9b835d,
+  0x1a9fd6b6,
+  0x1aa429db,
+  0x1aa87ccc,
+  0x1aaccf8a,
+  0x1ab12213,
+  0x1ab57469,
+  0x1ab9c68b,
+  0x1abe1879,
+  0x1ac26a34,
+  0x1ac6bbbb,
+  0x1acb0d0e,
+  0x1acf5e2e,
+  0x1ad3af1a,
+  0x1ad7ffd2,
+  0x1adc5056,
+  0x1ae0a0a7,
+  0x1ae4f0c5,
+  0x1ae940af,
+  0x1aed9065,
+  0x1af1dfe8,
+  0x1af62f37,
+  0x1afa7e53,
+  0x1afecd3b,
+  0x1b031bf0,
+  0x1b076a71,
+  0x1b0bb8bf,
+  0x1b1006da,
+  0x1b1454c1,
+  0x1b18a275,
+  0x1b1ceff6,
+  0x1b213d43,
+  0x1b258a5d,
+  0x1b29d743,
+  0x1b2e23f7,
+  0x1b327077,
+  0x1b36bcc4,
+  0x1b3b08dd,
+  0x1b3f54c4,
+  0x1b43a077,
+  0x1b47ebf7,
+  0x1b4c3744,
+  0x1b50825e,
+  0x1b54cd45,
+  0x1b5917f9,
+  0x1b5d6279,
+  0x1b61acc7,
+  0x1b65f6e2,
+  0x1b6a40c9,
+  0x1b6e8a7e,
+  0x1b72d3ff,
+  0x1b771d4e,
+  0x1b7b666a,
+  0x1b7faf53,
+  0x1b83f809,
+  0x1b88408c,
+  0x1b8c88dc,
+  0x1b90d0f9,
+  0x1b9518e4,
+  0x1b99609c,
+  0x1b9da821,
+  0x1ba1ef73,
+  0x1ba63692,
+  0x1baa7d7f,
+  0x1baec439,
+  0x1bb30ac0,
+  0x1bb75115,
+  0x1bbb9737,
+  0x1bbfdd26,
+  0x1bc422e3,
+  0x1bc8686d,
+  0x1bccadc5,
+  0x1bd0f2ea,
+  0x1bd537dc,
+  0x1bd97c9c,
+  0x1bddc12a,
+  0x1be20585,
+  0x1be649ad,
+  0x1bea8da3,
+  0x1beed167,
+  0x1bf314f8,
+  0x1bf75857,
+  0x1bfb9b83,
+  0x1bffde7d,
+  0x1c042145,
+  0x1c0863da,
+  0x1c0ca63d,
+  0x1c10e86e,
+  0x1c152a6c,
+  0x1c196c38,
+  0x1c1dadd2,
+  0x1c21ef3a,
+  0x1c263070,
+  0x1c2a7173,
+  0x1c2eb244,
+  0x1c32f2e3,
+  0x1c373350,
+  0x1c3b738b,
+  0x1c3fb394,
+  0x1c43f36a,
+  0x1c48330f,
+  0x1c4c7282,
+  0x1c50b1c2,
+  0x1c54f0d1,
+  0x1c592fad,
+  0x1c5d6e58,
+  0x1c61acd0,
+  0x1c65eb17,
+  0x1c6a292c,
+  0x1c6e670f,
+  0x1c72a4c0,
+  0x1c76e23f,
+  0x1c7b1f8c,
+  0x1c7f5ca8,
+  0x1c839992,
+  0x1c87d649,
+  0x1c8c12d0,
+  0x1c904f24,
+  0x1c948b47,
+  0x1c98c738,
+  0x1c9d02f7,
+  0x1ca13e84,
+  0x1ca579e0,
+  0x1ca9b50b,
+  0x1cadf003,
+  0x1cb22aca,
+  0x1cb66560,
+  0x1cba9fc3,
+  0x1cbed9f6,
+  0x1cc313f6,
+  0x1cc74dc6,
+  0x1ccb8763,
+  0x1ccfc0d0,
+  0x1cd3fa0b,
+  0x1cd83314,
+  0x1cdc6bec,
+  0x1ce0a492,
+  0x1ce4dd07,
+  0x1ce9154b,
+  0x1ced4d5d,
+  0x1cf1853e,
+  0x1cf5bcee,
+  0x1cf9f46c,
+  0x1cfe2bba,
+  0x1d0262d5,
+  0x1d0699c0,
+  0x1d0ad079,
+  0x1d0f0701,
+  0x1d133d58,
+  0x1d17737e,
+  0x1d1ba972,
+  0x1d1fdf36,
+  0x1d2414c8,
+  0x1d284a29,
+  0x1d2c7f59,
+  0x1d30b458,
+  0x1d34e926,
+  0x1d391dc3,
+  0x1d3d522f,
+  0x1d41866a,
+  0x1d45ba73,
+  0x1d49ee4c,
+  0x1d4e21f4,
+  0x1d52556b,
+  0x1d5688b1,
+  0x1d5abbc6,
+  0x1d5eeeaa,
+  0x1d63215e,
+  0x1d6753e0,
+  0x1d6b8632,
+  0x1d6fb853,
+  0x1d73ea43,
+  0x1d781c02,
+  0x1d7c4d90,
+  0x1d807eee,
+  0x1d84b01b,
+  0x1d88e117,
+  0x1d8d11e3,
+  0x1d91427e,
+  0x1d9572e8,
+  0x1d99a322,
+  0x1d9dd32b,
+  0x1da20303,
+  0x1da632ab,
+  0x1daa6222,
+  0x1dae9169,
+  0x1db2c07f,
+  0x1db6ef64,
+  0x1dbb1e19,
+  0x1dbf4c9e,
+  0x1dc37af2,
+  0x1dc7a916,
+  0x1dcbd709,
+  0x1dd004cb,
+  0x1dd4325e,
+  0x1dd85fc0,
+  0x1ddc8cf1,
+  0x1de0b9f3,
+  0x1de4e6c3,
+  0x1de91364,
+  0x1ded3fd4,
+  0x1df16c14,
+  0x1df59824,
+  0x1df9c403,
+  0x1dfdefb3,
+  0x1e021b32,
+  0x1e064680,
+  0x1e0a719f,
+  0x1e0e9c8d,
+  0x1e12c74c,
+  0x1e16f1da,
+  0x1e1b1c38,
+  0x1e1f4666,
+  0x1e237064,
+  0x1e279a32,
+  0x1e2bc3cf,
+  0x1e2fed3d,
+  0x1e34167b,
+  0x1e383f88,
+  0x1e3c6866,
+  0x1e409114,
+  0x1e44b992,
+  0x1e48e1e0,
+  0x1e4d09fe,
+  0x1e5131ec,
+  0x1e5559aa,
+  0x1e598138,
+  0x1e5da897,
+  0x1e61cfc5,
+  0x1e65f6c4,
+  0x1e6a1d93,
+  0x1e6e4432,
+  0x1e726aa2,
+  0x1e7690e2,
+  0x1e7ab6f2,
+  0x1e7edcd2,
+  0x1e830283,
+  0x1e872804,
+  0x1e8b4d55,
+  0x1e8f7276,
+  0x1e939768,
+  0x1e97bc2b,
+  0x1e9be0be,
+  0x1ea00521,
+  0x1ea42954,
+  0x1ea84d59,
+  0x1eac712d,
+  0x1eb094d2,
+  0x1eb4b848,
+  0x1eb8db8e,
+  0x1ebcfea5,
+  0x1ec1218c,
+  0x1ec54443,
+  0x1ec966cc,
+  0x1ecd8925,
+  0x1ed1ab4e,
+  0x1ed5cd49,
+  0x1ed9ef13,
+  0x1ede10af,
+  0x1ee2321b,
+  0x1ee65358,
+  0x1eea7466,
+  0x1eee9544,
+  0x1ef2b5f3,
+  0x1ef6d673,
+  0x1efaf6c4,
+  0x1eff16e5,
+  0x1f0336d8,
+  0x1f07569b,
+  0x1f0b762f,
+  0x1f0f9594,
+  0x1f13b4c9,
+  0x1f17d3d0,
+  0x1f1bf2a8,
+  0x1f201150,
+  0x1f242fca,
+  0x1f284e14,
+  0x1f2c6c2f,
+  0x1f308a1c,
+  0x1f34a7d9,
+  0x1f38c568,
+  0x1f3ce2c7,
+  0x1f40fff8,
+  0x1f451cf9,
+  0x1f4939cc,
+  0x1f4d5670,
+  0x1f5172e5,
+  0x1f558f2b,
+  0x1f59ab43,
+  0x1f5dc72b,
+  0x1f61e2e5,
+  0x1f65fe70,
+  0x1f6a19cc,
+  0x1f6e34f9,
+  0x1f724ff8,
+  0x1f766ac8,
+  0x1f7a8569,
+  0x1f7e9fdb,
+  0x1f82ba1f,
+  0x1f86d434,
+  0x1f8aee1b,
+  0x1f8f07d3,
+  0x1f93215c,
+  0x1f973ab7,
+  0x1f9b53e3,
+  0x1f9f6ce0,
+  0x1fa385af,
+  0x1fa79e50,
+  0x1fabb6c2,
+  0x1fafcf05,
+  0x1fb3e71a,
+  0x1fb7ff01,
+  0x1fbc16b9,
+  0x1fc02e43,
+  0x1fc4459e,
+  0x1fc85ccb,
+  0x1fcc73c9,
+  0x1fd08a99,
+  0x1fd4a13b,
+  0x1fd8b7ae,
+  0x1fdccdf3,
+  0x1fe0e40a,
+  0x1fe4f9f3,
+  0x1fe90fad,
+  0x1fed2539,
+  0x1ff13a97,
+  0x1ff54fc6,
+  0x1ff964c7,
+  0x1ffd799b,
+  0x20018e3f,
+  0x2005a2b6,
+  0x2009b6ff,
+  0x200dcb19,
+  0x2011df06,
+  0x2015f2c4,
+  0x201a0654,
+  0x201e19b6,
+  0x20222cea,
+  0x20263ff0,
+  0x202a52c8,
+  0x202e6572,
+  0x203277ef,
+  0x20368a3d,
+  0x203a9c5d,
+  0x203eae4f,
+  0x2042c013,
+  0x2046d1aa,
+  0x204ae312,
+  0x204ef44d,
+  0x20530559,
+  0x20571638,
+  0x205b26e9,
+  0x205f376d,
+  0x206347c2,
+  0x206757ea,
+  0x206b67e4,
+  0x206f77b0,
+  0x2073874e,
+  0x207796bf,
+  0x207ba602,
+  0x207fb517,
+  0x2083c3ff,
+  0x2087d2b9,
+  0x208be145,
+  0x208fefa4,
+  0x2093fdd5,
+  0x20980bd9,
+  0x209c19af,
+  0x20a02757,
+  0x20a434d2,
+  0x20a8421f,
+  0x20ac4f3f,
+  0x20b05c31,
+  0x20b468f6,
+  0x20b8758d,
+  0x20bc81f7,
+  0x20c08e34,
+  0x20c49a43,
+  0x20c8a625,
+  0x20ccb1d9,
+  0x20d0bd60,
+  0x20d4c8b9,
+  0x20d8d3e5,
+  0x20dcdee4,
+  0x20e0e9b6,
+  0x20e4f45a,
+  0x20e8fed1,
+  0x20ed091b,
+  0x20f11337,
+  0x20f51d27,
+  0x20f926e9,
+  0x20fd307d,
+  0x210139e5,
+  0x2105431f,
+  0x21094c2d,
+  0x210d550d,
+  0x21115dc0,
+  0x21156646,
+  0x21196e9f,
+  0x211d76ca,
+  0x21217ec9,
+  0x2125869b,
+  0x21298e3f,
+  0x212d95b7,
+  0x21319d01,
+  0x2135a41f,
+  0x2139ab10,
+  0x213db1d3,
+  0x2141b86a,
+  0x2145bed4,
+  0x2149c511,
+  0x214dcb21,
+  0x2151d104,
+  0x2155d6ba,
+  0x2159dc43,
+  0x215de1a0,
+  0x2161e6d0,
+  0x2165ebd2,
+  0x2169f0a9,
+  0x216df552,
+  0x2171f9cf,
+  0x2175fe1e,
+  0x217a0242,
+  0x217e0638,
+  0x21820a02,
+  0x21860d9f,
+  0x218a110f,
+  0x218e1453,
+  0x2192176a,
+  0x21961a54,
+  0x219a1d12,
+  0x219e1fa3,
+  0x21a22208,
+  0x21a62440,
+  0x21aa264c,
+  0x21ae282b,
+  0x21b229dd,
+  0x21b62b63,
+  0x21ba2cbd,
+  0x21be2dea,
+  0x21c22eeb,
+  0x21c62fbf,
+  0x21ca3067,
+  0x21ce30e2,
+  0x21d23131,
+  0x21d63153,
+  0x21da314a,
+  0x21de3113,
+  0x21e230b1,
+  0x21e63022,
+  0x21ea2f67,
+  0x21ee2e80,
+  0x21f22d6c,
+  0x21f62c2c,
+  0x21fa2ac0,
+  0x21fe2927,
+  0x22022763,
+  0x22062572,
+  0x220a2355,
+  0x220e210c,
+  0x22121e96,
+  0x22161bf5,
+  0x221a1927,
+  0x221e162d,
+  0x22221308,
+  0x22260fb6,
+  0x222a0c38,
+  0x222e088e,
+  0x223204b8,
+  0x223600b5,
+  0x2239fc87,
+  0x223df82d,
+  0x2241f3a7,
+  0x2245eef5,
+  0x2249ea17,
+  0x224de50d,
+  0x2251dfd7,
+  0x2255da76,
+  0x2259d4e8,
+  0x225dcf2f,
+  0x2261c949,
+  0x2265c338,
+  0x2269bcfb,
+  0x226db692,
+  0x2271affe,
+  0x2275a93d,
+  0x2279a251,
+  0x227d9b39,
+  0x228193f5,
+  0x22858c86,
+  0x228984eb,
+  0x228d7d24,
+  0x22917531,
+  0x22956d13,
+  0x229964c9,
+  0x229d5c54,
+  0x22a153b3,
+  0x22a54ae6,
+  0x22a941ee,
+  0x22ad38ca,
+  0x22b12f7a,
+  0x22b525ff,
+  0x22b91c59,
+  0x22bd1287,
+  0x22c10889,
+  0x22c4fe60,
+  0x22c8f40c,
+  0x22cce98c,
+  0x22d0dee0,
+  0x22d4d409,
+  0x22d8c907,
+  0x22dcbdd9,
+  0x22e0b280,
+  0x22e4a6fc,
+  0x22e89b4c,
+  0x22ec8f71,
+  0x22f0836a,
+  0x22f47738,
+  0x22f86adb,
+  0x22fc5e53,
+  0x2300519f,
+  0x230444c0,
+  0x230837b6,
+  0x230c2a80,
+  0x23101d20,
+  0x23140f94,
+  0x231801dd,
+  0x231bf3fa,
+  0x231fe5ed,
+  0x2323d7b5,
+  0x2327c951,
+  0x232bbac2,
+  0x232fac08,
+  0x23339d23,
+  0x23378e13,
+  0x233b7ed8,
+  0x233f6f72,
+  0x23435fe1,
+  0x23475025,
+  0x234b403d,
+  0x234f302b,
+  0x23531fee,
+  0x23570f86,
+  0x235afef3,
+  0x235eee35,
+  0x2362dd4c,
+  0x2366cc38,
+  0x236abaf9,
+  0x236ea990,
+  0x237297fb,
+  0x2376863c,
+  0x237a7452,
+  0x237e623d,
+  0x23824ffd,
+  0x23863d93,
+  0x238a2afe,
+  0x238e183e,
+  0x23920553,
+  0x2395f23d,
+  0x2399defd,
+  0x239dcb92,
+  0x23a1b7fd,
+  0x23a5a43c,
+  0x23a99051,
+  0x23ad7c3c,
+  0x23b167fc,
+  0x23b55391,
+  0x23b93efb,
+  0x23bd2a3b,
+  0x23c11551,
+  0x23c5003b,
+  0x23c8eafc,
+  0x23ccd591,
+  0x23d0bffd,
+  0x23d4aa3d,
+  0x23d89454,
+  0x23dc7e3f,
+  0x23e06801,
+  0x23e45198,
+  0x23e83b04,
+  0x23ec2446,
+  0x23f00d5e,
+  0x23f3f64b,
+  0x23f7df0e,
+  0x23fbc7a6,
+  0x23ffb014,
+  0x24039858,
+  0x24078071,
+  0x240b6861,
+  0x240f5025,
+  0x241337c0,
+  0x24171f30,
+  0x241b0676,
+  0x241eed92,
+  0x2422d484,
+  0x2426bb4b,
+  0x242aa1e8,
+  0x242e885b,
+  0x24326ea4,
+  0x243654c3,
+  0x243a3ab7,
+  0x243e2082,
+  0x24420622,
+  0x2445eb98,
+  0x2449d0e4,
+  0x244db607,
+  0x24519aff,
+  0x24557fcc,
+  0x24596470,
+  0x245d48ea,
+  0x24612d3a,
+  0x24651160,
+  0x2468f55c,
+  0x246cd92e,
+  0x2470bcd6,
+  0x2474a054,
+  0x247883a8,
+  0x247c66d3,
+  0x248049d3,
+  0x24842ca9,
+  0x24880f56,
+  0x248bf1d9,
+  0x248fd432,
+  0x2493b661,
+  0x24979866,
+  0x249b7a42,
+  0x249f5bf4,
+  0x24a33d7c,
+  0x24a71eda,
+  0x24ab000e,
+  0x24aee119,
+  0x24b2c1fa,
+  0x24b6a2b1,
+  0x24ba833f,
+  0x24be63a3,
+  0x24c243dd,
+  0x24c623ee,
+  0x24ca03d5,
+  0x24cde393,
+  0x24d1c326,
+  0x24d5a291,
+  0x24d981d1,
+  0x24dd60e8,
+  0x24e13fd6,
+  0x24e51e9a,
+  0x24e8fd35,
+  0x24ecdba6,
+  0x24f0b9ed,
+  0x24f4980b,
+  0x24f87600,
+  0x24fc53cb,
+  0x2500316c,
+  0x25040ee5,
+  0x2507ec33,
+  0x250bc959,
+  0x250fa655,
+  0x25138327,
+  0x25175fd1,
+  0x251b3c51,
+  0x251f18a7,
+  0x2522f4d5,
+  0x2526d0d9,
+  0x252aacb3,
+  0x252e8865,
+  0x253263ed,
+  0x25363f4c,
+  0x253a1a82,
+  0x253df58e,
+  0x2541d071,
+  0x2545ab2b,
+  0x254985bc,
+  0x254d6024,
+  0x25513a62,
+  0x25551478,
+  0x2558ee64,
+  0x255cc827,
+  0x2560a1c1,
+  0x25647b32,
+  0x2568547a,
+  0x256c2d99,
+  0x2570068e,
+  0x2573df5b,
+  0x2577b7ff,
+  0x257b907a,
+  0x257f68cb,
+  0x258340f4,
+  0x258718f4,
+  0x258af0ca,
+  0x258ec878,
+  0x25929ffd,
+  0x25967759,
+  0x259a4e8c,
+  0x259e2596,
+  0x25a1fc78,
+  0x25a5d330,
+  0x25a9a9c0,
+  0x25ad8027,
+  0x25b15665,
+  0x25b52c7a,
+  0x25b90266,
+  0x25bcd82a,
+  0x25c0adc4,
+  0x25c48336,
+  0x25c85880,
+  0x25cc2da0,
+  0x25d00298,
+  0x25d3d767,
+  0x25d7ac0e,
+  0x25db808b,
+  0x25df54e0,
+  0x25e3290d,
+  0x25e6fd11,
+  0x25ead0ec,
+  0x25eea49e,
+  0x25f27828,
+  0x25f64b8a,
+  0x25fa1ec3,
+  0x25fdf1d3,
+  0x2601c4ba,
+  0x2605977a,
+  0x26096a10,
+  0x260d3c7e,
+  0x26110ec4,
+  0x2614e0e1,
+  0x2618b2d6,
+  0x261c84a2,
+  0x26205646,
+  0x262427c1,
+  0x2627f914,
+  0x262bca3f,
+  0x262f9b41,
+  0x26336c1b,
+  0x26373ccc,
+  0x263b0d55,
+  0x263eddb6,
+  0x2642adee,
+  0x26467dfe,
+  0x264a4de6,
+  0x264e1da6,
+  0x2651ed3d,
+  0x2655bcac,
+  0x26598bf3,
+  0x265d5b11,
+  0x26612a07,
+  0x2664f8d5,
+  0x2668c77b,
+  0x266c95f9,
+  0x2670644e,
+  0x2674327c,
+  0x26780081,
+  0x267bce5e,
+  0x267f9c13,
+  0x268369a0,
+  0x26873705,
+  0x268b0441,
+  0x268ed156,
+  0x26929e43,
+  0x26966b07,
+  0x269a37a4,
+  0x269e0418,
+  0x26a1d065,
+  0x26a59c89,
+  0x26a96886,
+  0x26ad345a,
+  0x26b10007,
+  0x26b4cb8c,
+  0x26b896e8,
+  0x26bc621d,
+  0x26c02d2a,
+  0x26c3f80f,
+  0x26c7c2cc,
+  0x26cb8d62,
+  0x26cf57cf,
+  0x26d32215,
+  0x26d6ec33,
+  0x26dab629,
+  0x26de7ff7,
+  0x26e2499d,
+  0x26e6131c,
+  0x26e9dc73,
+  0x26eda5a2,
+  0x26f16ea9,
+  0x26f53789,
+  0x26f90041,
+  0x26fcc8d1,
+  0x2700913a,
+  0x2704597b,
+  0x27082194,
+  0x270be986,
+  0x270fb150,
+  0x271378f2,
+  0x2717406d,
+  0x271b07c0,
+  0x271eceec,
+  0x272295f0,
+  0x27265ccd,
+  0x272a2382,
+  0x272dea0f,
+  0x2731b075,
+  0x273576b3,
+  0x27393cca,
+  0x273d02ba,
+  0x2740c882,
+  0x27448e22,
+  0x2748539b,
+  0x274c18ed,
+  0x274fde17,
+  0x2753a31a,
+  0x275767f5,
+  0x275b2ca9,
+  0x275ef136,
+  0x2762b59b,
+  0x276679d9,
+  0x276a3df0,
+  0x276e01df,
+  0x2771c5a7,
+  0x27758948,
+  0x27794cc2,
+  0x277d1014,
+  0x2780d33f,
+  0x27849642,
+  0x2788591f,
+  0x278c1bd4,
+  0x278fde62,
+  0x2793a0c9,
+  0x27976309,
+  0x279b2521,
+  0x279ee713,
+  0x27a2a8dd,
+  0x27a66a80,
+  0x27aa2bfc,
+  0x27aded51,
+  0x27b1ae7f,
+  0x27b56f85,
+  0x27b93065,
+  0x27bcf11e,
+  0x27c0b1af,
+  0x27c4721a,
+  0x27c8325d,
+  0x27cbf27a,
+  0x27cfb26f,
+  0x27d3723e,
+  0x27d731e5,
+  0x27daf166,
+  0x27deb0c0,
+  0x27e26ff2,
+  0x27e62efe,
+  0x27e9ede3,
+  0x27edaca1,
+  0x27f16b38,
+  0x27f529a8,
+  0x27f8e7f2,
+  0x27fca614,
+  0x28006410,
+  0x280421e5,
+  0x2807df93,
+  0x280b9d1a,
+  0x280f5a7b,
+  0x281317b5,
+  0x2816d4c8,
+  0x281a91b4,
+  0x281e4e79,
+  0x28220b18,
+  0x2825c790,
+  0x282983e2,
+  0x282d400c,
+  0x2830fc10,
+  0x2834b7ee,
+  0x283873a5,
+  0x283c2f35,
+  0x283fea9e,
+  0x2843a5e1,
+  0x284760fd,
+  0x284b1bf3,
+  0x284ed6c2,
+  0x2852916a,
+  0x28564bec,
+  0x285a0648,
+  0x285dc07d,
+  0x28617a8b,
+  0x28653473,
+  0x2868ee34,
+  0x286ca7cf,
+  0x28706144,
+  0x28741a92,
+  0x2877d3b9,
+  0x287b8cbb,
+  0x287f4595,
+  0x2882fe4a,
+  0x2886b6d7,
+  0x288a6f3f,
+  0x288e2780,
+  0x2891df9b,
+  0x2895978f,
+  0x28994f5e,
+  0x289d0705,
+  0x28a0be87,
+  0x28a475e2,
+  0x28a82d17,
+  0x28abe426,
+  0x28af9b0e,
+  0x28b351d0,
+  0x28b7086c,
+  0x28babee2,
+  0x28be7531,
+  0x28c22b5b,
+  0x28c5e15e,
+  0x28c9973b,
+  0x28cd4cf1,
+  0x28d10282,
+  0x28d4b7ec,
+  0x28d86d31,
+  0x28dc224f,
+  0x28dfd747,
+  0x28e38c19,
+  0x28e740c5,
+  0x28eaf54b,
+  0x28eea9aa,
+  0x28f25de4,
+  0x28f611f8,
+  0x28f9c5e6,
+  0x28fd79ad,
+  0x29012d4f,
+  0x2904e0cb,
+  0x29089420,
+  0x290c4750,
+  0x290ffa5a,
+  0x2913ad3e,
+  0x29175ffc,
+  0x291b1294,
+  0x291ec506,
+  0x29227752,
+  0x29262979,
+  0x2929db79,
+  0x292d8d54,
+  0x29313f09,
+  0x2934f098,
+  0x2938a201,
+  0x293c5344,
+  0x29400462,
+  0x2943b559,
+  0x2947662b,
+  0x294b16d8,
+  0x294ec75e,
+  0x295277bf,
+  0x295627fa,
+  0x2959d80f,
+  0x295d87ff,
+  0x296137c9,
+  0x2964e76d,
+  0x296896ec,
+  0x296c4645,
+  0x296ff578,
+  0x2973a485,
+  0x2977536d,
+  0x297b0230,
+  0x297eb0cd,
+  0x29825f44,
+  0x29860d96,
+  0x2989bbc2,
+  0x298d69c8,
+  0x299117a9,
+  0x2994c565,
+  0x299872fb,
+  0x299c206b,
+  0x299fcdb6,
+  0x29a37adc,
+  0x29a727dc,
+  0x29aad4b6,
+  0x29ae816c,
+  0x29b22dfb,
+  0x29b5da66,
+  0x29b986aa,
+  0x29bd32ca,
+  0x29c0dec4,
+  0x29c48a99,
+  0x29c83648,
+  0x29cbe1d2,
+  0x29cf8d37,
+  0x29d33876,
+  0x29d6e390,
+  0x29da8e85,
+  0x29de3954,
+  0x29e1e3fe,
+  0x29e58e83,
+  0x29e938e3,
+  0x29ece31d,
+  0x29f08d32,
+  0x29f43722,
+  0x29f7e0ed,
+  0x29fb8a93,
+  0x29ff3413,
+  0x2a02dd6e,
+  0x2a0686a4,
+  0x2a0a2fb5,
+  0x2a0dd8a0,
+  0x2a118167,
+  0x2a152a08,
+  0x2a18d285,
+  0x2a1c7adc,
+  0x2a20230e,
+  0x2a23cb1b,
+  0x2a277303,
+  0x2a2b1ac6,
+  0x2a2ec264,
+  0x2a3269dd,
+  0x2a361131,
+  0x2a39b860,
+  0x2a3d5f69,
+  0x2a41064e,
+  0x2a44ad0e,
+  0x2a4853a9,
+  0x2a4bfa1f,
+  0x2a4fa070,
+  0x2a53469c,
+  0x2a56eca3,
+  0x2a5a9286,
+  0x2a5e3843,
+  0x2a61dddc,
+  0x2a65834f,
+  0x2a69289e,
+  0x2a6ccdc8,
+  0x2a7072cd,
+  0x2a7417ae,
+  0x2a77bc69,
+  0x2a7b6100,
+  0x2a7f0572,
+  0x2a82a9bf,
+  0x2a864de7,
+  0x2a89f1eb,
+  0x2a8d95ca,
+  0x2a913984,
+  0x2a94dd19,
+  0x2a98808a,
+  0x2a9c23d6,
+  0x2a9fc6fd,
+  0x2aa36a00,
+  0x2aa70cde,
+  0x2aaaaf97,
+  0x2aae522c,
+  0x2ab1f49c,
+  0x2ab596e7,
+  0x2ab9390e,
+  0x2abcdb10,
+  0x2ac07cee,
+  0x2ac41ea7,
+  0x2ac7c03c,
+  0x2acb61ac,
+  0x2acf02f7,
+  0x2ad2a41e,
+  0x2ad64520,
+  0x2ad9e5fe,
+  0x2add86b8,
+  0x2ae1274c,
+  0x2ae4c7bd,
+  0x2ae86809,
+  0x2aec0830,
+  0x2aefa833,
+  0x2af34812,
+  0x2af6e7cc,
+  0x2afa8762,
+  0x2afe26d3,
+  0x2b01c620,
+  0x2b056549,
+  0x2b09044d,
+  0x2b0ca32d,
+  0x2b1041e9,
+  0x2b13e080,
+  0x2b177ef3,
+  0x2b1b1d42,
+  0x2b1ebb6c,
+  0x2b225972,
+  0x2b25f754,
+  0x2b299511,
+  0x2b2d32ab,
+  0x2b30d020,
+  0x2b346d70,
+  0x2b380a9d,
+  0x2b3ba7a5,
+  0x2b3f4489,
+  0x2b42e149,
+  0x2b467de5,
+  0x2b4a1a5d,
+  0x2b4db6b0,
+  0x2b5152e0,
+  0x2b54eeeb,
+  0x2b588ad2,
+  0x2b5c2695,
+  0x2b5fc234,
+  0x2b635daf,
+  0x2b66f906,
+  0x2b6a9438,
+  0x2b6e2f47,
+  0x2b71ca32,
+  0x2b7564f8,
+  0x2b78ff9b,
+  0x2b7c9a19,
+  0x2b803474,
+  0x2b83ceab,
+  0x2b8768bd,
+  0x2b8b02ac,
+  0x2b8e9c76,
+  0x2b92361d,
+  0x2b95cfa0,
+  0x2b9968ff,
+  0x2b9d023a,
+  0x2ba09b51,
+  0x2ba43444,
+  0x2ba7cd13,
+  0x2bab65bf,
+  0x2baefe46,
+  0x2bb296aa,
+  0x2bb62eea,
+  0x2bb9c706,
+  0x2bbd5efe,
+  0x2bc0f6d3,
+  0x2bc48e84,
+  0x2bc82611,
+  0x2bcbbd7a,
+  0x2bcf54bf,
+  0x2bd2ebe1,
+  0x2bd682df,
+  0x2bda19b9,
+  0x2bddb06f,
+  0x2be14702,
+  0x2be4dd71,
+  0x2be873bc,
+  0x2bec09e4,
+  0x2bef9fe8,
+  0x2bf335c9,
+  0x2bf6cb85,
+  0x2bfa611f,
+  0x2bfdf694,
+  0x2c018be6,
+  0x2c052114,
+  0x2c08b61f,
+  0x2c0c4b06,
+  0x2c0fdfca,
+  0x2c13746a,
+  0x2c1708e7,
+  0x2c1a9d3f,
+  0x2c1e3175,
+  0x2c21c587,
+  0x2c255975,
+  0x2c28ed40,
+  0x2c2c80e8,
+  0x2c30146c,
+  0x2c33a7cd,
+  0x2c373b0a,
+  0x2c3ace23,
+  0x2c3e611a,
+  0x2c41f3ed,
+  0x2c45869c,
+  0x2c491928,
+  0x2c4cab91,
+  0x2c503dd6,
+  0x2c53cff8,
+  0x2c5761f7,
+  0x2c5af3d2,
+  0x2c5e858a,
+  0x2c62171f,
+  0x2c65a890,
+  0x2c6939de,
+  0x2c6ccb09,
+  0x2c705c10,
+  0x2c73ecf5,
+  0x2c777db6,
+  0x2c7b0e53,
+  0x2c7e9ece,
+  0x2c822f25,
+  0x2c85bf59,
+  0x2c894f6a,
+  0x2c8cdf58,
+  0x2c906f22,
+  0x2c93feca,
+  0x2c978e4e,
+  0x2c9b1daf,
+  0x2c9eaced,
+  0x2ca23c08,
+  0x2ca5caff,
+  0x2ca959d4,
+  0x2cace885,
+  0x2cb07714,
+  0x2cb4057f,
+  0x2cb793c7,
+  0x2cbb21ed,
+  0x2cbeafef,
+  0x2cc23dce,
+  0x2cc5cb8a,
+  0x2cc95923,
+  0x2ccce699,
+  0x2cd073ec,
+  0x2cd4011d,
+  0x2cd78e2a,
+  0x2cdb1b14,
+  0x2cdea7db,
+  0x2ce23480,
+  0x2ce5c101,
+  0x2ce94d60,
+  0x2cecd99b,
+  0x2cf065b4,
+  0x2cf3f1aa,
+  0x2cf77d7d,
+  0x2cfb092d,
+  0x2cfe94ba,
+  0x2d022025,
+  0x2d05ab6c,
+  0x2d093691,
+  0x2d0cc193,
+  0x2d104c72,
+  0x2d13d72e,
+  0x2d1761c8,
+  0x2d1aec3f,
+  0x2d1e7693,
+  0x2d2200c4,
+  0x2d258ad3,
+  0x2d2914bf,
+  0x2d2c9e88,
+  0x2d30282e,
+  0x2d33b1b2,
+  0x2d373b13,
+  0x2d3ac451,
+  0x2d3e4d6d,
+  0x2d41d666,
+  0x2d455f3d,
+  0x2d48e7f1,
+  0x2d4c7082,
+  0x2d4ff8f0,
+  0x2d53813c,
+  0x2d570966,
+  0x2d5a916c,
+  0x2d5e1951,
+  0x2d61a112,
+  0x2d6528b1,
+  0x2d68b02e,
+  0x2d6c3788,
+  0x2d6fbec0,
+  0x2d7345d5,
+  0x2d76ccc7,
+  0x2d7a5397,
+  0x2d7dda45,
+  0x2d8160d0,
+  0x2d84e738,
+  0x2d886d7f,
+  0x2d8bf3a2,
+  0x2d8f79a4,
+  0x2d92ff82,
+  0x2d96853f,
+  0x2d9a0ad9,
+  0x2d9d9051,
+  0x2da115a6,
+  0x2da49ad9,
+  0x2da81fea,
+  0x2daba4d8,
+  0x2daf29a4,
+  0x2db2ae4e,
+  0x2db632d5,
+  0x2db9b73a,
+  0x2dbd3b7d,
+  0x2dc0bf9d,
+  0x2dc4439b,
+  0x2dc7c777,
+  0x2dcb4b31,
+  0x2dcecec8,
+  0x2dd2523d,
+  0x2dd5d590,
+  0x2dd958c1,
+  0x2ddcdbd0,
+  0x2de05ebc,
+  0x2de3e186,
+  0x2de7642e,
+  0x2deae6b4,
+  0x2dee6918,
+  0x2df1eb59,
+  0x2df56d78,
+  0x2df8ef76,
+  0x2dfc7151,
+  0x2dfff30a,
+  0x2e0374a1,
+  0x2e06f616,
+  0x2e0a7769,
+  0x2e0df89a,
+  0x2e1179a8,
+  0x2e14fa95,
+  0x2e187b60,
+  0x2e1bfc08,
+  0x2e1f7c8f,
+  0x2e22fcf4,
+  0x2e267d36,
+  0x2e29fd57,
+  0x2e2d7d56,
+  0x2e30fd32,
+  0x2e347ced,
+  0x2e37fc86,
+  0x2e3b7bfd,
+  0x2e3efb52,
+  0x2e427a85,
+  0x2e45f996,
+  0x2e497885,
+  0x2e4cf753,
+  0x2e5075fe,
+  0x2e53f488,
+  0x2e5772f0,
+  0x2e5af136,
+  0x2e5e6f5a,
+  0x2e61ed5d,
+  0x2e656b3d,
+  0x2e68e8fc,
+  0x2e6c6699,
+  0x2e6fe414,
+  0x2e73616d,
+  0x2e76dea5,
+  0x2e7a5bbb,
+  0x2e7dd8af,
+  0x2e815582,
+  0x2e84d232,
+  0x2e884ec1,
+  0x2e8bcb2f,
+  0x2e8f477a,
+  0x2e92c3a4,
+  0x2e963fad,
+  0x2e99bb93,
+  0x2e9d3758,
+  0x2ea0b2fc,
+  0x2ea42e7d,
+  0x2ea7a9dd,
+  0x2eab251c,
+  0x2eaea039,
+  0x2eb21b34,
+  0x2eb5960e,
+  0x2eb910c6,
+  0x2ebc8b5c,
+  0x2ec005d1,
+  0x2ec38025,
+  0x2ec6fa57,
+  0x2eca7467,
+  0x2ecdee56,
+  0x2ed16824,
+  0x2ed4e1d0,
+  0x2ed85b5a,
+  0x2edbd4c3,
+  0x2edf4e0b,
+  0x2ee2c731,
+  0x2ee64035,
+  0x2ee9b919,
+  0x2eed31da,
+  0x2ef0aa7b,
+  0x2ef422fa,
+  0x2ef79b57,
+  0x2efb1393,
+  0x2efe8bae,
+  0x2f0203a8,
+  0x2f057b80,
+  0x2f08f336,
+  0x2f0c6acc,
+  0x2f0fe240,
+  0x2f135993,
+  0x2f16d0c4,
+  0x2f1a47d4,
+  0x2f1dbec3,
+  0x2f213591,
+  0x2f24ac3d,
+  0x2f2822c8,
+  0x2f2b9932,
+  0x2f2f0f7b,
+  0x2f3285a2,
+  0x2f35fba8,
+  0x2f39718d,
+  0x2f3ce751,
+  0x2f405cf4,
+  0x2f43d275,
+  0x2f4747d5,
+  0x2f4abd14,
+  0x2f4e3232,
+  0x2f51a72f,
+  0x2f551c0b,
+  0x2f5890c5,
+  0x2f5c055f,
+  0x2f5f79d7,
+  0x2f62ee2e,
+  0x2f666264,
+  0x2f69d67a,
+  0x2f6d4a6e,
+  0x2f70be40,
+  0x2f7431f2,
+  0x2f77a583,
+  0x2f7b18f3,
+  0x2f7e8c42,
+  0x2f81ff70,
+  0x2f85727d,
+  0x2f88e569,
+  0x2f8c5833,
+  0x2f8fcadd,
+  0x2f933d66,
+  0x2f96afce,
+  0x2f9a2216,
+  0x2f9d943c,
+  0x2fa10641,
+  0x2fa47825,
+  0x2fa7e9e9,
+  0x2fab5b8b,
+  0x2faecd0d,
+  0x2fb23e6e,
+  0x2fb5afae,
+  0x2fb920cd,
+  0x2fbc91cb,
+  0x2fc002a8,
+  0x2fc37365,
+  0x2fc6e401,
+  0x2fca547c,
+  0x2fcdc4d6,
+  0x2fd1350f,
+  0x2fd4a528,
+  0x2fd81520,
+  0x2fdb84f7,
+  0x2fdef4ad,
+  0x2fe26443,
+  0x2fe5d3b8,
+  0x2fe9430c,
+  0x2fecb240,
+  0x2ff02152,
+  0x2ff39044,
+  0x2ff6ff16,
+  0x2ffa6dc7,
+  0x2ffddc57,
+  0x30014ac6,
+  0x3004b915,
+  0x30082743,
+  0x300b9551,
+  0x300f033e,
+  0x3012710a,
+  0x3015deb6,
+  0x30194c41,
+  0x301cb9ab,
+  0x302026f5,
+  0x3023941f,
+  0x30270128,
+  0x302a6e10,
+  0x302ddad8,
+  0x3031477f,
+  0x3034b406,
+  0x3038206c,
+  0x303b8cb2,
+  0x303ef8d8,
+  0x304264dd,
+  0x3045d0c1,
+  0x30493c85,
+  0x304ca828,
+  0x305013ab,
+  0x30537f0e,
+  0x3056ea50,
+  0x305a5572,
+  0x305dc074,
+  0x30612b55,
+  0x30649615,
+  0x306800b6,
+  0x306b6b36,
+  0x306ed595,
+  0x30723fd5,
+  0x3075a9f4,
+  0x307913f2,
+  0x307c7dd0,
+  0x307fe78e,
+  0x3083512c,
+  0x3086baaa,
+  0x308a2407,
+  0x308d8d44,
+  0x3090f660,
+  0x30945f5d,
+  0x3097c839,
+  0x309b30f5,
+  0x309e9990,
+  0x30a2020c,
+  0x30a56a67,
+  0x30a8d2a2,
+  0x30ac3abd,
+  0x30afa2b8,
+  0x30b30a93,
+  0x30b6724d,
+  0x30b9d9e7,
+  0x30bd4161,
+  0x30c0a8bb,
+  0x30c40ff5,
+  0x30c7770f,
+  0x30cade09,
+  0x30ce44e2,
+  0x30d1ab9c,
+  0x30d51235,
+  0x30d878af,
+  0x30dbdf08,
+  0x30df4542,
+  0x30e2ab5b,
+  0x30e61154,
+  0x30e9772d,
+  0x30ecdce6,
+  0x30f04280,
+  0x30f3a7f9,
+  0x30f70d52,
+  0x30fa728c,
+  0x30fdd7a5,
+  0x31013c9e,
+  0x3104a178,
+  0x31080631,
+  0x310b6acb,
+  0x310ecf44,
+  0x3112339e,
+  0x311597d8,
+  0x3118fbf2,
+  0x311c5fec,
+  0x311fc3c6,
+  0x31232781,
+  0x31268b1b,
+  0x3129ee96,
+  0x312d51f1,
+  0x3130b52c,
+  0x31341847,
+  0x31377b43,
+  0x313ade1e,
+  0x313e40da,
+  0x3141a376,
+  0x314505f2,
+  0x3148684f,
+  0x314bca8c,
+  0x314f2ca9,
+  0x31528ea6,
+  0x3155f084,
+  0x31595242,
+  0x315cb3e0,
+  0x3160155e,
+  0x316376bd,
+  0x3166d7fc,
+  0x316a391c,
+  0x316d9a1b,
+  0x3170fafb,
+  0x31745bbc,
+  0x3177bc5d,
+  0x317b1cde,
+  0x317e7d40,
+  0x3181dd82,
+  0x31853da4,
+  0x31889da7,
+  0x318bfd8a,
+  0x318f5d4e,
+  0x3192bcf2,
+  0x31961c77,
+  0x31997bdc,
+  0x319cdb21,
+  0x31a03a47,
+  0x31a3994e,
+  0x31a6f835,
+  0x31aa56fc,
+  0x31adb5a4,
+  0x31b1142c,
+  0x31b47295,
+  0x31b7d0df,
+  0x31bb2f09,
+  0x31be8d14,
+  0x31c1eaff,
+  0x31c548cb,
+  0x31c8a677,
+  0x31cc0404,
+  0x31cf6172,
+  0x31d2bec0,
+  0x31d61bef,
+  0x31d978fe,
+  0x31dcd5ee,
+  0x31e032bf,
+  0x31e38f71,
+  0x31e6ec03,
+  0x31ea4875,
+  0x31eda4c9,
+  0x31f100fd,
+  0x31f45d12,
+  0x31f7b907,
+  0x31fb14dd,
+  0x31fe7094,
+  0x3201cc2c,
+  0x320527a4,
+  0x320882fe,
+  0x320bde38,
+  0x320f3952,
+  0x3212944e,
+  0x3215ef2a,
+  0x321949e7,
+  0x321ca485,
+  0x321fff04,
+  0x32235963,
+  0x3226b3a4,
+  0x322a0dc5,
+  0x322d67c7,
+  0x3230c1aa,
+  0x32341b6e,
+  0x32377512,
+  0x323ace98,
+  0x323e27fe,
+  0x32418146,
+  0x3244da6e,
+  0x32483377,
+  0x324b8c61,
+  0x324ee52c,
+  0x32523dd8,
+  0x32559665,
+  0x3258eed3,
+  0x325c4722,
+  0x325f9f52,
+  0x3262f763,
+  0x32664f54,
+  0x3269a727,
+  0x326cfedb,
+  0x32705670,
+  0x3273ade6,
+  0x3277053d,
+  0x327a5c75,
+  0x327db38e,
+  0x32810a88,
+  0x32846164,
+  0x3287b820,
+  0x328b0ebe,
+  0x328e653c,
+  0x3291bb9c,
+  0x329511dc,
+  0x329867fe,
+  0x329bbe01,
+  0x329f13e6,
+  0x32a269ab,
+  0x32a5bf52,
+  0x32a914d9,
+  0x32ac6a42,
+  0x32afbf8c,
+  0x32b314b8,
+  0x32b669c4,
+  0x32b9beb2,
+  0x32bd1381,
+  0x32c06831,
+  0x32c3bcc2,
+  0x32c71135,
+  0x32ca6589,
+  0x32cdb9be,
+  0x32d10dd5,
+  0x32d461cc,
+  0x32d7b5a5,
+  0x32db0960,
+  0x32de5cfb,
+  0x32e1b078,
+  0x32e503d7,
+  0x32e85716,
+  0x32ebaa37,
+  0x32eefd3a,
+  0x32f2501e,
+  0x32f5a2e3,
+  0x32f8f589,
+  0x32fc4811,
+  0x32ff9a7a,
+  0x3302ecc5,
+  0x33063ef1,
+  0x330990ff,
+  0x330ce2ee,
+  0x331034be,
+  0x33138670,
+  0x3316d803,
+  0x331a2978,
+  0x331d7ace,
+  0x3320cc06,
+  0x33241d1f,
+  0x33276e1a,
+  0x332abef6,
+  0x332e0fb4,
+  0x33316054,
+  0x3334b0d4,
+  0x33380137,
+  0x333b517b,
+  0x333ea1a0,
+  0x3341f1a7,
+  0x33454190,
+  0x3348915a,
+  0x334be106,
+  0x334f3094,
+  0x33528003,
+  0x3355cf53,
+  0x33591e86,
+  0x335c6d9a,
+  0x335fbc8f,
+  0x33630b67,
+  0x33665a1f,
+  0x3369a8ba,
+  0x336cf736,
+  0x33704594,
+  0x337393d4,
+  0x3376e1f5,
+  0x337a2ff9,
+  0x337d7ddd,
+  0x3380cba4,
+  0x3384194c,
+  0x338766d6,
+  0x338ab442,
+  0x338e0190,
+  0x33914ebf,
+  0x33949bd0,
+  0x3397e8c3,
+  0x339b3598,
+  0x339e824e,
+  0x33a1cee7,
+  0x33a51b61,
+  0x33a867bd,
+  0x33abb3fb,
+  0x33af001a,
+  0x33b24c1c,
+  0x33b597ff,
+  0x33b8e3c5,
+  0x33bc2f6c,
+  0x33bf7af5,
+  0x33c2c660,
+  0x33c611ad,
+  0x33c95cdc,
+  0x33cca7ec,
+  0x33cff2df,
+  0x33d33db4,
+  0x33d6886a,
+  0x33d9d303,
+  0x33dd1d7d,
+  0x33e067da,
+  0x33e3b218,
+  0x33e6fc38,
+  0x33ea463b,
+  0x33ed901f,
+  0x33f0d9e6,
+  0x33f4238e,
+  0x33f76d19,
+  0x33fab685,
+  0x33fdffd4,
+  0x34014905,
+  0x34049218,
+  0x3407db0c,
+  0x340b23e3,
+  0x340e6c9c,
+  0x3411b537,
+  0x3414fdb5,
+  0x34184614,
+  0x341b8e55,
+  0x341ed679,
+  0x34221e7f,
+  0x34256667,
+  0x3428ae31,
+  0x342bf5dd,
+  0x342f3d6b,
+  0x343284dc,
+  0x3435cc2f,
+  0x34391364,
+  0x343c5a7b,
+  0x343fa174,
+  0x3442e850,
+  0x34462f0e,
+  0x344975ae,
+  0x344cbc30,
+  0x34500295,
+  0x345348dc,
+  0x34568f05,
+  0x3459d510,
+  0x345d1afe,
+  0x346060ce,
+  0x3463a680,
+  0x3466ec15,
+  0x346a318c,
+  0x346d76e5,
+  0x3470bc21,
+  0x3474013f,
+  0x3477463f,
+  0x347a8b22,
+  0x347dcfe7,
+  0x3481148f,
+  0x34845918,
+  0x34879d85,
+  0x348ae1d3,
+  0x348e2604,
+  0x34916a18,
+  0x3494ae0e,
+  0x3497f1e6,
+  0x349b35a1,
+  0x349e793e,
+  0x34a1bcbe,
+  0x34a50020,
+  0x34a84365,
+  0x34ab868c,
+  0x34aec996,
+  0x34b20c82,
+  0x34b54f51,
+  0x34b89202,
+  0x34bbd496,
+  0x34bf170c,
+  0x34c25965,
+  0x34c59ba0,
+  0x34c8ddbe,
+  0x34cc1fbf,
+  0x34cf61a2,
+  0x34d2a368,
+  0x34d5e510,
+  0x34d9269b,
+  0x34dc6808,
+  0x34dfa958,
+  0x34e2ea8b,
+  0x34e62ba0,
+  0x34e96c98,
+  0x34ecad73,
+  0x34efee30,
+  0x34f32ed0,
+  0x34f66f53,
+  0x34f9afb8,
+  0x34fcf000,
+  0x3500302b,
+  0x35037038,
+  0x3506b029,
+  0x3509effc,
+  0x350d2fb1,
+  0x35106f49,
+  0x3513aec5,
+  0x3516ee22,
+  0x351a2d63,
+  0x351d6c86,
+  0x3520ab8d,
+  0x3523ea75,
+  0x35272941,
+  0x352a67f0,
+  0x352da681,
+  0x3530e4f5,
+  0x3534234c,
+  0x35376186,
+  0x353a9fa3,
+  0x353ddda2,
+  0x35411b85,
+  0x3544594a,
+  0x354796f2,
+  0x354ad47d,
+  0x354e11eb,
+  0x35514f3c,
+  0x35548c70,
+  0x3557c986,
+  0x355b0680,
+  0x355e435c,
+  0x3561801c,
+  0x3564bcbe,
+  0x3567f943,
+  0x356b35ac,
+  0x356e71f7,
+  0x3571ae25,
+  0x3574ea36,
+  0x3578262a,
+  0x357b6202,
+  0x357e9dbc,
+  0x3581d959,
+  0x358514d9,
+  0x3588503d,
+  0x358b8b83,
+  0x358ec6ad,
+  0x359201b9,
+  0x35953ca9,
+  0x3598777b,
+  0x359bb231,
+  0x359eecca,
+  0x35a22745,
+  0x35a561a4,
+  0x35a89be6,
+  0x35abd60c,
+  0x35af1014,
+  0x35b24a00,
+  0x35b583ce,
+  0x35b8bd80,
+  0x35bbf715,
+  0x35bf308d,
+  0x35c269e8,
+  0x35c5a327,
+  0x35c8dc48,
+  0x35cc154d,
+  0x35cf4e35,
+  0x35d28701,
+  0x35d5bfaf,
+  0x35d8f841,
+  0x35dc30b6,
+  0x35df690e,
+  0x35e2a149,
+  0x35e5d968,
+  0x35e9116a,
+  0x35ec494f,
+  0x35ef8118,
+  0x35f2b8c4,
+  0x35f5f053,
+  0x35f927c6,
+  0x35fc5f1b,
+  0x35ff9654,
+  0x3602cd71,
+  0x36060471,
+  0x36093b54,
+  0x360c721a,
+  0x360fa8c4,
+  0x3612df51,
+  0x361615c2,
+  0x36194c16,
+  0x361c824d,
+  0x361fb868,
+  0x3622ee66,
+  0x36262448,
+  0x36295a0d,
+  0x362c8fb6,
+  0x362fc542,
+  0x3632fab1,
+  0x36363004,
+  0x3639653a,
+  0x363c9a54,
+  0x363fcf51,
+  0x36430432,
+  0x364638f6,
+  0x36496d9e,
+  0x364ca229,
+  0x364fd698,
+  0x36530aea,
+  0x36563f20,
+  0x36597339,
+  0x365ca736,
+  0x365fdb17,
+  0x36630edb,
+  0x36664283,
+  0x3669760e,
+  0x366ca97d,
+  0x366fdccf,
+  0x36731005,
+  0x3676431f,
+  0x3679761c,
+  0x367ca8fd,
+  0x367fdbc1,
+  0x36830e69,
+  0x368640f5,
+  0x36897365,
+  0x368ca5b8,
+  0x368fd7ee,
+  0x36930a09,
+  0x36963c07,
+  0x36996de9,
+  0x369c9fae,
+  0x369fd158,
+  0x36a302e5,
+  0x36a63455,
+  0x36a965aa,
+  0x36ac96e2,
+  0x36afc7fe,
+  0x36b2f8fe,
+  0x36b629e1,
+  0x36b95aa8,
+  0x36bc8b53,
+  0x36bfbbe2,
+  0x36c2ec55,
+  0x36c61cab,
+  0x36c94ce5,
+  0x36cc7d03,
+  0x36cfad05,
+  0x36d2dceb,
+  0x36d60cb4,
+  0x36d93c62,
+  0x36dc6bf3,
+  0x36df9b68,
+  0x36e2cac1,
+  0x36e5f9fe,
+  0x36e9291f,
+  0x36ec5823,
+  0x36ef870c,
+  0x36f2b5d8,
+  0x36f5e489,
+  0x36f9131d,
+  0x36fc4195,
+  0x36ff6ff1,
+  0x37029e31,
+  0x3705cc55,
+  0x3708fa5d,
+  0x370c2849,
+  0x370f5619,
+  0x371283cd,
+  0x3715b165,
+  0x3718dee1,
+  0x371c0c41,
+  0x371f3985,
+  0x372266ad,
+  0x372593b9,
+  0x3728c0a9,
+  0x372bed7d,
+  0x372f1a35,
+  0x373246d1,
+  0x37357352,
+  0x37389fb6,
+  0x373bcbff,
+  0x373ef82b,
+  0x3742243c,
+  0x37455030,
+  0x37487c09,
+  0x374ba7c6,
+  0x374ed367,
+  0x3751feec,
+  0x37552a56,
+  0x375855a3,
+  0x375b80d5,
+  0x375eabeb,
+  0x3761d6e5,
+  0x376501c3,
+  0x37682c85,
+  0x376b572c,
+  0x376e81b7,
+  0x3771ac26,
+  0x3774d679,
+  0x377800b0,
+  0x377b2acc,
+  0x377e54cc,
+  0x37817eb0,
+  0x3784a878,
+  0x3787d225,
+  0x378afbb6,
+  0x378e252b,
+  0x37914e84,
+  0x379477c2,
+  0x3797a0e4,
+  0x379ac9eb,
+  0x379df2d5,
+  0x37a11ba4,
+  0x37a44458,
+  0x37a76cef,
+  0x37aa956b,
+  0x37adbdcc,
+  0x37b0e610,
+  0x37b40e3a,
+  0x37b73647,
+  0x37ba5e39,
+  0x37bd860f,
+  0x37c0adca,
+  0x37c3d569,
+  0x37c6fcec,
+  0x37ca2454,
+  0x37cd4ba0,
+  0x37d072d1,
+  0x37d399e6,
+  0x37d6c0e0,
+  0x37d9e7be,
+  0x37dd0e80,
+  0x37e03527,
+  0x37e35bb3,
+  0x37e68223,
+  0x37e9a877,
+  0x37ecceb0,
+  0x37eff4cd,
+  0x37f31acf,
+  0x37f640b6,
+  0x37f96681,
+  0x37fc8c30,
+  0x37ffb1c4,
+  0x3802d73d,
+  0x3805fc9a,
+  0x380921dc,
+  0x380c4702,
+  0x380f6c0d,
+  0x381290fc,
+  0x3815b5d0,
+  0x3818da89,
+  0x381bff26,
+  0x381f23a8,
+  0x3822480f,
+  0x38256c5a,
+  0x38289089,
+  0x382bb49e,
+  0x382ed897,
+  0x3831fc75,
+  0x38352037,
+  0x383843de,
+  0x383b676a,
+  0x383e8ada,
+  0x3841ae2f,
+  0x3844d169,
+  0x3847f488,
+  0x384b178b,
+  0x384e3a73,
+  0x38515d3f,
+  0x38547ff1,
+  0x3857a287,
+  0x385ac502,
+  0x385de762,
+  0x386109a6,
+  0x38642bcf,
+  0x38674ddd,
+  0x386a6fd0,
+  0x386d91a8,
+  0x3870b364,
+  0x3873d505,
+  0x3876f68b,
+  0x387a17f6,
+  0x387d3946,
+  0x38805a7a,
+  0x38837b94,
+  0x38869c92,
+  0x3889bd75,
+  0x388cde3d,
+  0x388ffeea,
+  0x38931f7b,
+  0x38963ff2,
+  0x3899604d,
+  0x389c808e,
+  0x389fa0b3,
+  0x38a2c0bd,
+  0x38a5e0ac,
+  0x38a90080,
+  0x38ac2039,
+  0x38af3fd7,
+  0x38b25f5a,
+  0x38b57ec2,
+  0x38b89e0f,
+  0x38bbbd41,
+  0x38bedc58,
+  0x38c1fb53,
+  0x38c51a34,
+  0x38c838fa,
+  0x38cb57a5,
+  0x38ce7635,
+  0x38d194a9,
+  0x38d4b303,
+  0x38d7d142,
+  0x38daef66,
+  0x38de0d6f,
+  0x38e12b5d,
+  0x38e44930,
+  0x38e766e8,
+  0x38ea8486,
+  0x38eda208,
+  0x38f0bf70,
+  0x38f3dcbc,
+  0x38f6f9ee,
+  0x38fa1705,
+  0x38fd3401,
+  0x390050e2,
+  0x39036da8,
+  0x39068a53,
+  0x3909a6e4,
+  0x390cc359,
+  0x390fdfb4,
+  0x3912fbf4,
+  0x39161819,
+  0x39193424,
+  0x391c5013,
+  0x391f6be8,
+  0x392287a2,
+  0x3925a341,
+  0x3928bec5,
+  0x392bda2f,
+  0x392ef57e,
+  0x393210b2,
+  0x39352bcb,
+  0x393846ca,
+  0x393b61ae,
+  0x393e7c77,
+  0x39419726,
+  0x3944b1b9,
+  0x3947cc32,
+  0x394ae691,
+  0x394e00d4,
+  0x39511afd,
+  0x3954350b,
+  0x39574eff,
+  0x395a68d8,
+  0x395d8296,
+  0x39609c3a,
+  0x3963b5c3,
+  0x3966cf31,
+  0x3969e885,
+  0x396d01be,
+  0x39701adc,
+  0x397333e0,
+  0x39764cca,
+  0x39796598,
+  0x397c7e4c,
+  0x397f96e6,
+  0x3982af65,
+  0x3985c7c9,
+  0x3988e013,
+  0x398bf842,
+  0x398f1057,
+  0x39922851,
+  0x39954031,
+  0x399857f6,
+  0x399b6fa0,
+  0x399e8730,
+  0x39a19ea6,
+  0x39a4b601,
+  0x39a7cd42,
+  0x39aae468,
+  0x39adfb73,
+  0x39b11264,
+  0x39b4293b,
+  0x39b73ff7,
+  0x39ba5699,
+  0x39bd6d20,
+  0x39c0838d,
+  0x39c399e0,
+  0x39c6b018,
+  0x39c9c636,
+  0x39ccdc39,
+  0x39cff222,
+  0x39d307f0,
+  0x39d61da4,
+  0x39d9333e,
+  0x39dc48bd,
+  0x39df5e22,
+  0x39e2736d,
+  0x39e5889d,
+  0x39e89db3,
+  0x39ebb2ae,
+  0x39eec78f,
+  0x39f1dc56,
+  0x39f4f103,
+  0x39f80595,
+  0x39fb1a0d,
+  0x39fe2e6b,
+  0x3a0142ae,
+  0x3a0456d7,
+  0x3a076ae6,
+  0x3a0a7eda,
+  0x3a0d92b5,
+  0x3a10a675,
+  0x3a13ba1a,
+  0x3a16cda6,
+  0x3a19e117,
+  0x3a1cf46e,
+  0x3a2007ab,
+  0x3a231ace,
+  0x3a262dd6,
+  0x3a2940c4,
+  0x3a2c5398,
+  0x3a2f6652,
+  0x3a3278f2,
+  0x3a358b77,
+  0x3a389de2,
+  0x3a3bb033,
+  0x3a3ec26a,
+  0x3a41d487,
+  0x3a44e68a,
+  0x3a47f872,
+  0x3a4b0a41,
+  0x3a4e1bf5,
+  0x3a512d8f,
+  0x3a543f0f,
+  0x3a575075,
+  0x3a5a61c1,
+  0x3a5d72f3,
+  0x3a60840b,
+  0x3a639508,
+  0x3a66a5ec,
+  0x3a69b6b6,
+  0x3a6cc765,
+  0x3a6fd7fa,
+  0x3a72e876,
+  0x3a75f8d7,
+  0x3a79091e,
+  0x3a7c194c,
+  0x3a7f295f,
+  0x3a823958,
+  0x3a854938,
+  0x3a8858fd,
+  0x3a8b68a8,
+  0x3a8e783a,
+  0x3a9187b1,
+  0x3a94970e,
+  0x3a97a652,
+  0x3a9ab57b,
+  0x3a9dc48b,
+  0x3aa0d380,
+  0x3aa3e25c,
+  0x3aa6f11e,
+  0x3aa9ffc6,
+  0x3aad0e54,
+  0x3ab01cc8,
+  0x3ab32b22,
+  0x3ab63962,
+  0x3ab94788,
+  0x3abc5595,
+  0x3abf6387,
+  0x3ac27160,
+  0x3ac57f1f,
+  0x3ac88cc4,
+  0x3acb9a4f,
+  0x3acea7c0,
+  0x3ad1b518,
+  0x3ad4c256,
+  0x3ad7cf79,
+  0x3adadc83,
+  0x3adde974,
+  0x3ae0f64a,
+  0x3ae40307,
+  0x3ae70faa,
+  0x3aea1c33,
+  0x3aed28a2,
+  0x3af034f8,
+  0x3af34133,
+  0x3af64d56,
+  0x3af9595e,
+  0x3afc654c,
+  0x3aff7121,
+  0x3b027cdc,
+  0x3b05887e,
+  0x3b089405,
+  0x3b0b9f73,
+  0x3b0eaac8,
+  0x3b11b602,
+  0x3b14c123,
+  0x3b17cc2a,
+  0x3b1ad718,
+  0x3b1de1ec,
+  0x3b20eca6,
+  0x3b23f747,
+  0x3b2701ce,
+  0x3b2a0c3b,
+  0x3b2d168e,
+  0x3b3020c8,
+  0x3b332ae9,
+  0x3b3634f0,
+  0x3b393edd,
+  0x3b3c48b0,
+  0x3b3f526a,
+  0x3b425c0b,
+  0x3b456592,
+  0x3b486eff,
+  0x3b4b7853,
+  0x3b4e818d,
+  0x3b518aad,
+  0x3b5493b4,
+  0x3b579ca2,
+  0x3b5aa576,
+  0x3b5dae30,
+  0x3b60b6d1,
+  0x3b63bf59,
+  0x3b66c7c7,
+  0x3b69d01b,
+  0x3b6cd856,
+  0x3b6fe077,
+  0x3b72e87f,
+  0x3b75f06e,
+  0x3b78f843,
+  0x3b7bfffe,
+  0x3b7f07a0,
+  0x3b820f29,
+  0x3b851698,
+  0x3b881dee,
+  0x3b8b252a,
+  0x3b8e2c4d,
+  0x3b913356,
+  0x3b943a47,
+  0x3b97411d,
+  0x3b9a47db,
+  0x3b9d4e7e,
+  0x3ba05509,
+  0x3ba35b7a,
+  0x3ba661d2,
+  0x3ba96810,
+  0x3bac6e35,
+  0x3baf7441,
+  0x3bb27a33,
+  0x3bb5800c,
+  0x3bb885cc,
+  0x3bbb8b72,
+  0x3bbe90ff,
+  0x3bc19673,
+  0x3bc49bcd,
+  0x3bc7a10e,
+  0x3bcaa636,
+  0x3bcdab45,
+  0x3bd0b03a,
+  0x3bd3b516,
+  0x3bd6b9d9,
+  0x3bd9be82,
+  0x3bdcc312,
+  0x3bdfc789,
+  0x3be2cbe7,
+  0x3be5d02b,
+  0x3be8d457,
+  0x3bebd869,
+  0x3beedc61,
+  0x3bf1e041,
+  0x3bf4e407,
+  0x3bf7e7b5,
+  0x3bfaeb49,
+  0x3bfdeec3,
+  0x3c00f225,
+  0x3c03f56e,
+  0x3c06f89d,
+  0x3c09fbb3,
+  0x3c0cfeb0,
+  0x3c100194,
+  0x3c13045f,
+  0x3c160710,
+  0x3c1909a9,
+  0x3c1c0c28,
+  0x3c1f0e8e,
+  0x3c2210db,
+  0x3c25130f,
+  0x3c28152a,
+  0x3c2b172c,
+  0x3c2e1915,
+  0x3c311ae5,
+  0x3c341c9b,
+  0x3c371e39,
+  0x3c3a1fbd,
+  0x3c3d2129,
+  0x3c40227b,
+  0x3c4323b5,
+  0x3c4624d5,
+  0x3c4925dc,
+  0x3c4c26cb,
+  0x3c4f27a0,
+  0x3c52285c,
+  0x3c5528ff,
+  0x3c58298a,
+  0x3c5b29fb,
+  0x3c5e2a53,
+  0x3c612a93,
+  0x3c642ab9,
+  0x3c672ac7,
+  0x3c6a2abb,
+  0x3c6d2a97,
+  0x3c702a59,
+  0x3c732a03,
+  0x3c762994,
+  0x3c79290b,
+  0x3c7c286a,
+  0x3c7f27b0,
+  0x3c8226dd,
+  0x3c8525f2,
+  0x3c8824ed,
+  0x3c8b23cf,
+  0x3c8e2299,
+  0x3c912149,
+  0x3c941fe1,
+  0x3c971e60,
+  0x3c9a1cc6,
+  0x3c9d1b14,
+  0x3ca01948,
+  0x3ca31764,
+  0x3ca61566,
+  0x3ca91350,
+  0x3cac1121,
+  0x3caf0eda,
+  0x3cb20c79,
+  0x3cb50a00,
+  0x3cb8076e,
+  0x3cbb04c3,
+  0x3cbe01ff,
+  0x3cc0ff23,
+  0x3cc3fc2e,
+  0x3cc6f920,
+  0x3cc9f5f9,
+  0x3cccf2b9,
+  0x3ccfef61,
+  0x3cd2ebf0,
+  0x3cd5e867,
+  0x3cd8e4c4,
+  0x3cdbe109,
+  0x3cdedd35,
+  0x3ce1d949,
+  0x3ce4d544,
+  0x3ce7d126,
+  0x3ceaccef,
+  0x3cedc8a0,
+  0x3cf0c438,
+  0x3cf3bfb8,
+  0x3cf6bb1e,
+  0x3cf9b66d,
+  0x3cfcb1a2,
+  0x3cffacbf,
+  0x3d02a7c3,
+  0x3d05a2af,
+  0x3d089d82,
+  0x3d0b983c,
+  0x3d0e92de,
+  0x3d118d67,
+  0x3d1487d7,
+  0x3d17822f,
+  0x3d1a7c6f,
+  0x3d1d7695,
+  0x3d2070a4,
+  0x3d236a99,
+  0x3d266476,
+  0x3d295e3b,
+  0x3d2c57e7,
+  0x3d2f517a,
+  0x3d324af5,
+  0x3d354458,
+  0x3d383da1,
+  0x3d3b36d3,
+  0x3d3e2fec,
+  0x3d4128ec,
+  0x3d4421d4,
+  0x3d471aa3,
+  0x3d4a135a,
+  0x3d4d0bf8,
+  0x3d50047e,
+  0x3d52fcec,
+  0x3d55f541,
+  0x3d58ed7d,
+  0x3d5be5a1,
+  0x3d5eddad,
+  0x3d61d5a0,
+  0x3d64cd7b,
+  0x3d67c53d,
+  0x3d6abce7,
+  0x3d6db478,
+  0x3d70abf2,
+  0x3d73a352,
+  0x3d769a9b,
+  0x3d7991cb,
+  0x3d7c88e2,
+  0x3d7f7fe1,
+  0x3d8276c8,
+  0x3d856d96,
+  0x3d88644d,
+  0x3d8b5aea,
+  0x3d8e5170,
+  0x3d9147dd,
+  0x3d943e31,
+  0x3d97346e,
+  0x3d9a2a92,
+  0x3d9d209e,
+  0x3da01691,
+  0x3da30c6c,
+  0x3da6022f,
+  0x3da8f7da,
+  0x3dabed6c,
+  0x3daee2e6,
+  0x3db1d848,
+  0x3db4cd91,
+  0x3db7c2c2,
+  0x3dbab7db,
+  0x3dbdacdc,
+  0x3dc0a1c4,
+  0x3dc39695,
+  0x3dc68b4d,
+  0x3dc97fec,
+  0x3dcc7474,
+  0x3dcf68e3,
+  0x3dd25d3b,
+  0x3dd5517a,
+  0x3dd845a0,
+  0x3ddb39af,
+  0x3dde2da5,
+  0x3de12183,
+  0x3de41549,
+  0x3de708f7,
+  0x3de9fc8d,
+  0x3decf00b,
+  0x3defe370,
+  0x3df2d6bd,
+  0x3df5c9f3,
+  0x3df8bd10,
+  0x3dfbb015,
+  0x3dfea301,
+  0x3e0195d6,
+  0x3e048893,
+  0x3e077b37,
+  0x3e0a6dc4,
+  0x3e0d6038,
+  0x3e105294,
+  0x3e1344d8,
+  0x3e163704,
+  0x3e192919,
+  0x3e1c1b15,
+  0x3e1f0cf8,
+  0x3e21fec4,
+  0x3e24f078,
+  0x3e27e214,
+  0x3e2ad398,
+  0x3e2dc504,
+  0x3e30b658,
+  0x3e33a793,
+  0x3e3698b7,
+  0x3e3989c3,
+  0x3e3c7ab7,
+  0x3e3f6b92,
+  0x3e425c56,
+  0x3e454d02,
+  0x3e483d96,
+  0x3e4b2e12,
+  0x3e4e1e76,
+  0x3e510ec2,
+  0x3e53fef6,
+  0x3e56ef12,
+  0x3e59df17,
+  0x3e5ccf03,
+  0x3e5fbed7,
+  0x3e62ae94,
+  0x3e659e38,
+  0x3e688dc5,
+  0x3e6b7d3a,
+  0x3e6e6c97,
+  0x3e715bdc,
+  0x3e744b09,
+  0x3e773a1e,
+  0x3e7a291c,
+  0x3e7d1801,
+  0x3e8006cf,
+  0x3e82f585,
+  0x3e85e423,
+  0x3e88d2a9,
+  0x3e8bc118,
+  0x3e8eaf6e,
+  0x3e919dad,
+  0x3e948bd4,
+  0x3e9779e3,
+  0x3e9a67da,
+  0x3e9d55ba,
+  0x3ea04382,
+  0x3ea33132,
+  0x3ea61eca,
+  0x3ea90c4a,
+  0x3eabf9b3,
+  0x3eaee704,
+  0x3eb1d43d,
+  0x3eb4c15e,
+  0x3eb7ae68,
+  0x3eba9b5a,
+  0x3ebd8834,
+  0x3ec074f7,
+  0x3ec361a1,
+  0x3ec64e34,
+  0x3ec93ab0,
+  0x3ecc2713,
+  0x3ecf135f,
+  0x3ed1ff94,
+  0x3ed4ebb0,
+  0x3ed7d7b5,
+  0x3edac3a2,
+  0x3eddaf78,
+  0x3ee09b36,
+  0x3ee386dc,
+  0x3ee6726b,
+  0x3ee95de2,
+  0x3eec4941,
+  0x3eef3489,
+  0x3ef21fb9,
+  0x3ef50ad2,
+  0x3ef7f5d2,
+  0x3efae0bc,
+  0x3efdcb8d,
+  0x3f00b648,
+  0x3f03a0ea,
+  0x3f068b75,
+  0x3f0975e8,
+  0x3f0c6044,
+  0x3f0f4a88,
+  0x3f1234b5,
+  0x3f151eca,
+  0x3f1808c8,
+  0x3f1af2ae,
+  0x3f1ddc7c,
+  0x3f20c633,
+  0x3f23afd2,
+  0x3f26995a,
+  0x3f2982cb,
+  0x3f2c6c24,
+  0x3f2f5565,
+  0x3f323e8f,
+  0x3f3527a1,
+  0x3f38109c,
+  0x3f3af980,
+  0x3f3de24c,
+  0x3f40cb00,
+  0x3f43b39d,
+  0x3f469c23,
+  0x3f498491,
+  0x3f4c6ce8,
+  0x3f4f5527,
+  0x3f523d4f,
+  0x3f55255f,
+  0x3f580d58,
+  0x3f5af53a,
+  0x3f5ddd04,
+  0x3f60c4b7,
+  0x3f63ac52,
+  0x3f6693d6,
+  0x3f697b43,
+  0x3f6c6298,
+  0x3f6f49d6,
+  0x3f7230fc,
+  0x3f75180c,
+  0x3f77ff03,
+  0x3f7ae5e4,
+  0x3f7dccad,
+  0x3f80b35f,
+  0x3f8399f9,
+  0x3f86807c,
+  0x3f8966e8,
+  0x3f8c4d3c,
+  0x3f8f3379,
+  0x3f92199f,
+  0x3f94ffae,
+  0x3f97e5a5,
+  0x3f9acb85,
+  0x3f9db14d,
+  0x3fa096ff,
+  0x3fa37c99,
+  0x3fa6621c,
+  0x3fa94787,
+  0x3fac2cdc,
+  0x3faf1219,
+  0x3fb1f73f,
+  0x3fb4dc4d,
+  0x3fb7c145,
+  0x3fbaa625,
+  0x3fbd8aee,
+  0x3fc06fa0,
+  0x3fc3543a,
+  0x3fc638bd,
+  0x3fc91d29,
+  0x3fcc017e,
+  0x3fcee5bc,
+  0x3fd1c9e3,
+  0x3fd4adf2,
+  0x3fd791ea,
+  0x3fda75cb,
+  0x3fdd5995,
+  0x3fe03d48,
+  0x3fe320e4,
+  0x3fe60468,
+  0x3fe8e7d5,
+  0x3febcb2c,
+  0x3feeae6b,
+  0x3ff19193,
+  0x3ff474a4,
+  0x3ff7579d,
+  0x3ffa3a80,
+  0x3ffd1d4c,
+  0x40000000,
+};
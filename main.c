@@ -1,18 +1,37 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "number.h"
 
 #include "lexer.h"
 #include "compiler.h"
 #include "vm.h"
+#include "sampler.h"
+
+#define KL_MAIN_INBUF  0x00010000
+#define KL_MAIN_OUTBUF 0x00100000
+
+/* usage: ks [-b] [-q] [-p profile] [file ...]
+ *
+ * without arguments ks is an interactive REPL that disassembles every statement and prints its result as
+ * soon as it has run.  -b, -q or any file switches to batch mode: files are read in order, "-" meaning
+ * stdin and none at all stdin alone, results go out one per line through a large buffer, and a summary of
+ * statements, errors, compile time and execute time goes to stderr on exit, followed by the compiler's
+ * statistics when built with KL_COMPILER_STATS and the opcode profile when built with KL_VM_PROFILE.  -q
+ * drops the results.  -p samples where the vm spends its time, see sampler.h, and writes the collapsed
+ * stacks to profile -- it needs a build with KL_VM_SAMPLE */
+
+static FILE* in;
 
 static int read() {
-  return getchar();
+  return getc_unlocked(in);
 }
 
-static kl_vm_t vm = KL_VM_INITIALIZER;
+static kl_vm_t        vm    = KL_VM_INITIALIZER;
+static kl_scope_t     scope = KL_SCOPE_INITIALIZER;
+static kl_numwriter_t out;
 
 static inline kl_valref_t kl_vm_stack_pop(kl_vm_t* vm) {
   int sp = vm->sp;
@@ -20,17 +39,72 @@ static inline kl_valref_t kl_vm_stack_pop(kl_vm_t* vm) {
   return vm->stack[sp];
 }
 
-int main() {
-  /*
-  FILE* f = fopen("trigtable.h", "wb");
-  fprintf(f, "static int32_t sine_values[0x0401] = {\n");
-  for (int i=0; i<=1024; i++) {
-      int theta = kl_num_mul(kl_inttonum(i) >> 10, KL_NUM_HALFPI);
-      fprintf(f, "\t0x%08x,\n", kl_num_taylor_sin(theta));
+typedef struct kl_batch {
+  int    batch;
+  int    quiet;
+  long   statements;
+  long   errors;
+  double compile; /* nanoseconds */
+  double exec;
+} kl_batch_t;
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/* arrays print element by element, the way they are written in a script */
+static void result(kl_valref_t val) {
+  uint32_t     n;
+  kl_number_t* data;
+  if (val.ns != KL_NS_IMMEDIATE && (data = kl_vm_array_data(&vm, val, &n)) != NULL) {
+    kl_numwriter_str(&out, "[", 1);
+    for (uint32_t i=0; i < n; i++) {
+      if (i > 0) kl_numwriter_str(&out, ", ", 2);
+      kl_numwriter_num(&out, data[i]);
+    }
+    kl_numwriter_str(&out, "]", 1);
+  } else {
+    kl_numwriter_num(&out, val.val.num);
   }
-  fprintf(f, "};\n");
-  fclose(f);
-  */
+  kl_numwriter_str(&out, "\n", 1);
+}
+
+/* runs every statement of in until end of input */
+static void run(kl_batch_t* b, const char* name) {
+  kl_lexer_t source;
+  kl_lexer_init(&source, read, NULL);
+  source.name = name;
+
+  for (;;) {
+    double     t0   = now();
+    kl_code_t* code = kl_compile(&source, &scope);
+    double     t1   = now();
+    b->compile += t1 - t0;
+
+    if (code == NULL) {
+      b->errors++;
+    } else if (code->n > 0) {
+      if (!b->batch) kl_code_print(code);
+      kl_vm_exec(&vm, code);
+      b->exec += now() - t1;
+      b->statements++;
+
+      if (!b->batch) printf("sp: %d\n", vm.sp);
+      kl_valref_t val = kl_vm_stack_pop(&vm);
+      if (!b->batch) kl_numwriter_str(&out, "result: ", 8);
+      if (!b->quiet) result(val);
+      if (!b->batch) kl_numwriter_flush(&out);
+    }
+    free(code);
+
+    /* the statement just compiled ran up to the end of input */
+    if (source.cur < 0) break;
+  }
+}
+
+int main(int argc, char** argv) {
   /*
   kl_number_t i = 0;
   for (;;) {
@@ -43,22 +117,85 @@ int main() {
       i += 0x00000040;
   }
   */
-  kl_lexer_t source;
+  kl_batch_t b = { 0 };
 
-  kl_lexer_init(&source, read, NULL);
+  int   nfiles  = 0;
+  char* profile = NULL;
+  for (int i=1; i < argc; i++) {
+    if (strcmp(argv[i], "-b") == 0) {
+      b.batch = 1;
+    } else if (strcmp(argv[i], "-q") == 0) {
+      b.batch = b.quiet = 1;
+    } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+      profile = argv[++i];
+      b.batch = 1;
+    } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+      fprintf(stderr, "usage: %s [-b] [-q] [-p profile] [file ...]\n", argv[0]);
+      return 2;
+    } else {
+      argv[++nfiles] = argv[i]; /* files in order, compacted to the front */
+      b.batch = 1;
+    }
+  }
 
-  kl_code_t*       code;
-  for (;;) {
-    code = kl_compile(&source);
-    if (code == NULL) continue;
-    kl_code_print(code);
-    kl_vm_exec(&vm, code);
-    printf("sp: %d\n", vm.sp);
+  if (b.batch) setvbuf(stdout, NULL, _IOFBF, KL_MAIN_OUTBUF);
+  kl_numwriter_init(&out, stdout);
 
-    kl_valref_t val = kl_vm_stack_pop(&vm);
-    printf("result: %f\n", kl_numtofloat(val.val.num));
+  if (profile != NULL) {
+    kl_sampler_attach(&vm);
+    if (kl_sampler_start(KL_SAMPLER_HZ) < 0) {
+      fprintf(stderr, "KludgeScript: cannot profile, this build has no KL_VM_SAMPLE\n");
+      return 2;
+    }
+  }
 
-    free(code);
+  int status = 0;
+  if (nfiles == 0) {
+    in = stdin;
+    run(&b, "<stdin>");
+  }
+  for (int i=1; i <= nfiles; i++) {
+    if (strcmp(argv[i], "-") == 0) {
+      in = stdin;
+    } else if ((in = fopen(argv[i], "r")) == NULL) {
+      fprintf(stderr, "KludgeScript: cannot open %s\n", argv[i]);
+      status = 1;
+      continue;
+    } else {
+      setvbuf(in, NULL, _IOFBF, KL_MAIN_INBUF);
+    }
+    run(&b, strcmp(argv[i], "-") == 0 ? "<stdin>" : argv[i]);
+    if (in != stdin) fclose(in);
+  }
+
+  if (profile != NULL) {
+    kl_sampler_stop();
+    FILE* f = fopen(profile, "w");
+    if (f == NULL) {
+      fprintf(stderr, "KludgeScript: cannot open %s\n", profile);
+      status = 1;
+    } else {
+      kl_sampler_dump(f);
+      fclose(f);
+    }
+  }
+
+  kl_numwriter_flush(&out);
+  fflush(stdout);
+  if (b.batch) {
+    fprintf(stderr, "statements: %ld, errors: %ld, compile: %.3f ms, execute: %.3f ms\n",
+            b.statements, b.errors, b.compile / 1e6, b.exec / 1e6);
+#if KL_COMPILER_STATS
+    const kl_compiler_stats_t* s = kl_compiler_stats_total();
+    fprintf(stderr, "lex: %.3f ms, %llu tokens, %llu bytes; compile less lexing: %.3f ms, %llu instructions, "
+                    "depth %d; %llu allocations, %llu bytes\n",
+            s->lexns / 1e6, (unsigned long long)s->tokens, (unsigned long long)s->bytes, s->compilens / 1e6,
+            (unsigned long long)s->instructions, s->depth, (unsigned long long)s->allocs,
+            (unsigned long long)s->allocbytes);
+#endif
+#if KL_VM_PROFILE
+    kl_vm_profile_dump(&vm, stderr);
+#endif
   }
-  return 0;
+  return status != 0 || b.errors != 0;
 }
@@ -0,0 +1,404 @@
+#include "numarray.h"
+
+#include "langdefs.h"
+
+#include <string.h>
+
+/* the SIMD kernels work on 32-bit lanes, the 64-bit formats run the scalar loops */
+#if defined(__SSE2__) && KL_NUM_INT32
+#define KL_NUMARRAY_SSE2 1
+#include <emmintrin.h>
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+#else
+#define KL_NUMARRAY_SSE2 0
+#endif
+
+/* a kernel is one loop per broadcast case, each with a 4-lane SIMD body and a scalar tail */
+#if KL_NUMARRAY_SSE2
+#define KL_NUMARRAY_SIMD(vexpr) \
+  if (!sx && !sy) { \
+    for (; i + 4 <= n; i += 4) { \
+      __m128i a = _mm_loadu_si128((const __m128i*)(x + i)); \
+      __m128i b = _mm_loadu_si128((const __m128i*)(y + i)); \
+      _mm_storeu_si128((__m128i*)(z + i), (vexpr)); \
+    } \
+  } else if (sx && !sy) { \
+    __m128i a = _mm_set1_epi32(x[0]); \
+    for (; i + 4 <= n; i += 4) { \
+      __m128i b = _mm_loadu_si128((const __m128i*)(y + i)); \
+      _mm_storeu_si128((__m128i*)(z + i), (vexpr)); \
+    } \
+  } else if (!sx && sy) { \
+    __m128i b = _mm_set1_epi32(y[0]); \
+    for (; i + 4 <= n; i += 4) { \
+      __m128i a = _mm_loadu_si128((const __m128i*)(x + i)); \
+      _mm_storeu_si128((__m128i*)(z + i), (vexpr)); \
+    } \
+  }
+#else
+#define KL_NUMARRAY_SIMD(vexpr)
+#endif
+
+#define KL_NUMARRAY_KERNEL(name, vexpr, sexpr) \
+  static void name(kl_number_t *z, const kl_number_t *x, int sx, const kl_number_t *y, int sy, size_t n) { \
+    size_t i = 0; \
+    KL_NUMARRAY_SIMD(vexpr) \
+    for (; i < n; i++) { \
+      kl_number_t a = x[sx ? 0 : i]; \
+      kl_number_t b = y[sy ? 0 : i]; \
+      z[i] = (sexpr); \
+    } \
+  }
+
+/* one operand */
+#if KL_NUMARRAY_SSE2
+#define KL_NUMARRAY_SIMD1(vexpr) \
+  for (; i + 4 <= n; i += 4) { \
+    __m128i a = _mm_loadu_si128((const __m128i*)(x + i)); \
+    _mm_storeu_si128((__m128i*)(z + i), (vexpr)); \
+  }
+#else
+#define KL_NUMARRAY_SIMD1(vexpr)
+#endif
+
+#define KL_NUMARRAY_KERNEL1(name, vexpr, sexpr) \
+  static void name(kl_number_t *z, const kl_number_t *x, size_t n) { \
+    size_t i = 0; \
+    KL_NUMARRAY_SIMD1(vexpr) \
+    for (; i < n; i++) { \
+      kl_number_t a = x[i]; \
+      z[i] = (sexpr); \
+    } \
+  }
+
+/* three operands -- the broadcast flags are loop invariant, so picking a lane source per iteration is
+ * cheaper than spelling out all eight combinations */
+#if KL_NUMARRAY_SSE2
+#define KL_NUMARRAY_SIMD3(vexpr) \
+  if (n >= 4) { \
+    __m128i ba = _mm_set1_epi32(x[0]), bb = _mm_set1_epi32(y[0]), bc = _mm_set1_epi32(w[0]); \
+    for (; i + 4 <= n; i += 4) { \
+      __m128i a = sx ? ba : _mm_loadu_si128((const __m128i*)(x + i)); \
+      __m128i b = sy ? bb : _mm_loadu_si128((const __m128i*)(y + i)); \
+      __m128i c = sw ? bc : _mm_loadu_si128((const __m128i*)(w + i)); \
+      _mm_storeu_si128((__m128i*)(z + i), (vexpr)); \
+    } \
+  }
+#else
+#define KL_NUMARRAY_SIMD3(vexpr)
+#endif
+
+#define KL_NUMARRAY_KERNEL3(name, vexpr, sexpr) \
+  static void name(kl_number_t *z, const kl_number_t *x, int sx, const kl_number_t *y, int sy, \
+                   const kl_number_t *w, int sw, size_t n) { \
+    size_t i = 0; \
+    KL_NUMARRAY_SIMD3(vexpr) \
+    for (; i < n; i++) { \
+      kl_number_t a = x[sx ? 0 : i]; \
+      kl_number_t b = y[sy ? 0 : i]; \
+      kl_number_t c = w[sw ? 0 : i]; \
+      z[i] = (sexpr); \
+    } \
+  }
+
+/* scalar-only kernels still avoid per-element dispatch */
+#define KL_NUMARRAY_SCALAR(name, sexpr) \
+  static void name(kl_number_t *z, const kl_number_t *x, int sx, const kl_number_t *y, int sy, size_t n) { \
+    for (size_t i=0; i < n; i++) { \
+      kl_number_t a = x[sx ? 0 : i]; \
+      kl_number_t b = y[sy ? 0 : i]; \
+      z[i] = (sexpr); \
+    } \
+  }
+
+#if KL_NUMARRAY_SSE2
+#define ONE  _mm_set1_epi32(KL_NUM_ONE)
+#define ZERO _mm_setzero_si128()
+#define BOOL(mask) _mm_and_si128((mask), ONE)
+#define NONZERO(v) _mm_xor_si128(_mm_cmpeq_epi32((v), ZERO), _mm_set1_epi32(-1))
+
+/* full 64-bit products of the even and odd lanes.  SSE2 only multiplies unsigned, and the sign correction
+ * only touches the top half of each product */
+static inline void kl_numarray_mul64(__m128i a, __m128i b, __m128i *even, __m128i *odd) {
+#if defined(__SSE4_1__)
+  *even = _mm_mul_epi32(a, b);
+  *odd  = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+#else
+  __m128i fix = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+  *even = _mm_sub_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(fix, 32));
+  *odd  = _mm_sub_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)),
+                        _mm_and_si128(fix, _mm_set_epi32(-1, 0, -1, 0)));
+#endif
+}
+
+/* low 32 bits of each (a * b) >> 16, which is what kl_num_mul keeps */
+static inline __m128i kl_numarray_mul(__m128i a, __m128i b) {
+  __m128i even, odd;
+  kl_numarray_mul64(a, b, &even, &odd);
+  even = _mm_and_si128(_mm_srli_epi64(even, KL_NUM_FBITS), _mm_set_epi32(0, -1, 0, -1));
+  odd  = _mm_slli_epi64(_mm_srli_epi64(odd, KL_NUM_FBITS), 32);
+  return _mm_or_si128(even, odd);
+}
+
+static inline __m128i kl_numarray_min(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+  return _mm_min_epi32(a, b);
+#else
+  __m128i m = _mm_cmpgt_epi32(a, b);
+  return _mm_or_si128(_mm_and_si128(m, b), _mm_andnot_si128(m, a));
+#endif
+}
+
+static inline __m128i kl_numarray_max(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+  return _mm_max_epi32(a, b);
+#else
+  __m128i m = _mm_cmpgt_epi32(a, b);
+  return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+#endif
+}
+
+/* KL_NUM_MIN saturates to KL_NUM_MAX, as in kl_num_abs */
+static inline __m128i kl_numarray_abs(__m128i a) {
+  __m128i m = _mm_srai_epi32(a, 31);
+  __m128i r = _mm_sub_epi32(_mm_xor_si128(a, m), m);
+  return _mm_sub_epi32(r, _mm_srli_epi32(r, 31));
+}
+
+/* b - a wraps in a lane where kl_num_lerp has one bit more.  the bit it lost, 2^32 with the sign of b,
+ * comes back as 2^32 * t >> F, which is t << (32 - F) */
+static inline __m128i kl_numarray_lerp(__m128i a, __m128i b, __m128i t) {
+  __m128i d = _mm_sub_epi32(b, a);
+  __m128i o = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(b, a), _mm_xor_si128(d, b)), 31);
+  __m128i s = _mm_srai_epi32(b, 31);
+  __m128i c = _mm_sub_epi32(_mm_xor_si128(_mm_slli_epi32(t, 32 - KL_NUM_FBITS), s), s);
+  return _mm_add_epi32(_mm_add_epi32(a, kl_numarray_mul(d, t)), _mm_and_si128(c, o));
+}
+#endif
+
+KL_NUMARRAY_KERNEL(kl_numarray_add, _mm_add_epi32(a, b), a + b)
+KL_NUMARRAY_KERNEL(kl_numarray_sub, _mm_sub_epi32(a, b), a - b)
+KL_NUMARRAY_KERNEL(kl_numarray_mul_kernel, kl_numarray_mul(a, b), kl_num_mul(a, b))
+KL_NUMARRAY_SCALAR(kl_numarray_div, kl_num_div(a, b))
+KL_NUMARRAY_SCALAR(kl_numarray_fdiv, kl_num_fdiv(a, b))
+KL_NUMARRAY_SCALAR(kl_numarray_mod, kl_num_mod(a, b))
+KL_NUMARRAY_SCALAR(kl_numarray_ashftl, kl_num_ashftl(a, b))
+KL_NUMARRAY_SCALAR(kl_numarray_ashftr, kl_num_ashftr(a, b))
+KL_NUMARRAY_SCALAR(kl_numarray_lshftl, kl_num_lshftl(a, b))
+KL_NUMARRAY_SCALAR(kl_numarray_lshftr, kl_num_lshftr(a, b))
+KL_NUMARRAY_KERNEL(kl_numarray_bitand, _mm_and_si128(a, b), kl_num_and(a, b))
+KL_NUMARRAY_KERNEL(kl_numarray_bitor,  _mm_or_si128(a, b),  kl_num_or(a, b))
+KL_NUMARRAY_KERNEL(kl_numarray_bitxor, _mm_xor_si128(a, b), kl_num_xor(a, b))
+KL_NUMARRAY_KERNEL(kl_numarray_logand, BOOL(_mm_and_si128(NONZERO(a), NONZERO(b))), kl_inttonum(a && b))
+KL_NUMARRAY_KERNEL(kl_numarray_logor,  BOOL(_mm_or_si128(NONZERO(a), NONZERO(b))),  kl_inttonum(a || b))
+
+KL_NUMARRAY_KERNEL(kl_numarray_minv, kl_numarray_min(a, b), kl_num_min(a, b))
+KL_NUMARRAY_KERNEL(kl_numarray_maxv, kl_numarray_max(a, b), kl_num_max(a, b))
+KL_NUMARRAY_KERNEL1(kl_numarray_bitnot, _mm_xor_si128(a, _mm_set1_epi32(-1)), kl_num_not(a))
+KL_NUMARRAY_KERNEL1(kl_numarray_absv, kl_numarray_abs(a), kl_num_abs(a))
+KL_NUMARRAY_KERNEL1(kl_numarray_signv, _mm_sub_epi32(BOOL(_mm_cmpgt_epi32(a, ZERO)), BOOL(_mm_cmplt_epi32(a, ZERO))),
+                   kl_num_sign(a))
+
+KL_NUMARRAY_SCALAR(kl_numarray_powv, kl_num_pow(a, b))
+KL_NUMARRAY_SCALAR(kl_numarray_atan2v, kl_num_atan2(a, b))
+
+KL_NUMARRAY_KERNEL3(kl_numarray_clampv, kl_numarray_min(kl_numarray_max(a, b), c), kl_num_clamp(a, b, c))
+KL_NUMARRAY_KERNEL3(kl_numarray_muladdv, _mm_add_epi32(kl_numarray_mul(a, b), c), kl_num_muladd(a, b, c))
+KL_NUMARRAY_KERNEL3(kl_numarray_lerpv, kl_numarray_lerp(a, b, c), kl_num_lerp(a, b, c))
+
+KL_NUMARRAY_KERNEL(kl_numarray_eq,  BOOL(_mm_cmpeq_epi32(a, b)), kl_inttonum(a == b))
+KL_NUMARRAY_KERNEL(kl_numarray_neq, _mm_andnot_si128(_mm_cmpeq_epi32(a, b), ONE), kl_inttonum(a != b))
+KL_NUMARRAY_KERNEL(kl_numarray_lt,  BOOL(_mm_cmplt_epi32(a, b)), kl_inttonum(a < b))
+KL_NUMARRAY_KERNEL(kl_numarray_gt,  BOOL(_mm_cmpgt_epi32(a, b)), kl_inttonum(a > b))
+KL_NUMARRAY_KERNEL(kl_numarray_leq, _mm_andnot_si128(_mm_cmpgt_epi32(a, b), ONE), kl_inttonum(a <= b))
+KL_NUMARRAY_KERNEL(kl_numarray_geq, _mm_andnot_si128(_mm_cmplt_epi32(a, b), ONE), kl_inttonum(a >= b))
+KL_NUMARRAY_KERNEL(kl_numarray_cmp, _mm_sub_epi32(BOOL(_mm_cmpgt_epi32(a, b)), BOOL(_mm_cmplt_epi32(a, b))),
+                   kl_inttonum(a < b ? -1 : a > b ? 1 : 0))
+
+int kl_numarray_binop(int op, kl_number_t *z, const kl_number_t *x, int sx, const kl_number_t *y, int sy,
+                      size_t n) {
+  switch (op) {
+    case KL_ADD:    kl_numarray_add(z, x, sx, y, sy, n);        return 0;
+    case KL_SUB:    kl_numarray_sub(z, x, sx, y, sy, n);        return 0;
+    case KL_MUL:    kl_numarray_mul_kernel(z, x, sx, y, sy, n); return 0;
+    case KL_DIV:    kl_numarray_div(z, x, sx, y, sy, n);        return 0;
+    case KL_FDIV:   kl_numarray_fdiv(z, x, sx, y, sy, n);       return 0;
+    case KL_MOD:    kl_numarray_mod(z, x, sx, y, sy, n);        return 0;
+    case KL_ASHFTL: kl_numarray_ashftl(z, x, sx, y, sy, n);     return 0;
+    case KL_ASHFTR: kl_numarray_ashftr(z, x, sx, y, sy, n);     return 0;
+    case KL_LSHFTL: kl_numarray_lshftl(z, x, sx, y, sy, n);     return 0;
+    case KL_LSHFTR: kl_numarray_lshftr(z, x, sx, y, sy, n);     return 0;
+    case KL_BITAND: kl_numarray_bitand(z, x, sx, y, sy, n);     return 0;
+    case KL_BITOR:  kl_numarray_bitor(z, x, sx, y, sy, n);      return 0;
+    case KL_BITXOR: kl_numarray_bitxor(z, x, sx, y, sy, n);     return 0;
+    case KL_LOGAND: kl_numarray_logand(z, x, sx, y, sy, n);     return 0;
+    case KL_LOGOR:  kl_numarray_logor(z, x, sx, y, sy, n);      return 0;
+    case KL_EQ:     kl_numarray_eq(z, x, sx, y, sy, n);         return 0;
+    case KL_NEQ:    kl_numarray_neq(z, x, sx, y, sy, n);        return 0;
+    case KL_LT:     kl_numarray_lt(z, x, sx, y, sy, n);         return 0;
+    case KL_GT:     kl_numarray_gt(z, x, sx, y, sy, n);         return 0;
+    case KL_LEQ:    kl_numarray_leq(z, x, sx, y, sy, n);        return 0;
+    case KL_GEQ:    kl_numarray_geq(z, x, sx, y, sy, n);        return 0;
+    case KL_CMP:    kl_numarray_cmp(z, x, sx, y, sy, n);        return 0;
+    case KL_MIN:    kl_numarray_minv(z, x, sx, y, sy, n);       return 0;
+    case KL_MAX:    kl_numarray_maxv(z, x, sx, y, sy, n);       return 0;
+    case KL_POW:    kl_numarray_powv(z, x, sx, y, sy, n);       return 0;
+    case KL_ATAN2:  kl_numarray_atan2v(z, x, sx, y, sy, n);     return 0;
+  }
+  return -1;
+}
+
+int kl_numarray_ternop(int op, kl_number_t *z, const kl_number_t *x, int sx, const kl_number_t *y, int sy,
+                       const kl_number_t *w, int sw, size_t n) {
+  switch (op) {
+    case KL_CLAMP: kl_numarray_clampv(z, x, sx, y, sy, w, sw, n); return 0;
+    case KL_LERP:  kl_numarray_lerpv(z, x, sx, y, sy, w, sw, n);  return 0;
+    case KL_MULADD: kl_numarray_muladdv(z, x, sx, y, sy, w, sw, n); return 0;
+    case KL_ADDMUL: kl_numarray_muladdv(z, y, sy, w, sw, x, sx, n); return 0;
+  }
+  return -1;
+}
+
+/* unary operators reuse the binary kernels with a broadcast constant where they can */
+int kl_numarray_unop(int op, kl_number_t *z, const kl_number_t *x, size_t n) {
+  static const kl_number_t zero = KL_NUM_ZERO;
+
+  switch (op) {
+    case KL_UADD:   kl_numarray_add(z, &zero, 1, x, 0, n);    return 0;
+    case KL_USUB:   kl_numarray_sub(z, &zero, 1, x, 0, n);    return 0;
+    case KL_BITNOT: kl_numarray_bitnot(z, x, n);              return 0;
+    case KL_LOGNOT: kl_numarray_eq(z, x, 0, &zero, 1, n);     return 0;
+    case KL_ABS:    kl_numarray_absv(z, x, n);                return 0;
+    case KL_SIGN:   kl_numarray_signv(z, x, n);               return 0;
+    case KL_SINE:   for (size_t i=0; i < n; i++) z[i] = kl_num_sin(x[i]); return 0;
+    case KL_COSINE: for (size_t i=0; i < n; i++) z[i] = kl_num_cos(x[i]); return 0;
+    case KL_LOG_2:  for (size_t i=0; i < n; i++) z[i] = kl_num_lb(x[i]);  return 0;
+    case KL_LOG_E:  for (size_t i=0; i < n; i++) z[i] = kl_num_ln(x[i]);  return 0;
+    case KL_LOG_10: for (size_t i=0; i < n; i++) z[i] = kl_num_lg(x[i]);  return 0;
+    case KL_SQRT:   for (size_t i=0; i < n; i++) z[i] = kl_num_sqrt(x[i]); return 0;
+    case KL_EXP_E:  for (size_t i=0; i < n; i++) z[i] = kl_num_exp(x[i]);  return 0;
+    case KL_EXP_2:  for (size_t i=0; i < n; i++) z[i] = kl_num_exp2(x[i]); return 0;
+    case KL_TANGENT: for (size_t i=0; i < n; i++) z[i] = kl_num_tan(x[i]); return 0;
+  }
+  return -1;
+}
+
+#if KL_NUMARRAY_SSE2
+/* each 64-bit lane shifted down by 32, sign extended */
+static inline __m128i kl_numarray_high(__m128i p) {
+  return _mm_or_si128(_mm_srli_epi64(p, 32), _mm_and_si128(_mm_srai_epi32(p, 31), _mm_set_epi32(-1, 0, -1, 0)));
+}
+#endif
+
+#if KL_NUM_FIXED
+/* products are split at half the width of kl_num_wide_t, the high halves summed signed and the low ones
+ * unsigned, so that neither sum overflows within a run.  runs are folded together in the same form */
+#define KL_NUMARRAY_DOTRUN ((size_t)1 << 24)
+#define KL_NUMARRAY_HALF   (4 * (int)sizeof(kl_num_wide_t))
+
+kl_num_wide_t kl_numarray_dot(const kl_number_t *x, const kl_number_t *y, size_t n) {
+  const kl_num_wide_t one = (kl_num_wide_t)1 << KL_NUMARRAY_HALF;
+  const kl_num_wide_t top = ((kl_num_wide_t)1 << (KL_NUMARRAY_HALF - 1)) - 1; /* largest high half */
+  kl_num_wide_t       hi  = 0, lo = 0;
+  size_t              i   = 0;
+  while (i < n) {
+    size_t end = n - i > KL_NUMARRAY_DOTRUN ? i + KL_NUMARRAY_DOTRUN : n;
+#if KL_NUMARRAY_SSE2
+    const __m128i low = _mm_set_epi32(0, -1, 0, -1);
+    __m128i h = _mm_setzero_si128(), l = _mm_setzero_si128();
+    __m128i even, odd;
+    for (; i + 4 <= end; i += 4) {
+      __m128i a = _mm_loadu_si128((const __m128i*)(x + i));
+      __m128i b = _mm_loadu_si128((const __m128i*)(y + i));
+      kl_numarray_mul64(a, b, &even, &odd);
+      h = _mm_add_epi64(h, _mm_add_epi64(kl_numarray_high(even), kl_numarray_high(odd)));
+      l = _mm_add_epi64(l, _mm_add_epi64(_mm_and_si128(even, low), _mm_and_si128(odd, low)));
+    }
+    /* the remainder, and all of a vec2 or vec3, goes through zero-padded lanes */
+    if (i < end) {
+      kl_number_t pa[4] = { 0 }, pb[4] = { 0 };
+      memcpy(pa, x + i, (end - i) * sizeof(kl_number_t));
+      memcpy(pb, y + i, (end - i) * sizeof(kl_number_t));
+      kl_numarray_mul64(_mm_loadu_si128((const __m128i*)pa), _mm_loadu_si128((const __m128i*)pb), &even, &odd);
+      h = _mm_add_epi64(h, _mm_add_epi64(kl_numarray_high(even), kl_numarray_high(odd)));
+      l = _mm_add_epi64(l, _mm_add_epi64(_mm_and_si128(even, low), _mm_and_si128(odd, low)));
+      i = end;
+    }
+    int64_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, h);
+    _mm_storeu_si128((__m128i*)(lanes + 2), l);
+    hi += lanes[0] + lanes[1];
+    lo += lanes[2] + lanes[3];
+#endif
+    for (; i < end; i++) {
+      kl_num_wide_t p = (kl_num_wide_t)x[i] * y[i];
+      hi += p >> KL_NUMARRAY_HALF;
+      lo += p & (one - 1);
+    }
+    hi += lo >> KL_NUMARRAY_HALF;
+    lo &= one - 1;
+  }
+  if (hi > top) return top * one + (one - 1);
+  if (hi < -top - 1) return (-top - 1) * one;
+  return hi * one + lo;
+}
+#else
+kl_num_wide_t kl_numarray_dot(const kl_number_t *x, const kl_number_t *y, size_t n) {
+  kl_num_wide_t sum = 0;
+  for (size_t i=0; i < n; i++) sum += (kl_num_wide_t)x[i] * y[i];
+  return sum;
+}
+#endif
+
+/* each component is truncated like the spelled-out a.y * b.z - a.z * b.y would be */
+void kl_numarray_cross(kl_number_t *z, const kl_number_t *x, const kl_number_t *y) {
+#if KL_NUMARRAY_SSE2
+  kl_number_t pa[4] = { x[0], x[1], x[2], 0 };
+  kl_number_t pb[4] = { y[0], y[1], y[2], 0 };
+  kl_number_t pz[4];
+  __m128i a = _mm_loadu_si128((const __m128i*)pa);
+  __m128i b = _mm_loadu_si128((const __m128i*)pb);
+  __m128i c = _mm_sub_epi32(
+    kl_numarray_mul(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 0, 2, 1)), _mm_shuffle_epi32(b, _MM_SHUFFLE(3, 1, 0, 2))),
+    kl_numarray_mul(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 1, 0, 2)), _mm_shuffle_epi32(b, _MM_SHUFFLE(3, 0, 2, 1))));
+  _mm_storeu_si128((__m128i*)pz, c);
+  memcpy(z, pz, 3 * sizeof(kl_number_t));
+#else
+  kl_number_t c[3] = {
+    kl_num_mul(x[1], y[2]) - kl_num_mul(x[2], y[1]),
+    kl_num_mul(x[2], y[0]) - kl_num_mul(x[0], y[2]),
+    kl_num_mul(x[0], y[1]) - kl_num_mul(x[1], y[0]),
+  };
+  memcpy(z, c, sizeof(c));
+#endif
+}
+
+/* saturates rather than wrapping when the length doesn't fit */
+kl_number_t kl_numarray_length(const kl_number_t *x, size_t n) {
+  return kl_num_widesqrt(kl_numarray_dot(x, x, n));
+}
+
+/* a zero vector stays zero */
+void kl_numarray_normalize(kl_number_t *z, const kl_number_t *x, size_t n) {
+  kl_number_t len = kl_numarray_length(x, n);
+  for (size_t i=0; i < n; i++) {
+    z[i] = len != 0 ? (kl_number_t)kl_num_div(x[i], len) : KL_NUM_ZERO;
+  }
+}
+
+void kl_numarray_rotate(kl_number_t *z, const kl_number_t *x, size_t n, kl_number_t theta) {
+  if (z != x) memmove(z, x, n * sizeof(kl_number_t));
+  if (n < 2) return;
+
+  kl_number_t s, c;
+  kl_num_sincos(theta, &s, &c);
+  kl_num_wide_t x0 = x[0], x1 = x[1];
+  z[0] = kl_num_narrow(x0 * c - x1 * s);
+  z[1] = kl_num_narrow(x0 * s + x1 * c);
+}
+
+void kl_numarray_sincos(kl_number_t *s, kl_number_t *c, const kl_number_t *x, size_t n) {
+  for (size_t i=0; i < n; i++) kl_num_sincos(x[i], &s[i], &c[i]);
+}
@@ -0,0 +1,33 @@
+#ifndef KL_NUMARRAY_H
+#define KL_NUMARRAY_H
+
+#include "number.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* element-wise kernels over contiguous kl_number_t buffers, used for array operands in the vm.  a
+ * nonzero sx or sy broadcasts x[0] or y[0] to every element.  opcodes that map onto integer vector
+ * instructions run as SIMD loops, the rest (division, variable shifts, table lookups) as tight scalar
+ * loops.  both return -1 for opcodes that have no element-wise form */
+
+#define KL_NUMARRAY_ALIGN 64
+
+int kl_numarray_binop(int op, kl_number_t *z, const kl_number_t *x, int sx, const kl_number_t *y, int sy,
+                      size_t n);
+int kl_numarray_unop(int op, kl_number_t *z, const kl_number_t *x, size_t n);
+int kl_numarray_ternop(int op, kl_number_t *z, const kl_number_t *x, int sx, const kl_number_t *y, int sy,
+                       const kl_number_t *w, int sw, size_t n);
+
+/* vector math.  vec2, vec3 and vec4 are arrays of two to four elements; dot, length and normalize take
+ * any length, cross reads exactly three elements and rotate turns the first two */
+kl_num_wide_t kl_numarray_dot(const kl_number_t *x, const kl_number_t *y, size_t n); /* unshifted, saturated */
+void          kl_numarray_cross(kl_number_t *z, const kl_number_t *x, const kl_number_t *y);
+kl_number_t   kl_numarray_length(const kl_number_t *x, size_t n);
+void          kl_numarray_normalize(kl_number_t *z, const kl_number_t *x, size_t n);
+void          kl_numarray_rotate(kl_number_t *z, const kl_number_t *x, size_t n, kl_number_t theta);
+
+/* sine into s and cosine into c of every element */
+void          kl_numarray_sincos(kl_number_t *s, kl_number_t *c, const kl_number_t *x, size_t n);
+
+#endif /* KL_NUMARRAY_H */
@@ -2,12 +2,23 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
+#include <math.h>
 
+/* the 32-bit formats use the integer engine, whose sine and logarithm tables are regenerated for the
+ * finer Q8.24 (see tools/tablegen.c).  the 64-bit formats use none */
+#if KL_NUM_FORMAT == KL_NUM_Q16_16
 #include "trigtable.h"
 #include "logtable.h"
+#include "exptable.h"
+#elif KL_NUM_FORMAT == KL_NUM_Q8_24
+#include "trigtable24.h"
+#include "logtable24.h"
+#include "exptable.h"
+#endif
 
-/* FIXME: detect overflow in conversions */
+/* FIXME: these two do not detect overflow -- kl_num_parse does */
 
 kl_number_t kl_strtoinum(char *str, int n) {
   kl_number_t result = kl_inttonum(0);
@@ -43,64 +54,582 @@ kl_number_t kl_strtofnum(char *str, int n) {
   return kl_num_div(result, divisor);
 }
 
+/* literals are converted eight digits at a time, across the byte lanes of one 64-bit word: the first
+ * character goes in the lowest byte, whatever the byte order */
+static inline uint64_t kl_num_load8(const char *s) {
+  uint64_t v;
+  memcpy(&v, s, 8);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  return v;
+}
+/* how many of the eight characters are decimal digits before the first that is not -- a byte is a digit
+ * if its high nibble is 3 before and after adding 6.  a carry out of a byte that is not a digit only
+ * spoils those after it */
+static inline int kl_num_run8(uint64_t v) {
+  uint64_t z = ((v & UINT64_C(0xF0F0F0F0F0F0F0F0)) ^ UINT64_C(0x3030303030303030)) |
+               (((v + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) ^ UINT64_C(0x3030303030303030));
+  return z ? __builtin_ctzll(z) >> 3 : 8;
+}
+
+const uint64_t kl_num_tens[20] = {
+  UINT64_C(1),                UINT64_C(10),                UINT64_C(100),
+  UINT64_C(1000),             UINT64_C(10000),             UINT64_C(100000),
+  UINT64_C(1000000),          UINT64_C(10000000),          UINT64_C(100000000),
+  UINT64_C(1000000000),       UINT64_C(10000000000),       UINT64_C(100000000000),
+  UINT64_C(1000000000000),    UINT64_C(10000000000000),    UINT64_C(100000000000000),
+  UINT64_C(1000000000000000), UINT64_C(10000000000000000), UINT64_C(100000000000000000),
+  UINT64_C(1000000000000000000), UINT64_C(10000000000000000000)
+};
+
+/* the length of the run of digits from s, up to end, and the value of it in *v if no longer than 19 */
+static int kl_num_digits(const char *s, const char *end, uint64_t *v) {
+  uint64_t acc = 0;
+  int      n   = 0;
+  for (;;) {
+    uint64_t w = kl_num_load8(s + n);
+    int      r = kl_num_run8(w);
+    if (r > end - s - n) r = end - s - n;
+    if (r == 8) {
+      acc = acc * 100000000 + kl_num_digit8(w);
+    } else if (r == 1) {
+      acc = acc * 10 + (w & 0x0F);
+    } else if (r > 0) {
+      /* the digits to the top lanes, under leading zeros */
+      acc = acc * kl_num_tens[r] + kl_num_digit8(w << (64 - 8 * r) | KL_NUM_ZEROS8 >> (8 * r));
+    }
+    n += r;
+    if (r < 8) break;
+  }
+  *v = acc;
+  return n;
+}
+
+#if KL_NUM_FIXED
+/* the fraction, rounded toward zero, is floor(f * 2^F) for the first F decimals f.  no boundary between
+ * two numbers has more than F decimals, so the ones after cannot cross it.  the F decimals as an integer,
+ * over 10^F and times 2^F, leave a division by 5^F -- done a group of eight at a time from the last, so
+ * that everything stays within 64 bits */
+int kl_num_fromdecimal(int neg, uint64_t ipart, const uint64_t *group, int ng, kl_number_t *num) {
+  uint64_t fpart = 0;
+  for (int j=ng - 1; j >= 0; j--) {
+    fpart = ((group[j] << (KL_NUM_FBITS - 8 - 8 * j)) + fpart) / 390625; /* 5^8 */
+  }
+
+  /* a negative number reaches one further */
+  uint64_t limit = (uint64_t)KL_NUM_MAX + neg;
+  if (ipart > limit >> KL_NUM_FBITS) return -2;
+  uint64_t mag = ipart << KL_NUM_FBITS | fpart;
+  if (mag > limit) return -2;
+  *num = (kl_number_t)(kl_num_bits_t)(neg ? 0 - mag : mag);
+  return 0;
+}
+#endif
+
+int kl_num_parse(const char *str, int n, kl_number_t *num) {
+  const char *end = str + n;
+  int         neg = 0;
+  if (str < end && (*str == '+' || *str == '-')) neg = *str++ == '-';
+
+  const char *p = str;
+  while (p < end && *p == '0') p++;
+  uint64_t ipart;
+  int      ni = kl_num_digits(p, end, &ipart);
+  p += ni;
+  int      nz = p - str; /* integer digits, leading zeros included */
+
+#if KL_NUM_FIXED
+  /* decimals past the groups that make a difference are only checked */
+  uint64_t group[KL_NUM_GROUPS];
+  int      ng = 0, nf = 0;
+  if (p < end && *p == '.') {
+    p++;
+    for (;;) {
+      uint64_t w = kl_num_load8(p);
+      int      r = kl_num_run8(w);
+      if (r > end - p) r = end - p;
+      if (ng < KL_NUM_GROUPS) {
+        /* the digits in the bottom lanes, followed by zeros */
+        uint64_t m = r == 8 ? ~UINT64_C(0) : (UINT64_C(1) << (8 * r)) - 1;
+        group[ng++] = kl_num_digit8((w & m) | (KL_NUM_ZEROS8 & ~m));
+      }
+      p  += r;
+      nf += r;
+      if (r < 8) break;
+    }
+  }
+  if (p != end || nz + nf == 0) return -1;
+  if (ni > 19) return -2;
+  return kl_num_fromdecimal(neg, ipart, group, ng, num);
+#else
+  /* digits that fit a double exactly, over a power of ten that does too, are a single correctly rounded
+   * division.  anything longer goes to strtod */
+  static const double tens[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+  const char *fp = p;
+  uint64_t    fpart = 0;
+  int         nf = 0;
+  if (p < end && *p == '.') {
+    fp = ++p;
+    nf = kl_num_digits(p, end, &fpart);
+    p += nf;
+  }
+  if (p != end || nz + nf == 0) return -1;
+
+  if (ni + nf <= 19) {
+    uint64_t m = ipart * kl_num_tens[nf] + fpart;
+    if (m <= (UINT64_C(1) << 53)) {
+      *num = (neg ? -(double)m : (double)m) / tens[nf];
+      return 0;
+    }
+  }
+  char buf[0x0100];
+  if (ni + nf + 4 > (int)sizeof(buf)) return -2;
+  int k = 0;
+  buf[k++] = neg ? '-' : '+';
+  buf[k++] = '0';
+  memcpy(buf + k, str + nz - ni, ni);
+  k += ni;
+  buf[k++] = '.';
+  memcpy(buf + k, fp, nf);
+  k += nf;
+  buf[k] = '\0';
+  double v = strtod(buf, NULL);
+  if (v == HUGE_VAL || v == -HUGE_VAL) return -2;
+  *num = v;
+  return 0;
+#endif
+}
+
 kl_number_t kl_strtonum(char *str, int n) {
-  int decimal = -1;
-  for (int i=0; i<n; i++) {
-    char c = str[i];
-    if (c == '.') {
-      decimal = i;
-    } else assert(c >= '0' && c <= '9');
+  char        buf[0x0100 + KL_NUM_PARSE_PAD];
+  kl_number_t num;
+  if (n > 0x0100) return KL_NUM_ZERO;
+  memcpy(buf, str, n);
+
+  int e = kl_num_parse(buf, n, &num);
+  assert(e != -1);
+  if (e == -2) return str[0] == '-' ? -KL_NUM_MAX : KL_NUM_MAX;
+  return e < 0 ? KL_NUM_ZERO : num;
+}
+
+#if KL_NUM_FIXED
+static const char kl_num_pairs[200] =
+  "00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839"
+  "40414243444546474849" "50515253545556575859" "60616263646566676869" "70717273747576777879"
+  "80818283848586878889" "90919293949596979899";
+
+/* the last n digits of v, leading zeros included, two at a time from the end */
+static void kl_num_putdigits(char *s, uint64_t v, int n) {
+  for (; n >= 2; n -= 2, v /= 100) memcpy(s + n - 2, kl_num_pairs + 2 * (v % 100), 2);
+  if (n) s[0] = '0' + v % 10;
+}
+#endif
+
+int kl_num_format(kl_number_t a, char *buf) {
+#if KL_NUM_FIXED
+  char    *s   = buf;
+  uint64_t mag = a < 0 ? (kl_num_bits_t)(0 - (kl_num_bits_t)a) : (uint64_t)a;
+  if (a < 0) *s++ = '-';
+
+  uint64_t ipart = mag >> KL_NUM_FBITS;
+  int      ni    = 1;
+  while (ni < 19 && ipart >= kl_num_tens[ni]) ni++;
+  kl_num_putdigits(s, ipart, ni);
+  s += ni;
+
+  /* kl_num_parse reads back any decimal d with fr <= d * 2^F < fr + 1, so the shortest is the first
+   * k for which the least k-decimal d >= fr / 2^F still falls short of the next number.  over 10^k the
+   * 2^k cancels, leaving 5^k against 2^(F-k) -- within 64 bits for the k that can be needed */
+  uint64_t fr = mag & KL_NUM_FMASK;
+  if (fr != 0) {
+    uint64_t five = 1, d;
+    int      k    = 0;
+    do {
+      k++;
+      five *= 5;
+      d     = (fr * five + (UINT64_C(1) << (KL_NUM_FBITS - k)) - 1) >> (KL_NUM_FBITS - k);
+    } while ((d << (KL_NUM_FBITS - k)) >= (fr + 1) * five);
+    *s++ = '.';
+    kl_num_putdigits(s, d, k);
+    s += k;
+  }
+  *s = '\0';
+  return s - buf;
+#else
+  /* no integer shortcut for a double.  any decimal of up to 15 digits is the only one of its length that
+   * reads back, and %g drops the trailing zeros, so 15 digits give the shortest if anything that short
+   * does -- else 16, and 17 always do */
+  for (int p=15; ; p++) {
+    int n = snprintf(buf, KL_NUM_STRLEN, "%.*g", p, a);
+    if (p == 17 || strtod(buf, NULL) == a) return n;
   }
-  if (decimal < 1) {
-    return kl_strtoinum(str, n);
+#endif
+}
+
+void kl_numwriter_init(kl_numwriter_t *w, FILE *out) {
+  w->out = out;
+  w->n   = 0;
+}
+void kl_numwriter_flush(kl_numwriter_t *w) {
+  fwrite(w->buf, 1, w->n, w->out);
+  w->n = 0;
+}
+void kl_numwriter_str(kl_numwriter_t *w, const char *str, int n) {
+  if (w->n + n > KL_NUMWRITER_BUFSIZE) {
+    kl_numwriter_flush(w);
+    if (n > KL_NUMWRITER_BUFSIZE) {
+      fwrite(str, 1, n, w->out);
+      return;
+    }
   }
-  return kl_strtoinum(str, decimal) + kl_strtoinum(str+(decimal+1), n);
+  memcpy(w->buf + w->n, str, n);
+  w->n += n;
+}
+void kl_numwriter_num(kl_numwriter_t *w, kl_number_t a) {
+  if (w->n + KL_NUM_STRLEN > KL_NUMWRITER_BUFSIZE) kl_numwriter_flush(w);
+  w->n += kl_num_format(a, w->buf + w->n);
+}
+
+kl_number_t kl_doubletonum(double a) {
+#if KL_NUM_FIXED
+  double v = floor(a * KL_NUM_FDIV + 0.5);
+  if (v != v) return KL_NUM_ZERO;
+  if (v >= (double)KL_NUM_MAX) return KL_NUM_MAX;
+  if (v <= -(double)KL_NUM_MAX) return -KL_NUM_MAX;
+  return (kl_number_t)v;
+#else
+  return a != a ? KL_NUM_ZERO : a;
+#endif
+}
+
+#if KL_NUM_INT32
+KL_NUM_TABLE(sine, sine_values, KL_SINE_BITS, KL_SINE_FBITS, KL_SINE_LERP)
+KL_NUM_TABLE(lb, lb_values, KL_LB_BITS, KL_LB_FBITS, KL_LB_LERP)
+
+/* theta in quarter turns, Q.32, so the integer part is the quadrant */
+#define KL_NUM_TWO_OVER_PI_Q32 INT64_C(0xA2F9836E)
+
+/* sine at quadrant q plus fraction f (Q0.32) of the next quarter turn */
+static inline kl_number_t kl_num_sine_at(int q, uint64_t f) {
+  /* mirror the second and fourth quadrants, negate the third and fourth -- without branches, since
+   * sincos takes the mirror for one result and not the other */
+  uint64_t    m = -(uint64_t)(q & 1);
+  kl_number_t s = -((q >> 1) & 1);
+  kl_number_t n = kl_num_sine_lookup(((f ^ m) - m) + (m & (UINT64_C(1) << 32)));
+
+  return (n ^ s) - s;
 }
 
 kl_number_t kl_num_sin(kl_number_t theta) {
-  kl_number_t x = kl_num_div(theta, KL_NUM_HALFPI);
-  int         i = kl_floorint(x << 10);
+  int64_t p = ((int64_t)theta * KL_NUM_TWO_OVER_PI_Q32) >> KL_NUM_FBITS;
+  return kl_num_sine_at((int)(p >> 32), (uint32_t)p);
+}
+
+/* a quarter turn ahead of the sine, with the same reduction */
+kl_number_t kl_num_cos(kl_number_t theta) {
+  int64_t p = ((int64_t)theta * KL_NUM_TWO_OVER_PI_Q32) >> KL_NUM_FBITS;
+  return kl_num_sine_at((int)(p >> 32) + 1, (uint32_t)p);
+}
+
+void kl_num_sincos(kl_number_t theta, kl_number_t *s, kl_number_t *c) {
+  int64_t  p = ((int64_t)theta * KL_NUM_TWO_OVER_PI_Q32) >> KL_NUM_FBITS;
+  int      q = (int)(p >> 32);
+  uint64_t f = (uint32_t)p;
+  *s = kl_num_sine_at(q, f);
+  *c = kl_num_sine_at(q + 1, f);
+}
+#endif
+
+/* round-up method (Granlund & Montgomery): with N = 32 + KL_NUM_FBITS and l = ceil(lb |div|),
+ * mul = floor(2^(N+l) / |div|) + 1 is below 2^(N+1) and its error is small enough that the shifted
+ * product is exact for all |n| < 2^N */
+int kl_num_magic(kl_number_t div, kl_num_magic_t *m) {
+#if KL_NUM_MAGIC
+  uint32_t d = div < 0 ? -(uint32_t)div : (uint32_t)div;
+  if (d <= 1) return -1;
+
+  int l = 32 - __builtin_clz(d - 1);
+  m->shift = 32 + KL_NUM_FBITS + l;
+  m->mul   = (uint64_t)(((unsigned __int128)1 << m->shift) / d) + 1;
+  m->div   = div;
+  return 0;
+#else
+  (void)div;
+  (void)m;
+  return -1;
+#endif
+}
 
-  /* extract sign from quadrant */
-  int s = i < 0;
-  i  = abs(i);
-  s ^= (i >> 11) & 1;
+/* 1/sqrt(m) at the middle of each 1/64 step of 1 <= m < 4, Q0.16 */
+static const uint16_t rsqrt_values[0xC0] = {
+  0xff01, 0xfd0d, 0xfb24, 0xf946, 0xf773, 0xf5a9, 0xf3ea, 0xf234,
+  0xf087, 0xeee2, 0xed46, 0xebb3, 0xea27, 0xe8a3, 0xe727, 0xe5b1,
+  0xe443, 0xe2db, 0xe17a, 0xe020, 0xdecb, 0xdd7c, 0xdc34, 0xdaf1,
+  0xd9b3, 0xd87b, 0xd748, 0xd61a, 0xd4f1, 0xd3cd, 0xd2ad, 0xd192,
+  0xd07b, 0xcf69, 0xce5a, 0xcd50, 0xcc4a, 0xcb48, 0xca49, 0xc94f,
+  0xc858, 0xc764, 0xc674, 0xc587, 0xc49d, 0xc3b7, 0xc2d4, 0xc1f4,
+  0xc116, 0xc03c, 0xbf65, 0xbe90, 0xbdbe, 0xbcef, 0xbc23, 0xbb59,
+  0xba91, 0xb9cc, 0xb90a, 0xb84a, 0xb78c, 0xb6d0, 0xb617, 0xb560,
+  0xb4ab, 0xb3f8, 0xb347, 0xb298, 0xb1eb, 0xb140, 0xb097, 0xaff0,
+  0xaf4b, 0xaea7, 0xae06, 0xad66, 0xacc8, 0xac2b, 0xab90, 0xaaf7,
+  0xaa5f, 0xa9c9, 0xa934, 0xa8a1, 0xa810, 0xa77f, 0xa6f1, 0xa663,
+  0xa5d8, 0xa54d, 0xa4c4, 0xa43c, 0xa3b6, 0xa330, 0xa2ac, 0xa22a,
+  0xa1a8, 0xa128, 0xa0a9, 0xa02b, 0x9fae, 0x9f32, 0x9eb7, 0x9e3e,
+  0x9dc6, 0x9d4e, 0x9cd8, 0x9c63, 0x9bef, 0x9b7b, 0x9b09, 0x9a98,
+  0x9a28, 0x99b8, 0x994a, 0x98dd, 0x9870, 0x9804, 0x979a, 0x9730,
+  0x96c7, 0x965e, 0x95f7, 0x9591, 0x952b, 0x94c6, 0x9462, 0x93ff,
+  0x939c, 0x933a, 0x92d9, 0x9279, 0x9219, 0x91bb, 0x915d, 0x90ff,
+  0x90a3, 0x9047, 0x8feb, 0x8f91, 0x8f37, 0x8edd, 0x8e85, 0x8e2d,
+  0x8dd5, 0x8d7e, 0x8d28, 0x8cd3, 0x8c7e, 0x8c2a, 0x8bd6, 0x8b83,
+  0x8b30, 0x8ade, 0x8a8d, 0x8a3c, 0x89eb, 0x899c, 0x894c, 0x88fe,
+  0x88af, 0x8862, 0x8815, 0x87c8, 0x877c, 0x8730, 0x86e5, 0x869a,
+  0x8650, 0x8606, 0x85bd, 0x8574, 0x852c, 0x84e4, 0x849d, 0x8456,
+  0x840f, 0x83c9, 0x8384, 0x833f, 0x82fa, 0x82b5, 0x8271, 0x822e,
+  0x81eb, 0x81a8, 0x8166, 0x8124, 0x80e2, 0x80a1, 0x8060, 0x8020,
+};
+
+/* above 2^62 digit-by-digit, one result bit per iteration.  below, x is normalized to m in [2^60, 2^62)
+ * by an even shift, and two Newton steps on the table's 1/sqrt(m) (in Q.32) get within a few units of
+ * sqrt(m), which a compare and step makes exact */
+uint32_t kl_num_isqrt64(uint64_t x) {
+  if (x == 0) return 0;
 
-  /* clamp to range */
-  i &= i & 0x07FF;
+  int n = 0;
+  for (int i = 32; i > 0; i >>= 1) {
+    if (x >> (n + i)) n += i;
+  }
 
-  /* mirror across x-axis */
-  i = (i > 0x0400) ? 0x0800 - i : i;
+  if (n < 62) {
+    int      sh = (61 - n) & ~1;
+    uint64_t m  = x << sh;
+    uint64_t mh = m >> 30;
+    uint64_t y  = (uint64_t)rsqrt_values[(m >> 54) - 0x40] << 16;
+    for (int k=0; k < 2; k++) {
+      uint64_t t = (mh * ((y * y) >> 32)) >> 32;
+      y = (y * ((UINT64_C(3) << 30) - t)) >> 31;
+    }
+    uint64_t r = (mh * y) >> 32;
+    while (r * r > m) r--;
+    while ((r + 1) * (r + 1) <= m) r++;
+    return (uint32_t)(r >> (sh >> 1));
+  }
 
-  /* look up result */
-  kl_number_t n = sine_values[i];
+  uint64_t r   = 0;
+  uint64_t bit = (uint64_t)1 << (n & ~1);
+  while (bit != 0) {
+    uint64_t t = r + bit;
+    uint64_t m = -(uint64_t)(x >= t);
+    x  -= t & m;
+    r   = (r >> 1) | (bit & m);
+    bit >>= 2;
+  }
+  return (uint32_t)r;
+}
 
-  return s ? -n : n;
+/* the root of a sum of products, which have twice the fractional bits */
+kl_number_t kl_num_widesqrt(kl_num_wide_t x) {
+#if KL_NUM_INT32
+  uint32_t r = kl_num_isqrt64((uint64_t)x);
+  return r > (uint32_t)KL_NUM_MAX ? KL_NUM_MAX : (kl_number_t)r;
+#elif KL_NUM_FIXED
+  return x <= 0 ? KL_NUM_ZERO : kl_doubletonum(sqrt((double)x) / KL_NUM_FDIV);
+#else
+  return x <= 0 ? KL_NUM_ZERO : sqrt(x);
+#endif
 }
 
+#if KL_NUM_INT32
 kl_number_t kl_num_lb(kl_number_t x) {
   int n = 0;
   kl_number_t w = x;
-  for (int i = sizeof(kl_number_t) * 8 / 2; i >= 0; i--) {
+  for (int i = sizeof(kl_number_t) * 8 / 2; i > 0; i >>= 1) {
     if (w >= 1 << i) { w >>= i; n += i; }
   }
-  n -= KL_NUM_FBITS;
 
-  kl_number_t r = n < 0 ? KL_NUM_ONE >> -n : KL_NUM_ONE << n;
+  /* the bits below the leading one, as Q0.32 */
+  uint64_t f = ((uint64_t)(uint32_t)x << (32 - n)) & 0xFFFFFFFF;
+
+  return kl_inttonum(n - KL_NUM_FBITS) + kl_num_lb_lookup(f);
+}
+
+/* rounded to nearest: sqrt(v) >= r + 1/2 exactly when v > r*r + r */
+kl_number_t kl_num_sqrt(kl_number_t x) {
+  if (x <= 0) return KL_NUM_ZERO;
+  uint64_t v = (uint64_t)x << KL_NUM_FBITS;
+  uint64_t r = kl_num_isqrt64(v);
+  return (kl_number_t)(r + (v - r * r > r));
+}
+
+/* internal formats: angles and the CORDIC gain are Q2.30, logarithm and exponent arguments Q32.32.  lb e
+ * is kept to as many bits as a Q16.16 product with it has room for, fewer in Q8.24 */
+#define KL_NUM_PI_Q30   INT64_C(0xC90FDAA2)
+#define KL_NUM_LN2_Q32  UINT64_C(0xB17217F8)
+#define KL_NUM_LB_E_Q42 INT64_C(0x5C551D94AE1)
+#define KL_NUM_LB_E_EXP (58 - KL_NUM_FBITS)
+#define KL_NUM_LB_E_Q   ((KL_NUM_LB_E_Q42 + ((INT64_C(1) << (42 - KL_NUM_LB_E_EXP)) >> 1)) >> (42 - KL_NUM_LB_E_EXP))
+
+/* exp x overflows above the first and underflows below the second, lb of the largest number and of half
+ * the smallest, times ln 2 and rounded out */
+#define KL_NUM_EXP_HI kl_inttonum((31 - KL_NUM_FBITS) * 7 / 10 + 1)
+#define KL_NUM_EXP_LO kl_inttonum((KL_NUM_FBITS + 1) * 7 / 10 + 1)
+
+/* atan(2^-i), Q2.30 */
+#define KL_NUM_CORDIC_N 8
+static const int32_t atan_values[KL_NUM_CORDIC_N] = {
+  0x3243f6a9, 0x1dac6705, 0x0fadbafd, 0x07f56ea7, 0x03feab77, 0x01ffd55c, 0x00fffaab, 0x007fff55,
+};
+
+/* 2^x for a Q32.32 argument, rounded to the number format.  the top ten fractional bits index the table, the rest
+ * (below 2^-10) are applied as 1 + u + u^2/2 with u = r ln 2, in Q.40, which leaves a 2^-33 relative
+ * error on top of the table's rounding */
+static kl_number_t kl_num_exp2_q32(int64_t x) {
+  int64_t n = x >> 32;
+  if (n >= 31 - KL_NUM_FBITS)    return KL_NUM_MAX;
+  if (n < -(KL_NUM_FBITS + 1)) return KL_NUM_ZERO;
+
+  uint32_t f = (uint32_t)x;
+  uint64_t u = ((uint64_t)(f & 0x003FFFFF) * KL_NUM_LN2_Q32) >> 24;
+  u += (u * u) >> 41;
+
+  /* Q1.31 table entry into Q1.47 */
+  uint64_t t = exp2_values[f >> 22];
+  uint64_t m = (t << 16) + ((t * u) >> 24);
+
+  /* scale by 2^n into the number format */
+  int s = 47 - KL_NUM_FBITS - (int)n;
+  m = (m + ((uint64_t)1 << (s - 1))) >> s;
+  return m > KL_NUM_MAX ? KL_NUM_MAX : (kl_number_t)m;
+}
+
+/* lb x as Q32.32, one fractional bit per squaring of the mantissa */
+static int64_t kl_num_lb_q32(uint32_t x) {
+  int n = 0;
+  uint32_t w = x;
+  for (int i = sizeof(uint32_t) * 8 / 2; i > 0; i >>= 1) {
+    if (w >= (uint32_t)1 << i) { w >>= i; n += i; }
+  }
+
+  uint64_t m = (uint64_t)x << (31 - n); /* Q1.31, 1 <= m < 2 */
+  int64_t  r = (int64_t)(n - KL_NUM_FBITS) * ((int64_t)1 << 32);
+  for (int i = 31; i >= 0; i--) {
+    m = (m * m + ((uint64_t)1 << 30)) >> 31;
+    uint64_t b = m >> 32;
+    m >>= b;
+    r |= (int64_t)b << i;
+  }
+  return r;
+}
 
-  kl_number_t y = kl_num_div(x, r);
+kl_number_t kl_num_exp2(kl_number_t x) {
+  return kl_num_exp2_q32((int64_t)x * ((int64_t)1 << (32 - KL_NUM_FBITS)));
+}
 
-  /* ten most signficant fractional bits used for course lookup */
-  int i = (y >> (KL_NUM_FBITS - 10)) & 0x3FF;
-  kl_number_t z0 = lb_values[i];
-  kl_number_t z1 = lb_values[i+1];
+/* clamped first, everything outside underflows or overflows anyway, so the product keeps more bits of lb e */
+kl_number_t kl_num_exp(kl_number_t x) {
+  if (x >  KL_NUM_EXP_HI) return KL_NUM_MAX;
+  if (x < -KL_NUM_EXP_LO) return KL_NUM_ZERO;
+  return kl_num_exp2_q32(((int64_t)x * KL_NUM_LB_E_Q) >> (KL_NUM_FBITS + KL_NUM_LB_E_EXP - 32));
+}
 
-  /* least significant bits used for linear interpolation */
-  kl_number_t u = ((y << 10) & KL_NUM_FMASK);
+kl_number_t kl_num_pow(kl_number_t x, kl_number_t y) {
+  if (y == 0) return KL_NUM_ONE;
+  if (x == 0) return y > 0 ? KL_NUM_ZERO : KL_NUM_MAX;
 
-  kl_number_t z = kl_num_mul(z1, u) + kl_num_mul(z0, KL_NUM_ONE - u);
+  /* a negative base needs an integer exponent, and its parity picks the sign */
+  int neg = 0;
+  if (x < 0) {
+    if (y & KL_NUM_FMASK) return KL_NUM_ZERO;
+    neg = (y >> KL_NUM_FBITS) & 1;
+  }
+  uint32_t a = x < 0 ? -(uint32_t)x : (uint32_t)x;
+
+  /* number times Q32.32, split so neither product overflows */
+  int64_t l = kl_num_lb_q32(a);
+  int64_t e = (int64_t)y * (l >> KL_NUM_FBITS) + (((int64_t)y * (l & KL_NUM_FMASK)) >> KL_NUM_FBITS);
 
-  return kl_inttonum(n) + z;
+  kl_number_t r = kl_num_exp2_q32(e);
+  return neg ? -r : r;
+}
+
+/* vectoring mode: turns (x, y) onto the x axis, summing the angles it took.  the left half-plane is
+ * turned by pi first so the remainder is within the +-1.74 the iterations converge over, and what is
+ * left after them (below atan(2^-7)) is atan(y/x) = z - z^3/3 */
+kl_number_t kl_num_atan2(kl_number_t y, kl_number_t x) {
+  if (x == 0 && y == 0) return KL_NUM_ZERO;
+
+  int64_t px = x, py = y, a = 0;
+  if (px < 0) {
+    a  = py < 0 ? -KL_NUM_PI_Q30 : KL_NUM_PI_Q30;
+    px = -px;
+    py = -py;
+  }
+
+  /* scaled up to 2^30, which leaves room for the gain */
+  int64_t ay = py < 0 ? -py : py;
+  int64_t v  = px > ay ? px : ay;
+  int     n  = 0;
+  for (int i = 16; i > 0; i >>= 1) {
+    if (v >> (n + i)) n += i;
+  }
+  if (n < 30) {
+    px <<= 30 - n;
+    py <<= 30 - n;
+  }
+
+  /* d is 0 to turn clockwise and -1 to turn counterclockwise, (v ^ d) - d negates v when d is set */
+  for (int i=0; i < KL_NUM_CORDIC_N; i++) {
+    int64_t d  = (py - 1) >> 63;
+    int64_t dx = px >> i, dy = py >> i;
+    px += (dy ^ d) - d;
+    py -= (dx ^ d) - d;
+    a  += (atan_values[i] ^ d) - d;
+  }
+
+  int64_t z  = py * ((int64_t)1 << 30) / px;
+  int64_t z3 = (((z * z) >> 30) * z) >> 30;
+  a += z - z3 / 3;
+  return (kl_number_t)((a + ((INT64_C(1) << (30 - KL_NUM_FBITS)) >> 1)) >> (30 - KL_NUM_FBITS));
+}
+
+/* rotation mode: turns (1, 0) by theta (Q2.30, within +-1.74) and returns cos and sin, both scaled by
+ * the same CORDIC gain.  the angle left after the iterations (below atan(2^-7)) is turned through
+ * directly, with sin t = t - t^3/6 and cos t = 1 - t^2/2 */
+static void kl_num_cordic(int64_t theta, int64_t *c, int64_t *s) {
+  int64_t px = (int64_t)1 << 30, py = 0;
+  for (int i=0; i < KL_NUM_CORDIC_N; i++) {
+    int64_t d  = theta >> 63;
+    int64_t dx = px >> i, dy = py >> i;
+    px    -= (dy ^ d) - d;
+    py    += (dx ^ d) - d;
+    theta -= (atan_values[i] ^ d) - d;
+  }
+
+  int64_t t2 = (theta * theta) >> 30;
+  int64_t st = theta - ((theta * t2) >> 30) / 6;
+  int64_t ct = ((int64_t)1 << 30) - (t2 >> 1);
+  *c = (px * ct - py * st) >> 30;
+  *s = (py * ct + px * st) >> 30;
+}
+
+/* reduced by the nearest multiple of pi, the gain cancels in the quotient */
+kl_number_t kl_num_tan(kl_number_t theta) {
+  int64_t t = (int64_t)theta << (30 - KL_NUM_FBITS);
+  int64_t k = (t + (t < 0 ? -KL_NUM_PI_Q30 : KL_NUM_PI_Q30) / 2) / KL_NUM_PI_Q30;
+  t -= k * KL_NUM_PI_Q30;
+
+  int64_t c, s;
+  kl_num_cordic(t, &c, &s);
+  if (c <= 0) return s < 0 ? -KL_NUM_MAX : KL_NUM_MAX;
+
+  int64_t n = s * KL_NUM_FDIV;
+  int64_t q = (n < 0 ? n - c / 2 : n + c / 2) / c;
+  if (q > KL_NUM_MAX)  return KL_NUM_MAX;
+  if (q < -KL_NUM_MAX) return -KL_NUM_MAX;
+  return (kl_number_t)q;
 }
 
 /* taylor series expansion for sine (expensive!) */
@@ -109,7 +638,11 @@ kl_number_t kl_num_taylor_sin(kl_number_t x) {
   if (x == KL_NUM_HALFPI) { return KL_NUM_ONE; }
   if (x == 0) { return KL_NUM_ZERO; }
 
-  x <<= 4; /* Q16 to Q20 */
+#if KL_NUM_FBITS <= 20
+  x <<= 20 - KL_NUM_FBITS; /* to Q20 */
+#else
+  x >>= KL_NUM_FBITS - 20;
+#endif
 
   int32_t y  = x;
   int64_t n  = x;
@@ -127,5 +660,65 @@ kl_number_t kl_num_taylor_sin(kl_number_t x) {
   n  = (n * x2) >> 20; /* x^9 */
   y += n / 362880;     /* x^9/9! */
 
-  return y >> 4;
+#if KL_NUM_FBITS <= 20
+  return y >> (20 - KL_NUM_FBITS);
+#else
+  return y << (KL_NUM_FBITS - 20);
+#endif
+}
+
+#else
+/* the 64-bit formats have no tables, the C library evaluates everything in double precision and the
+ * result is rounded to the format.  the special cases are those of the integer engine */
+kl_number_t kl_num_sin(kl_number_t theta) {
+  return kl_doubletonum(sin(kl_numtodouble(theta)));
+}
+
+kl_number_t kl_num_cos(kl_number_t theta) {
+  return kl_doubletonum(cos(kl_numtodouble(theta)));
+}
+
+void kl_num_sincos(kl_number_t theta, kl_number_t *s, kl_number_t *c) {
+  double t = kl_numtodouble(theta);
+  *s = kl_doubletonum(sin(t));
+  *c = kl_doubletonum(cos(t));
+}
+
+kl_number_t kl_num_taylor_sin(kl_number_t x) {
+  return kl_num_sin(x);
+}
+
+kl_number_t kl_num_lb(kl_number_t x) {
+  if (x <= 0) return -KL_NUM_MAX;
+  return kl_doubletonum(log2(kl_numtodouble(x)));
+}
+
+kl_number_t kl_num_sqrt(kl_number_t x) {
+  if (x <= 0) return KL_NUM_ZERO;
+  return kl_doubletonum(sqrt(kl_numtodouble(x)));
+}
+
+kl_number_t kl_num_exp2(kl_number_t x) {
+  return kl_doubletonum(exp2(kl_numtodouble(x)));
+}
+
+kl_number_t kl_num_exp(kl_number_t x) {
+  return kl_doubletonum(exp(kl_numtodouble(x)));
+}
+
+kl_number_t kl_num_pow(kl_number_t x, kl_number_t y) {
+  if (y == 0) return KL_NUM_ONE;
+  if (x == 0) return y > 0 ? KL_NUM_ZERO : KL_NUM_MAX;
+  if (x < 0 && kl_numtodouble(y) != floor(kl_numtodouble(y))) return KL_NUM_ZERO;
+  return kl_doubletonum(pow(kl_numtodouble(x), kl_numtodouble(y)));
+}
+
+kl_number_t kl_num_atan2(kl_number_t y, kl_number_t x) {
+  if (x == 0 && y == 0) return KL_NUM_ZERO;
+  return kl_doubletonum(atan2(kl_numtodouble(y), kl_numtodouble(x)));
+}
+
+kl_number_t kl_num_tan(kl_number_t theta) {
+  return kl_doubletonum(tan(kl_numtodouble(theta)));
 }
+#endif
@@ -2,33 +2,173 @@
 #define KL_NUMBER_H
 
 #include <stdint.h>
+#include <stdio.h>
 
-typedef int32_t kl_number_t;
+/* numeric format, picked at build time with e.g. -DKL_NUM_FORMAT=KL_NUM_Q8_24.  Q16.16 is the default,
+ * Q8.24 trades range for precision, Q32.32 has both at twice the size and KL_NUM_DOUBLE is IEEE double.
+ * kl_num_wide_t holds the product of two numbers, exactly for the fixed-point formats */
+#define KL_NUM_Q16_16 0
+#define KL_NUM_Q8_24  1
+#define KL_NUM_Q32_32 2
+#define KL_NUM_DOUBLE 3
+
+#ifndef KL_NUM_FORMAT
+#define KL_NUM_FORMAT KL_NUM_Q16_16
+#endif
+
+#if KL_NUM_FORMAT == KL_NUM_Q16_16
+typedef int32_t  kl_number_t;
+typedef uint32_t kl_num_bits_t;
+typedef int64_t  kl_num_wide_t;
+#define KL_NUM_NAME   "Q16.16"
 #define KL_NUM_FBITS  16
 #define KL_NUM_FMASK  0x0000FFFF
 #define KL_NUM_FDIV   0x00010000
 #define KL_NUM_MSB    0x80000000
+#define KL_NUM_MAX    INT32_MAX
+#define KL_NUM_MIN    INT32_MIN
 #define KL_NUM_ONE    0x00010000
 #define KL_NUM_ZERO   0x00000000
 #define KL_NUM_HALF   0x00008000
 #define KL_NUM_TENTH  0x0000199A
 #define KL_NUM_PI     0x0003243F
-#define KL_NUM_HALFPI (KL_NUM_PI >> 1)
 #define KL_NUM_E      0x0002b7e1
 #define KL_NUM_LB_E   0x00017154 /* base-2 logarithm of 'e' */
 #define KL_NUM_LB_TEN 0x00035269
 
+#elif KL_NUM_FORMAT == KL_NUM_Q8_24
+typedef int32_t  kl_number_t;
+typedef uint32_t kl_num_bits_t;
+typedef int64_t  kl_num_wide_t;
+#define KL_NUM_NAME   "Q8.24"
+#define KL_NUM_FBITS  24
+#define KL_NUM_FMASK  0x00FFFFFF
+#define KL_NUM_FDIV   0x01000000
+#define KL_NUM_MSB    0x80000000
+#define KL_NUM_MAX    INT32_MAX
+#define KL_NUM_MIN    INT32_MIN
+#define KL_NUM_ONE    0x01000000
+#define KL_NUM_ZERO   0x00000000
+#define KL_NUM_HALF   0x00800000
+#define KL_NUM_TENTH  0x0019999A
+#define KL_NUM_PI     0x03243F6B
+#define KL_NUM_E      0x02b7e151
+#define KL_NUM_LB_E   0x01715476
+#define KL_NUM_LB_TEN 0x035269e1
+
+#elif KL_NUM_FORMAT == KL_NUM_Q32_32
+#if !defined(__SIZEOF_INT128__)
+#error "Q32.32 needs a 128-bit integer type for its products"
+#endif
+typedef int64_t  kl_number_t;
+typedef uint64_t kl_num_bits_t;
+typedef __int128 kl_num_wide_t;
+#define KL_NUM_NAME   "Q32.32"
+#define KL_NUM_FBITS  32
+#define KL_NUM_FMASK  INT64_C(0x00000000FFFFFFFF)
+#define KL_NUM_FDIV   INT64_C(0x0000000100000000)
+#define KL_NUM_MSB    UINT64_C(0x8000000000000000)
+#define KL_NUM_MAX    INT64_MAX
+#define KL_NUM_MIN    INT64_MIN
+#define KL_NUM_ONE    INT64_C(0x0000000100000000)
+#define KL_NUM_ZERO   INT64_C(0x0000000000000000)
+#define KL_NUM_HALF   INT64_C(0x0000000080000000)
+#define KL_NUM_TENTH  INT64_C(0x000000001999999A)
+#define KL_NUM_PI     INT64_C(0x00000003243F6A89)
+#define KL_NUM_E      INT64_C(0x00000002b7e15163)
+#define KL_NUM_LB_E   INT64_C(0x0000000171547653)
+#define KL_NUM_LB_TEN INT64_C(0x000000035269e12f)
+
+#elif KL_NUM_FORMAT == KL_NUM_DOUBLE
+#include <math.h>
+typedef double   kl_number_t;
+typedef uint64_t kl_num_bits_t;
+typedef double   kl_num_wide_t;
+#define KL_NUM_NAME   "double"
+#define KL_NUM_FDIV   1.0
+#define KL_NUM_MAX    HUGE_VAL
+#define KL_NUM_MIN    (-HUGE_VAL)
+#define KL_NUM_ONE    1.0
+#define KL_NUM_ZERO   0.0
+#define KL_NUM_HALF   0.5
+#define KL_NUM_TENTH  0.1
+#define KL_NUM_PI     3.14159265358979323846
+#define KL_NUM_E      2.71828182845904523536
+#define KL_NUM_LB_E   1.44269504088896340736 /* base-2 logarithm of 'e' */
+#define KL_NUM_LB_TEN 3.32192809488736234787
+
+#else
+#error "unknown KL_NUM_FORMAT"
+#endif
+
+#define KL_NUM_FIXED  (KL_NUM_FORMAT != KL_NUM_DOUBLE)
+#define KL_NUM_INT32  (KL_NUM_FORMAT == KL_NUM_Q16_16 || KL_NUM_FORMAT == KL_NUM_Q8_24) /* 32-bit lanes */
+#define KL_NUM_HALFPI (KL_NUM_PI / 2)
+
 kl_number_t kl_strtoinum(char *str, int n); /* integer part */
 kl_number_t kl_strtofnum(char *str, int n); /* fractional part, no sign allowed */
-kl_number_t kl_strtonum(char *str, int n); /* complete fixed-point number */
+kl_number_t kl_strtonum(char *str, int n); /* complete number, saturated */
+/* [+-]digits[.digits], exactly rounded -- toward zero in fixed point, as the two above -- and -1 if malformed,
+ * -2 if out of range.  digits are read eight at a time, up to KL_NUM_PARSE_PAD bytes past str + n, which
+ * must be there to read but need not hold anything */
+#define KL_NUM_PARSE_PAD 8
+int kl_num_parse(const char *str, int n, kl_number_t *num);
+
+/* eight ASCII digits, packed in a word with the first in the lowest byte, to their value -- pairs, then
+ * quads, then all eight are combined within their lanes */
+#define KL_NUM_ZEROS8 UINT64_C(0x3030303030303030) /* "00000000" */
+static inline uint64_t kl_num_digit8(uint64_t v) {
+  v -= KL_NUM_ZEROS8;
+  v  = (v * 10 + (v >> 8)) & UINT64_C(0x00FF00FF00FF00FF);
+  v  = (v * 100 + (v >> 16)) & UINT64_C(0x0000FFFF0000FFFF);
+  return (v * 10000 + (v >> 32)) & 0xFFFFFFFF;
+}
+extern const uint64_t kl_num_tens[20]; /* powers of ten that fit 64 bits */
+
+#if KL_NUM_FIXED
+#define KL_NUM_GROUPS (KL_NUM_FBITS / 8) /* groups of eight decimals that make a difference */
+/* the number ipart.f, where f is given as its first decimals in groups of eight, the last padded with
+ * zeros -- -2 if out of range */
+int kl_num_fromdecimal(int neg, uint64_t ipart, const uint64_t *group, int ng, kl_number_t *num);
+#endif
+
+/* the shortest decimal that kl_num_parse reads back as a, terminated -- returns its length.  a double may
+ * need an exponent, and reads back through strtod */
+#define KL_NUM_STRLEN 0x20 /* longest output, terminator included */
+int kl_num_format(kl_number_t a, char *buf);
+
+/* buffers many numbers, and whatever goes between them, into few writes */
+#define KL_NUMWRITER_BUFSIZE 0x1000
+typedef struct kl_numwriter {
+  FILE *out;
+  int   n;
+  char  buf[KL_NUMWRITER_BUFSIZE];
+} kl_numwriter_t;
+
+void kl_numwriter_init(kl_numwriter_t *w, FILE *out);
+void kl_numwriter_num(kl_numwriter_t *w, kl_number_t a);
+void kl_numwriter_str(kl_numwriter_t *w, const char *str, int n);
+void kl_numwriter_flush(kl_numwriter_t *w);
+
+#if KL_NUM_FIXED
 
 /* FIXME: these macros ASSUME that the compiler uses arithmetic shift for signed types
  * and logical shift for unsigned types */
 
 #define kl_num_mul(a, b) \
-  (((int64_t)(a) * (int64_t)(b)) >> KL_NUM_FBITS)
+  (((kl_num_wide_t)(a) * (kl_num_wide_t)(b)) >> KL_NUM_FBITS)
 #define kl_num_div(a, b) \
-  (((int64_t)(a) << KL_NUM_FBITS) / (b))
+  (((kl_num_wide_t)(a) << KL_NUM_FBITS) / (b))
+#define kl_num_fdiv(a, b) \
+  (kl_num_div(a, b) & ~KL_NUM_FMASK)
+#define kl_num_mod(a, b) \
+  ((a) % (b))
+
+/* bitwise operators work on the representation */
+#define kl_num_and(a, b) ((a) & (b))
+#define kl_num_or(a, b)  ((a) | (b))
+#define kl_num_xor(a, b) ((a) ^ (b))
+#define kl_num_not(a)    (~(a))
 
 #define kl_num_ashftl(a, b) \
   ((a) << ((b) >> KL_NUM_FBITS))
@@ -37,12 +177,134 @@ kl_number_t kl_strtonum(char *str, int n); /* complete fixed-point number */
 #define kl_num_lshftl(a, b) \
   ((a) << ((b) >> KL_NUM_FBITS))
 static inline kl_number_t kl_num_lshftr(kl_number_t a, kl_number_t b) {
-  uint32_t c = *((uint32_t*)&a);
-  int      d = b >> KL_NUM_FBITS;
-  c >>= d;
-  return *((kl_number_t*)&c);
+  return (kl_number_t)((kl_num_bits_t)a >> (b >> KL_NUM_FBITS));
+}
+
+#else
+#define kl_num_mul(a, b)  ((a) * (b))
+#define kl_num_div(a, b)  ((a) / (b))
+#define kl_num_fdiv(a, b) floor((a) / (b))
+#define kl_num_mod(a, b)  fmod((a), (b))
+
+/* a double has no representation of its own to work on, bitwise operators and shifts see it as Q32.32 */
+static inline int64_t kl_num_bits(double a) {
+  if (a >=  2147483648.0) return INT64_MAX;
+  if (a <= -2147483648.0) return INT64_MIN;
+  return (int64_t)floor(a * 4294967296.0);
+}
+static inline double kl_num_frombits(int64_t b) {
+  return (double)b / 4294967296.0;
+}
+
+#define kl_num_and(a, b) kl_num_frombits(kl_num_bits(a) & kl_num_bits(b))
+#define kl_num_or(a, b)  kl_num_frombits(kl_num_bits(a) | kl_num_bits(b))
+#define kl_num_xor(a, b) kl_num_frombits(kl_num_bits(a) ^ kl_num_bits(b))
+#define kl_num_not(a)    kl_num_frombits(~kl_num_bits(a))
+
+#define kl_num_ashftl(a, b) kl_num_frombits(kl_num_bits(a) << (int)(b))
+#define kl_num_ashftr(a, b) kl_num_frombits(kl_num_bits(a) >> (int)(b))
+#define kl_num_lshftl(a, b) kl_num_frombits(kl_num_bits(a) << (int)(b))
+#define kl_num_lshftr(a, b) kl_num_frombits((int64_t)((uint64_t)kl_num_bits(a) >> (int)(b)))
+#endif
+
+/* division by a constant as a multiply and shift, exact for dividends up to 2^(32 + KL_NUM_FBITS) in
+ * magnitude -- enough for both kl_num_div's shifted dividend and a plain 32-bit one.  needs a 128-bit
+ * product, and a 32-bit format */
+#if defined(__SIZEOF_INT128__) && KL_NUM_INT32
+#define KL_NUM_MAGIC 1
+#else
+#define KL_NUM_MAGIC 0
+#endif
+
+typedef struct kl_num_magic {
+  uint64_t    mul;
+  int32_t     shift;
+  kl_number_t div;
+} kl_num_magic_t;
+
+int kl_num_magic(kl_number_t div, kl_num_magic_t *m); /* -1 if div is -1, 0 or 1 */
+
+#if KL_NUM_MAGIC
+/* n / m->div, truncated toward zero like the hardware divide */
+static inline int64_t kl_num_magicdiv(int64_t n, const kl_num_magic_t *m) {
+  int64_t  s = (n >> 63) ^ ((int64_t)m->div >> 63);
+  uint64_t a = n < 0 ? -(uint64_t)n : (uint64_t)n;
+  uint64_t q = (uint64_t)(((unsigned __int128)a * m->mul) >> m->shift);
+  return ((int64_t)q ^ s) - s;
+}
+
+/* kl_num_div, kl_num_fdiv and kl_num_mod by m->div, bit for bit -- checked by bench/divbench.c */
+static inline kl_number_t kl_num_divc(kl_number_t a, const kl_num_magic_t *m) {
+  return (kl_number_t)kl_num_magicdiv((int64_t)a << KL_NUM_FBITS, m);
+}
+static inline kl_number_t kl_num_fdivc(kl_number_t a, const kl_num_magic_t *m) {
+  return kl_num_divc(a, m) & ~KL_NUM_FMASK;
+}
+static inline kl_number_t kl_num_modc(kl_number_t a, const kl_num_magic_t *m) {
+  return (kl_number_t)(a - kl_num_magicdiv(a, m) * m->div);
+}
+#endif
+
+/* x*y + z with z added before the product is shifted down.  z's fractional bits are zero, so this is
+ * bit-identical to kl_num_mul followed by an add */
+static inline kl_number_t kl_num_muladd(kl_number_t x, kl_number_t y, kl_number_t z) {
+#if KL_NUM_FIXED
+  return (kl_number_t)(((kl_num_wide_t)x * y + ((kl_num_wide_t)z << KL_NUM_FBITS)) >> KL_NUM_FBITS);
+#else
+  return x * y + z;
+#endif
+}
+
+#if KL_NUM_INT32
+/* branch-free helpers -- differences are taken in 64 bits so they can't overflow */
+static inline kl_number_t kl_num_min(kl_number_t a, kl_number_t b) {
+  int64_t d = (int64_t)a - b;
+  return (kl_number_t)(b + (d & (d >> 63)));
+}
+static inline kl_number_t kl_num_max(kl_number_t a, kl_number_t b) {
+  int64_t d = (int64_t)a - b;
+  return (kl_number_t)(a - (d & (d >> 63)));
+}
+#else
+/* a difference of 64-bit numbers can overflow, these compile to conditional moves instead */
+static inline kl_number_t kl_num_min(kl_number_t a, kl_number_t b) {
+  return a < b ? a : b;
+}
+static inline kl_number_t kl_num_max(kl_number_t a, kl_number_t b) {
+  return a > b ? a : b;
+}
+#endif
+#if KL_NUM_FIXED
+/* negated in the bits, where KL_NUM_MIN comes back as itself.  it is the only result with the top bit
+ * still set, and saturates to KL_NUM_MAX */
+static inline kl_number_t kl_num_abs(kl_number_t a) {
+  kl_num_bits_t m = (kl_num_bits_t)(a >> (8 * sizeof(kl_number_t) - 1));
+  kl_num_bits_t r = ((kl_num_bits_t)a ^ m) - m;
+  return (kl_number_t)(r - (r >> (8 * sizeof(kl_number_t) - 1)));
+}
+#else
+static inline kl_number_t kl_num_abs(kl_number_t a) {
+  return a < 0 ? -a : a;
+}
+#endif
+static inline kl_number_t kl_num_sign(kl_number_t a) {
+  return (kl_number_t)(((a > 0) - (a < 0)) * KL_NUM_ONE);
+}
+static inline kl_number_t kl_num_clamp(kl_number_t x, kl_number_t lo, kl_number_t hi) {
+  return kl_num_min(kl_num_max(x, lo), hi);
+}
+/* in kl_num_wide_t, which holds b - a and its product with t exactly.  a result out of range wraps, as a
+ * sum does */
+static inline kl_number_t kl_num_lerp(kl_number_t a, kl_number_t b, kl_number_t t) {
+#if KL_NUM_FIXED
+  kl_num_wide_t d = (kl_num_wide_t)b - a;
+  return (kl_number_t)(kl_num_bits_t)(a + ((d * t) >> KL_NUM_FBITS));
+#else
+  return a + (b - a) * t;
+#endif
 }
 
+#if KL_NUM_FIXED
 #define kl_inttonum(a) \
   ((kl_number_t)(a) << KL_NUM_FBITS)
 #define kl_floorint(a) \
@@ -55,12 +317,57 @@ static inline kl_number_t kl_num_lshftr(kl_number_t a, kl_number_t b) {
 #define kl_numtodouble(a) \
   ((double)(a) / (double)(KL_NUM_FDIV))
 
-kl_number_t kl_num_sin(kl_number_t theta);
-static inline kl_number_t kl_num_cos(kl_number_t theta) {
-  return kl_num_sin(KL_NUM_HALFPI - theta);
+/* a product, or sum of them, back to a number */
+#define kl_num_narrow(w) \
+  ((kl_number_t)((w) >> KL_NUM_FBITS))
+/* the same, saturated.  a sum of products can be out of range even when kl_num_wide_t holds it */
+static inline kl_number_t kl_num_narrowsat(kl_num_wide_t w) {
+  w >>= KL_NUM_FBITS;
+  return w > KL_NUM_MAX ? KL_NUM_MAX : w < KL_NUM_MIN ? KL_NUM_MIN : (kl_number_t)w;
 }
+#else
+#define kl_inttonum(a)    ((kl_number_t)(a))
+#define kl_floorint(a)    ((int)floor(a))
+#define kl_roundint(a)    ((int)lround(a))
+#define kl_numtofloat(a)  ((float)(a))
+#define kl_numtodouble(a) ((double)(a))
+#define kl_num_narrow(w)  (w)
+#define kl_num_narrowsat(w) (w)
+#endif
+
+/* nearest number to a, saturated -- not a number gives zero */
+kl_number_t kl_doubletonum(double a);
+
+/* defines kl_num_<name>_lookup(f), the value at f (Q0.32 over [0, 1], 1 itself included) of a table made
+ * by tools/tablegen.c with 2^bits intervals and Q.fbits entries, rounded to the number format.  fbits
+ * must be at least KL_NUM_FBITS */
+#define KL_NUM_TABLE(name, values, bits, fbits, lerp) \
+static inline kl_number_t kl_num_##name##_lookup(uint64_t f) { \
+  int64_t v; \
+  if (lerp) { \
+    /* at f = 1, interpolate all the way from the entry before */ \
+    uint64_t i = f >> (32 - (bits)); \
+    uint64_t u = f & ((UINT64_C(1) << (32 - (bits))) - 1); \
+    uint64_t e = i >> (bits); \
+    i -= e; \
+    u += e << (32 - (bits)); \
+    v  = values[i] + ((((int64_t)values[i + 1] - values[i]) * (int64_t)u) >> (32 - (bits))); \
+  } else { \
+    v  = values[(f + (UINT64_C(1) << (31 - (bits)))) >> (32 - (bits))]; \
+  } \
+  return (kl_number_t)((v + ((INT64_C(1) << ((fbits) - KL_NUM_FBITS)) >> 1)) >> ((fbits) - KL_NUM_FBITS)); \
+}
+
+kl_number_t kl_num_sin(kl_number_t theta);
+kl_number_t kl_num_cos(kl_number_t theta);
+void        kl_num_sincos(kl_number_t theta, kl_number_t *s, kl_number_t *c); /* one reduction for both */
 kl_number_t kl_num_taylor_sin(kl_number_t x);
 
+/* floor of the square root -- a Q32.32 argument gives a Q16.16 result */
+uint32_t kl_num_isqrt64(uint64_t x);
+/* the root of a sum of products, such as a dot product, as a number -- saturated */
+kl_number_t kl_num_widesqrt(kl_num_wide_t x);
+
 kl_number_t kl_num_lb(kl_number_t x);
 static inline kl_number_t kl_num_ln(kl_number_t x) {
   return kl_num_div(kl_num_lb(x), KL_NUM_LB_E);
@@ -69,4 +376,16 @@ static inline kl_number_t kl_num_lg(kl_number_t x) {
   return kl_num_div(kl_num_lb(x), KL_NUM_LB_TEN);
 }
 
+/* math engine.  error bounds are in units of the last place (2^-16) against the exact result for the
+ * exact argument, as measured by bench/mathbench.c in Q16.16.  Q8.24 has finer tables and is within a
+ * tenth of an ulp of them, bar tan near pi/2.  the 64-bit formats go through the C library in double
+ * precision instead.  results that don't fit saturate, undefined ones (sqrt of a negative, a fractional
+ * power of a negative) are zero */
+kl_number_t kl_num_sqrt(kl_number_t x);                 /* correctly rounded */
+kl_number_t kl_num_exp2(kl_number_t x);                 /* 0.5 ulp + 2^-32 relative, table and quadratic */
+kl_number_t kl_num_exp(kl_number_t x);                  /* 0.5 ulp + 2^-31 relative */
+kl_number_t kl_num_pow(kl_number_t x, kl_number_t y);   /* 0.5 ulp + |y| 2^-31 relative, exp2(y lb x) */
+kl_number_t kl_num_atan2(kl_number_t y, kl_number_t x); /* 0.5 ulp, CORDIC vectoring */
+kl_number_t kl_num_tan(kl_number_t theta);              /* 0.5 ulp up to |theta| = pi/4, CORDIC rotation */
+
 #endif
@@ -2,12 +2,16 @@
 #define KL_OBJECT_H
 
 #include "number.h"
+#include "compiler.h"
 
-#define KL_OBJ_NUM 0x00;
+#define KL_OBJ_NUM   0x00
+#define KL_OBJ_INST  0x01
+#define KL_OBJ_ARRAY 0x02
 
 typedef struct kl_object {
-  int type;
-  int gc;
+  int      type;
+  int      gc;
+  uint32_t handle; /* heap handle naming this object, see heap.h */
 } kl_object_t;
 
 typedef struct kl_obj_num_t {
@@ -15,4 +19,21 @@ typedef struct kl_obj_num_t {
   kl_number_t val;
 } kl_obj_num_t;
 
+/* fields are laid out as described by the shape, see shape.h */
+typedef struct kl_obj_inst {
+  kl_object_t obj;
+  uint32_t    shape;
+  int32_t     n;   /* fields in use, always kl_shape_nfields(shape) */
+  int32_t     cap;
+  kl_valref_t field[];
+} kl_obj_inst_t;
+
+/* elements are stored inline -- heap cells are 16-byte aligned and the header fills exactly 16 bytes,
+ * so data is always aligned for the SIMD kernels in numarray.c */
+typedef struct kl_obj_array {
+  kl_object_t obj;
+  uint32_t    n;
+  kl_number_t data[];
+} kl_obj_array_t;
+
 #endif /* KL_OBJECT_H */
@@ -0,0 +1,140 @@
+#include "sampler.h"
+
+#include "langdefs.h"
+
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+typedef struct kl_sample {
+  const char* name; /* script, NULL for the host */
+  int         line;
+  int         op;
+  uint64_t    count; /* 0 marks an empty slot */
+} kl_sample_t;
+
+static kl_vm_t* vms[KL_SAMPLER_MAXVMS];
+static int      nvms = 0;
+
+/* written only by the handler while the timer runs */
+static kl_sample_t samples[KL_SAMPLER_SLOTS];
+static uint64_t    dropped = 0; /* ticks that found the table full */
+
+int kl_sampler_attach(kl_vm_t* vm) {
+  if (nvms >= KL_SAMPLER_MAXVMS) return -1;
+  vms[nvms++] = vm;
+  return 0;
+}
+
+void kl_sampler_detach(kl_vm_t* vm) {
+  for (int i=0; i < nvms; i++) {
+    if (vms[i] == vm) {
+      vms[i] = vms[--nvms];
+      return;
+    }
+  }
+}
+
+void kl_sampler_reset(void) {
+  memset(samples, 0, sizeof(samples));
+  dropped = 0;
+}
+
+#if KL_VM_SAMPLE
+static void kl_sampler_count(const char* name, int line, int op) {
+  uint64_t h = ((uint64_t)(uintptr_t)name ^ (uint64_t)line << 32 ^ (uint32_t)op) * 0x9E3779B97F4A7C15u;
+  for (int i=0; i < KL_SAMPLER_SLOTS; i++) {
+    kl_sample_t *s = &samples[((h >> 40) + i) & (KL_SAMPLER_SLOTS - 1)];
+    if (s->count == 0) {
+      *s = (kl_sample_t){ .name = name, .line = line, .op = op, .count = 1 };
+      return;
+    }
+    if (s->name == name && s->line == line && s->op == op) {
+      s->count++;
+      return;
+    }
+  }
+  dropped++;
+}
+
+static void kl_sampler_tick(int sig) {
+  (void)sig;
+  int running = 0;
+  for (int i=0; i < nvms; i++) {
+    kl_code_t      *code = vms[i]->code;
+    const kl_ins_t *ins  = vms[i]->ins;
+    if (code == NULL) continue;
+
+    /* the two are not read atomically, an instruction of some other code reads as out of range */
+    int ip = (int)(ins - code->ins);
+    if (ip < 0 || ip >= code->n) continue;
+    kl_sampler_count(code->name, kl_code_line(code, ip), code->ins[ip].op);
+    running++;
+  }
+  if (running == 0) kl_sampler_count(NULL, 0, KL_NONE);
+}
+
+static struct sigaction previous;
+
+int kl_sampler_start(int hz) {
+  if (hz <= 0) hz = KL_SAMPLER_HZ;
+
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = kl_sampler_tick;
+  sa.sa_flags   = SA_RESTART;
+  sigemptyset(&sa.sa_mask);
+  if (sigaction(SIGPROF, &sa, &previous) < 0) return -1;
+
+  long             us    = 1000000 / hz > 0 ? 1000000 / hz : 1;
+  struct itimerval timer = { .it_interval = { .tv_sec = us / 1000000, .tv_usec = us % 1000000 } };
+  timer.it_value = timer.it_interval;
+  if (setitimer(ITIMER_PROF, &timer, NULL) < 0) {
+    sigaction(SIGPROF, &previous, NULL);
+    return -1;
+  }
+  return 0;
+}
+
+void kl_sampler_stop(void) {
+  struct itimerval timer;
+  memset(&timer, 0, sizeof(timer));
+  setitimer(ITIMER_PROF, &timer, NULL);
+  sigaction(SIGPROF, &previous, NULL);
+}
+#else
+int kl_sampler_start(int hz) {
+  (void)hz;
+  return -1;
+}
+
+void kl_sampler_stop(void) {
+}
+#endif
+
+static int kl_sampler_cmp(const void* a, const void* b) {
+  uint64_t x = (*(const kl_sample_t* const*)a)->count;
+  uint64_t y = (*(const kl_sample_t* const*)b)->count;
+  return x < y ? 1 : x > y ? -1 : 0;
+}
+
+void kl_sampler_dump(FILE* out) {
+  static const kl_sample_t *sorted[KL_SAMPLER_SLOTS];
+  int n = 0;
+  for (int i=0; i < KL_SAMPLER_SLOTS; i++) {
+    if (samples[i].count > 0) sorted[n++] = &samples[i];
+  }
+  qsort(sorted, n, sizeof(sorted[0]), kl_sampler_cmp);
+
+  for (int i=0; i < n; i++) {
+    const kl_sample_t *s = sorted[i];
+    if (s->name == NULL && s->op == KL_NONE) {
+      fprintf(out, "(host) %llu\n", (unsigned long long)s->count);
+      continue;
+    }
+    const char *name = s->name != NULL ? s->name : "(unnamed)";
+    fprintf(out, "%s;%s:%d;%s %llu\n", name, name, s->line, kl_langdef_name(s->op), (unsigned long long)s->count);
+  }
+  if (dropped > 0) fprintf(out, "(dropped) %llu\n", (unsigned long long)dropped);
+}
@@ -0,0 +1,34 @@
+#ifndef KL_SAMPLER_H
+#define KL_SAMPLER_H
+
+#include "vm.h"
+
+#include <stdio.h>
+
+/* statistical profiler -- SIGPROF fires hz times a second of cpu time, and each time every attached vm that
+ * is inside kl_vm_exec is charged one sample at its script, line and opcode.  a tick that finds none is
+ * charged to the host, the compiler included.  the handler looks lines up in kl_code_t's table, the vm
+ * itself only keeps its current instruction where the handler can see it.
+ *
+ * needs a build with -DKL_VM_SAMPLE=1, kl_sampler_start fails otherwise.  script names are kept by
+ * pointer and must outlive the profile */
+
+#define KL_SAMPLER_HZ      997    /* default rate, prime so it doesn't beat with periodic work */
+#define KL_SAMPLER_MAXVMS  0x0010
+#define KL_SAMPLER_SLOTS   0x1000 /* distinct script, line and opcode triples, a power of two */
+
+int  kl_sampler_attach(kl_vm_t* vm); /* -1 if KL_SAMPLER_MAXVMS are attached already */
+void kl_sampler_detach(kl_vm_t* vm);
+
+int  kl_sampler_start(int hz);       /* -1 if built without KL_VM_SAMPLE or the timer can't be set */
+void kl_sampler_stop(void);
+void kl_sampler_reset(void);
+
+/* one line per hot spot, most samples first, as collapsed stacks for flamegraph tools:
+ *
+ *   script;script:line;OPCODE samples
+ *
+ * so that a flame graph nests lines under scripts and opcodes under lines.  call once stopped */
+void kl_sampler_dump(FILE* out);
+
+#endif /* KL_SAMPLER_H */
@@ -0,0 +1,54 @@
+#include "shape.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+static kl_shape_t *shapes   = NULL;
+static uint32_t    nshapes  = 0;
+static uint32_t    capshape = 0;
+
+static void init(void) {
+  capshape = 0x100;
+  shapes   = malloc(capshape * sizeof(kl_shape_t));
+  nshapes  = 1;
+  shapes[KL_SHAPE_EMPTY] = (kl_shape_t){ .parent = KL_SHAPE_NONE, .sym = 0, .nfields = 0 };
+}
+
+uint32_t kl_shape_add(uint32_t shape, uint32_t sym) {
+  if (shapes == NULL) init();
+  assert(shape < nshapes);
+
+  kl_shape_t *s = &shapes[shape];
+  for (int i=0; i < s->ntrans; i++) {
+    if (s->trans[i].sym == sym) return s->trans[i].shape;
+  }
+
+  if (nshapes == capshape) {
+    capshape *= 2;
+    shapes    = realloc(shapes, capshape * sizeof(kl_shape_t));
+    s         = &shapes[shape];
+  }
+  uint32_t child = nshapes++;
+  shapes[child] = (kl_shape_t){ .parent = shape, .sym = sym, .nfields = s->nfields + 1 };
+
+  if (s->ntrans == s->captrans) {
+    s->captrans = s->captrans ? s->captrans * 2 : 2;
+    s->trans    = realloc(s->trans, s->captrans * sizeof(kl_shape_trans_t));
+  }
+  s->trans[s->ntrans++] = (kl_shape_trans_t){ .sym = sym, .shape = child };
+
+  return child;
+}
+
+int kl_shape_lookup(uint32_t shape, uint32_t sym) {
+  while (shape != KL_SHAPE_EMPTY) {
+    kl_shape_t *s = &shapes[shape];
+    if (s->sym == sym) return s->nfields - 1;
+    shape = s->parent;
+  }
+  return -1;
+}
+
+int kl_shape_nfields(uint32_t shape) {
+  return shape == KL_SHAPE_EMPTY ? 0 : shapes[shape].nfields;
+}
@@ -0,0 +1,32 @@
+#ifndef KL_SHAPE_H
+#define KL_SHAPE_H
+
+#include <stdint.h>
+
+/* hidden classes -- instances that gained the same fields in the same order share a shape, which maps
+ * field names to offsets.  shapes form a tree rooted at the empty shape: adding a field follows (or
+ * creates) the transition for that name.  shapes are global and never freed, so an id compare is enough
+ * to validate a cached field offset */
+
+#define KL_SHAPE_EMPTY 0x00000000
+#define KL_SHAPE_NONE  0xFFFFFFFF
+
+typedef struct kl_shape_trans {
+  uint32_t sym;
+  uint32_t shape;
+} kl_shape_trans_t;
+
+typedef struct kl_shape {
+  uint32_t          parent;
+  uint32_t          sym;     /* field added by the transition from parent */
+  int               nfields;
+  int               ntrans;
+  int               captrans;
+  kl_shape_trans_t *trans;
+} kl_shape_t;
+
+uint32_t kl_shape_add(uint32_t shape, uint32_t sym);    /* shape with one more field */
+int      kl_shape_lookup(uint32_t shape, uint32_t sym); /* field offset, -1 if absent */
+int      kl_shape_nfields(uint32_t shape);
+
+#endif /* KL_SHAPE_H */
@@ -0,0 +1,155 @@
+#include "symbol.h"
+
+#include "langdefs.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KL_SYMBOL_ARENASIZE 0x00010000 /* bytes per arena chunk */
+#define KL_SYMBOL_MINTABLE  0x00000100 /* initial hash set capacity */
+
+typedef struct kl_symbol_entry {
+  const char *str;
+  uint32_t    hash;
+  int         n;
+  int         keyword;
+} kl_symbol_entry_t;
+
+/* names are copied into chunked arenas which are never moved or freed, so entry strings stay valid */
+typedef struct kl_symbol_arena {
+  struct kl_symbol_arena *next;
+  int  used;
+  char data[KL_SYMBOL_ARENASIZE];
+} kl_symbol_arena_t;
+
+static kl_symbol_arena_t *arena = NULL;
+
+static kl_symbol_entry_t *entries  = NULL;
+static uint32_t           nentries = 0;
+static uint32_t           capacity = 0; /* of entries */
+
+/* open addressing with linear probing, holds indices into entries */
+static uint32_t *table = NULL;
+static uint32_t  mask  = 0;
+
+#if KL_COMPILER_STATS
+static uint64_t allocs     = 0;
+static uint64_t allocbytes = 0;
+#endif
+
+static uint32_t hash(const char *str, int n) {
+  uint32_t h = 0x811C9DC5; /* FNV-1a */
+  for (int i=0; i < n; i++) {
+    h ^= (unsigned char)str[i];
+    h *= 0x01000193;
+  }
+  return h;
+}
+
+static const char* store(const char *str, int n) {
+  assert(n < KL_SYMBOL_ARENASIZE);
+  if (arena == NULL || arena->used + n + 1 > KL_SYMBOL_ARENASIZE) {
+    kl_symbol_arena_t *a = malloc(sizeof(kl_symbol_arena_t));
+#if KL_COMPILER_STATS
+    allocs++;
+    allocbytes += sizeof(kl_symbol_arena_t);
+#endif
+    a->next = arena;
+    a->used = 0;
+    arena   = a;
+  }
+  char *s = arena->data + arena->used;
+  memcpy(s, str, n);
+  s[n] = '\0';
+  arena->used += n + 1;
+  return s;
+}
+
+static void rehash(uint32_t size) {
+  free(table);
+  table = malloc(size * sizeof(uint32_t));
+#if KL_COMPILER_STATS
+  allocs++;
+  allocbytes += size * sizeof(uint32_t);
+#endif
+  mask  = size - 1;
+  memset(table, 0xFF, size * sizeof(uint32_t));
+
+  for (uint32_t id=0; id < nentries; id++) {
+    uint32_t i = entries[id].hash & mask;
+    while (table[i] != KL_SYMBOL_NONE) i = (i + 1) & mask;
+    table[i] = id;
+  }
+}
+
+static uint32_t* lookup(const char *str, int n, uint32_t h) {
+  uint32_t i = h & mask;
+  for (;;) {
+    uint32_t id = table[i];
+    if (id == KL_SYMBOL_NONE) return &table[i];
+
+    kl_symbol_entry_t *e = &entries[id];
+    if (e->hash == h && e->n == n && memcmp(e->str, str, n) == 0) return &table[i];
+
+    i = (i + 1) & mask;
+  }
+}
+
+uint32_t kl_symbol_intern(const char *str, int n) {
+  if (table == NULL) rehash(KL_SYMBOL_MINTABLE);
+
+  uint32_t  h    = hash(str, n);
+  uint32_t *slot = lookup(str, n, h);
+  if (*slot != KL_SYMBOL_NONE) return *slot;
+
+  if (nentries == capacity) {
+    capacity = capacity ? capacity * 2 : KL_SYMBOL_MINTABLE;
+    entries  = realloc(entries, capacity * sizeof(kl_symbol_entry_t));
+#if KL_COMPILER_STATS
+    allocs++;
+    allocbytes += capacity * sizeof(kl_symbol_entry_t);
+#endif
+  }
+
+  uint32_t id = nentries++;
+  entries[id] = (kl_symbol_entry_t){ .str = store(str, n), .hash = h, .n = n, .keyword = KL_NONE };
+  *slot = id;
+
+  /* keep the load factor at or below one half */
+  if (nentries * 2 > mask + 1) rehash((mask + 1) * 2);
+
+  return id;
+}
+
+uint32_t kl_symbol_find(const char *str, int n) {
+  if (table == NULL) return KL_SYMBOL_NONE;
+  return *lookup(str, n, hash(str, n));
+}
+
+uint32_t kl_symbol_count(void) {
+  return nentries;
+}
+
+#if KL_COMPILER_STATS
+void kl_symbol_allocated(uint64_t *n, uint64_t *bytes) {
+  *n     = allocs;
+  *bytes = allocbytes;
+}
+#endif
+
+const char* kl_symbol_name(uint32_t sym, int *n) {
+  assert(sym < nentries);
+  if (n != NULL) *n = entries[sym].n;
+  return entries[sym].str;
+}
+
+void kl_symbol_setkeyword(uint32_t sym, int type) {
+  assert(sym < nentries);
+  entries[sym].keyword = type;
+}
+
+int kl_symbol_keyword(uint32_t sym) {
+  assert(sym < nentries);
+  return entries[sym].keyword;
+}
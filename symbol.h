@@ -0,0 +1,28 @@
+#ifndef KL_SYMBOL_H
+#define KL_SYMBOL_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+/* global string interner -- equal names always map to the same symbol id, so name resolution downstream
+ * of the lexer is integer comparison.  ids are dense, starting at zero, and stable for the lifetime of
+ * the process */
+
+#define KL_SYMBOL_NONE 0xFFFFFFFF
+
+uint32_t kl_symbol_intern(const char *str, int n);
+uint32_t kl_symbol_find(const char *str, int n); /* KL_SYMBOL_NONE if the name was never interned */
+uint32_t kl_symbol_count(void);
+#if KL_COMPILER_STATS
+void     kl_symbol_allocated(uint64_t *n, uint64_t *bytes); /* allocations made so far, and their sizes */
+#endif
+
+/* returns a NUL-terminated copy of the name owned by the interner */
+const char* kl_symbol_name(uint32_t sym, int *n);
+
+/* token type attached to a reserved word, KL_NONE for ordinary names */
+void kl_symbol_setkeyword(uint32_t sym, int type);
+int  kl_symbol_keyword(uint32_t sym);
+
+#endif /* KL_SYMBOL_H */
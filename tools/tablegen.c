@@ -0,0 +1,82 @@
+/* generates the lookup tables number.c is built with.  from the repository root:
+ *
+ *   cc -O2 -o tablegen tools/tablegen.c -lm
+ *   ./tablegen sine 8 32 lerp > trigtable.h
+ *   ./tablegen lb 8 32 lerp > logtable.h
+ *   ./tablegen exp2 > exptable.h
+ *
+ * and for the Q8.24 number format, whose last place is 256 times finer:
+ *
+ *   ./tablegen sine 12 32 lerp > trigtable24.h
+ *   ./tablegen lb 12 32 lerp > logtable24.h
+ *
+ * a table of 2^bits intervals has 2^bits + 1 entries.  32-bit entries are Q2.30, 16-bit entries Q0.16 with
+ * the single 1.0 at the end saturated.  lerp interpolates between neighbouring entries, nearest takes the
+ * closest one.  the exp2 table is fixed, its kernel's polynomial is sized for ten bits.  bench/tablebench.c
+ * measures the trade-off between the settings */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+static double sine(double x) { return sin(x * M_PI / 2); } /* 0 <= x <= 1 over a quarter turn */
+static double lb(double x)   { return log2(1 + x); }
+
+static void usage(void) {
+  fprintf(stderr, "usage: tablegen sine|lb <bits> <16|32> <lerp|nearest>\n"
+                  "       tablegen exp2\n");
+  exit(1);
+}
+
+static void generate(const char *macro, const char *name, const char *what, double (*f)(double), int bits,
+                     int width, int lerp, char **argv, int argc) {
+  int n = 1 << bits;
+
+  printf("/* generated by tools/tablegen.c --");
+  for (int i=1; i < argc; i++) printf(" %s", argv[i]);
+  printf(" */\n");
+  printf("/* %s */\n", what);
+  printf("#define KL_%s_BITS  %d /* 2^bits intervals */\n", macro, bits);
+  printf("#define KL_%s_FBITS %d /* fractional bits of an entry */\n", macro, width == 32 ? 30 : 16);
+  printf("#define KL_%s_LERP  %d /* interpolate between entries, rather than take the nearest */\n", macro, lerp);
+  printf("static const %s %s_values[0x%04x] = {\n", width == 32 ? "int32_t" : "uint16_t", name, n + 1);
+  for (int i=0; i <= n; i++) {
+    double v = f((double)i / n);
+    if (width == 32) {
+      printf("  0x%08lx,\n", (unsigned long)llrint(ldexp(v, 30)));
+    } else {
+      long e = llrint(ldexp(v, 16));
+      printf("  0x%04lx,\n", (unsigned long)(e > 0xFFFF ? 0xFFFF : e));
+    }
+  }
+  printf("};\n");
+}
+
+int main(int argc, char **argv) {
+  if (argc == 2 && strcmp(argv[1], "exp2") == 0) {
+    printf("/* generated by tools/tablegen.c -- exp2 */\n");
+    printf("/* base-2 exponent values for 0 <= x < 1, Q1.31 */\n");
+    printf("static const uint32_t exp2_values[0x0400] = {\n");
+    for (int i=0; i < 0x400; i++) printf("  0x%08lx,\n", (unsigned long)llrint(ldexp(exp2(i / 1024.0), 31)));
+    printf("};\n");
+    return 0;
+  }
+  if (argc != 5) usage();
+
+  int bits  = atoi(argv[2]);
+  int width = atoi(argv[3]);
+  int lerp  = strcmp(argv[4], "lerp") == 0;
+  if (bits < 1 || bits > 16 || (width != 16 && width != 32) || (!lerp && strcmp(argv[4], "nearest") != 0)) {
+    usage();
+  }
+
+  if (strcmp(argv[1], "sine") == 0) {
+    generate("SINE", "sine", "sine values for 0 <= x <= pi/2", sine, bits, width, lerp, argv, argc);
+  } else if (strcmp(argv[1], "lb") == 0) {
+    generate("LB", "lb", "base-2 log values for 1 <= x <= 2", lb, bits, width, lerp, argv, argc);
+  } else {
+    usage();
+  }
+  return 0;
+}
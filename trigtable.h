@@ -1,1027 +1,264 @@
-static int32_t sine_values[0x0401] = {
-	0x00000000,
-	0x00000064,
-	0x000000c9,
-	0x0000012d,
-	0x00000192,
-	0x000001f6,
-	0x0000025b,
-	0x000002bf,
-	0x00000324,
-	0x00000388,
-	0x000003ed,
-	0x00000451,
-	0x000004b5,
-	0x00000519,
-	0x0000057e,
-	0x000005e2,
-	0x00000647,
-	0x000006ac,
-	0x00000710,
-	0x00000775,
-	0x000007d9,
-	0x0000083e,
-	0x000008a2,
-	0x00000907,
-	0x0000096b,
-	0x000009d0,
-	0x00000a34,
-	0x00000a99,
-	0x00000afd,
-	0x00000b62,
-	0x00000bc5,
-	0x00000c2a,
-	0x00000c8e,
-	0x00000cf3,
-	0x00000d58,
-	0x00000dbc,
-	0x00000e21,
-	0x00000e85,
-	0x00000ee9,
-	0x00000f4d,
-	0x00000fb2,
-	0x00001016,
-	0x0000107b,
-	0x000010de,
-	0x00001143,
-	0x000011a7,
-	0x0000120c,
-	0x0000126f,
-	0x000012d4,
-	0x00001338,
-	0x0000139d,
-	0x00001401,
-	0x00001465,
-	0x000014ca,
-	0x0000152d,
-	0x00001592,
-	0x000015f6,
-	0x0000165a,
-	0x000016be,
-	0x00001722,
-	0x00001786,
-	0x000017eb,
-	0x0000184e,
-	0x000018b3,
-	0x00001916,
-	0x0000197b,
-	0x000019de,
-	0x00001a43,
-	0x00001aa7,
-	0x00001b0b,
-	0x00001b6f,
-	0x00001bd2,
-	0x00001c37,
-	0x00001c9a,
-	0x00001cff,
-	0x00001d62,
-	0x00001dc6,
-	0x00001e2a,
-	0x00001e8e,
-	0x00001ef1,
-	0x00001f55,
-	0x00001fb9,
-	0x0000201d,
-	0x00002081,
-	0x000020e4,
-	0x00002148,
-	0x000021ab,
-	0x00002210,
-	0x00002273,
-	0x000022d7,
-	0x0000233a,
-	0x0000239e,
-	0x00002401,
-	0x00002465,
-	0x000024c8,
-	0x0000252c,
-	0x0000258f,
-	0x000025f3,
-	0x00002655,
-	0x000026b9,
-	0x0000271d,
-	0x00002780,
-	0x000027e4,
-	0x00002846,
-	0x000028aa,
-	0x0000290d,
-	0x00002971,
-	0x000029d3,
-	0x00002a37,
-	0x00002a9a,
-	0x00002afd,
-	0x00002b60,
-	0x00002bc3,
-	0x00002c26,
-	0x00002c89,
-	0x00002cec,
-	0x00002d4f,
-	0x00002db2,
-	0x00002e15,
-	0x00002e78,
-	0x00002edb,
-	0x00002f3e,
-	0x00002fa0,
-	0x00003003,
-	0x00003066,
-	0x000030c9,
-	0x0000312b,
-	0x0000318e,
-	0x000031f0,
-	0x00003253,
-	0x000032b5,
-	0x00003318,
-	0x0000337a,
-	0x000033dd,
-	0x00003440,
-	0x000034a2,
-	0x00003505,
-	0x00003566,
-	0x000035c9,
-	0x0000362b,
-	0x0000368e,
-	0x000036ef,
-	0x00003752,
-	0x000037b4,
-	0x00003816,
-	0x00003878,
-	0x000038da,
-	0x0000393c,
-	0x0000399e,
-	0x00003a00,
-	0x00003a62,
-	0x00003ac4,
-	0x00003b25,
-	0x00003b88,
-	0x00003be9,
-	0x00003c4b,
-	0x00003cac,
-	0x00003d0e,
-	0x00003d70,
-	0x00003dd2,
-	0x00003e33,
-	0x00003e95,
-	0x00003ef5,
-	0x00003f57,
-	0x00003fb8,
-	0x0000401a,
-	0x0000407c,
-	0x000040dd,
-	0x0000413e,
-	0x0000419f,
-	0x00004200,
-	0x00004261,
-	0x000042c3,
-	0x00004323,
-	0x00004385,
-	0x000043e5,
-	0x00004446,
-	0x000044a7,
-	0x00004508,
-	0x00004568,
-	0x000045ca,
-	0x0000462a,
-	0x0000468b,
-	0x000046ec,
-	0x0000474c,
-	0x000047ad,
-	0x0000480d,
-	0x0000486e,
-	0x000048ce,
-	0x0000492e,
-	0x0000498e,
-	0x000049ef,
-	0x00004a4f,
-	0x00004aaf,
-	0x00004b0f,
-	0x00004b6f,
-	0x00004bcf,
-	0x00004c30,
-	0x00004c8f,
-	0x00004cef,
-	0x00004d50,
-	0x00004daf,
-	0x00004e0f,
-	0x00004e6e,
-	0x00004ece,
-	0x00004f2e,
-	0x00004f8e,
-	0x00004fed,
-	0x0000504d,
-	0x000050ab,
-	0x0000510b,
-	0x0000516a,
-	0x000051ca,
-	0x00005229,
-	0x00005288,
-	0x000052e8,
-	0x00005346,
-	0x000053a6,
-	0x00005404,
-	0x00005464,
-	0x000054c2,
-	0x00005521,
-	0x00005580,
-	0x000055df,
-	0x0000563d,
-	0x0000569c,
-	0x000056fa,
-	0x00005759,
-	0x000057b7,
-	0x00005816,
-	0x00005874,
-	0x000058d3,
-	0x00005931,
-	0x0000598f,
-	0x000059ee,
-	0x00005a4b,
-	0x00005aaa,
-	0x00005b07,
-	0x00005b66,
-	0x00005bc3,
-	0x00005c21,
-	0x00005c7f,
-	0x00005cdd,
-	0x00005d3a,
-	0x00005d98,
-	0x00005df5,
-	0x00005e53,
-	0x00005eb0,
-	0x00005f0e,
-	0x00005f6b,
-	0x00005fc8,
-	0x00006026,
-	0x00006082,
-	0x000060e0,
-	0x0000613c,
-	0x0000619a,
-	0x000061f6,
-	0x00006254,
-	0x000062b0,
-	0x0000630d,
-	0x00006369,
-	0x000063c6,
-	0x00006422,
-	0x0000647f,
-	0x000064db,
-	0x00006538,
-	0x00006595,
-	0x000065f0,
-	0x0000664d,
-	0x000066a9,
-	0x00006705,
-	0x00006761,
-	0x000067bd,
-	0x00006818,
-	0x00006875,
-	0x000068d0,
-	0x0000692c,
-	0x00006987,
-	0x000069e3,
-	0x00006a3e,
-	0x00006a9a,
-	0x00006af6,
-	0x00006b51,
-	0x00006bac,
-	0x00006c07,
-	0x00006c63,
-	0x00006cbd,
-	0x00006d19,
-	0x00006d73,
-	0x00006dce,
-	0x00006e29,
-	0x00006e84,
-	0x00006ede,
-	0x00006f39,
-	0x00006f93,
-	0x00006fee,
-	0x00007048,
-	0x000070a2,
-	0x000070fd,
-	0x00007157,
-	0x000071b1,
-	0x0000720b,
-	0x00007265,
-	0x000072bf,
-	0x00007319,
-	0x00007372,
-	0x000073cc,
-	0x00007425,
-	0x0000747f,
-	0x000074d8,
-	0x00007532,
-	0x0000758b,
-	0x000075e5,
-	0x0000763e,
-	0x00007697,
-	0x000076f1,
-	0x00007749,
-	0x000077a2,
-	0x000077fb,
-	0x00007854,
-	0x000078ac,
-	0x00007905,
-	0x0000795d,
-	0x000079b6,
-	0x00007a0e,
-	0x00007a67,
-	0x00007abf,
-	0x00007b17,
-	0x00007b6f,
-	0x00007bc7,
-	0x00007c1f,
-	0x00007c77,
-	0x00007ccf,
-	0x00007d27,
-	0x00007d7f,
-	0x00007dd6,
-	0x00007e2e,
-	0x00007e85,
-	0x00007edd,
-	0x00007f33,
-	0x00007f8b,
-	0x00007fe2,
-	0x00008039,
-	0x00008090,
-	0x000080e7,
-	0x0000813d,
-	0x00008194,
-	0x000081eb,
-	0x00008242,
-	0x00008299,
-	0x000082ee,
-	0x00008345,
-	0x0000839b,
-	0x000083f2,
-	0x00008447,
-	0x0000849e,
-	0x000084f3,
-	0x00008549,
-	0x0000859f,
-	0x000085f5,
-	0x0000864a,
-	0x000086a0,
-	0x000086f5,
-	0x0000874b,
-	0x000087a1,
-	0x000087f5,
-	0x0000884b,
-	0x000088a0,
-	0x000088f5,
-	0x00008949,
-	0x0000899f,
-	0x000089f3,
-	0x00008a48,
-	0x00008a9c,
-	0x00008af1,
-	0x00008b45,
-	0x00008b99,
-	0x00008bed,
-	0x00008c42,
-	0x00008c95,
-	0x00008cea,
-	0x00008d3e,
-	0x00008d91,
-	0x00008de5,
-	0x00008e39,
-	0x00008e8d,
-	0x00008ee0,
-	0x00008f33,
-	0x00008f86,
-	0x00008fda,
-	0x0000902d,
-	0x00009080,
-	0x000090d2,
-	0x00009126,
-	0x00009178,
-	0x000091cb,
-	0x0000921d,
-	0x00009270,
-	0x000092c3,
-	0x00009315,
-	0x00009367,
-	0x000093b9,
-	0x0000940c,
-	0x0000945d,
-	0x000094af,
-	0x00009501,
-	0x00009553,
-	0x000095a4,
-	0x000095f6,
-	0x00009647,
-	0x00009699,
-	0x000096e9,
-	0x0000973b,
-	0x0000978c,
-	0x000097dd,
-	0x0000982e,
-	0x0000987f,
-	0x000098d0,
-	0x00009920,
-	0x00009971,
-	0x000099c1,
-	0x00009a11,
-	0x00009a61,
-	0x00009ab2,
-	0x00009b01,
-	0x00009b52,
-	0x00009ba1,
-	0x00009bf1,
-	0x00009c41,
-	0x00009c91,
-	0x00009ce0,
-	0x00009d2f,
-	0x00009d7f,
-	0x00009dce,
-	0x00009e1d,
-	0x00009e6c,
-	0x00009ebb,
-	0x00009f0a,
-	0x00009f59,
-	0x00009fa7,
-	0x00009ff6,
-	0x0000a044,
-	0x0000a093,
-	0x0000a0e0,
-	0x0000a12f,
-	0x0000a17d,
-	0x0000a1cb,
-	0x0000a219,
-	0x0000a266,
-	0x0000a2b5,
-	0x0000a302,
-	0x0000a34f,
-	0x0000a39c,
-	0x0000a3ea,
-	0x0000a437,
-	0x0000a484,
-	0x0000a4d1,
-	0x0000a51e,
-	0x0000a56a,
-	0x0000a5b7,
-	0x0000a604,
-	0x0000a650,
-	0x0000a69c,
-	0x0000a6e9,
-	0x0000a736,
-	0x0000a781,
-	0x0000a7ce,
-	0x0000a819,
-	0x0000a865,
-	0x0000a8b0,
-	0x0000a8fc,
-	0x0000a947,
-	0x0000a993,
-	0x0000a9de,
-	0x0000aa2a,
-	0x0000aa74,
-	0x0000aabf,
-	0x0000ab0a,
-	0x0000ab55,
-	0x0000aba0,
-	0x0000abea,
-	0x0000ac35,
-	0x0000ac7f,
-	0x0000acc9,
-	0x0000ad13,
-	0x0000ad5e,
-	0x0000ada7,
-	0x0000adf1,
-	0x0000ae3b,
-	0x0000ae85,
-	0x0000aece,
-	0x0000af17,
-	0x0000af60,
-	0x0000afaa,
-	0x0000aff3,
-	0x0000b03c,
-	0x0000b085,
-	0x0000b0cd,
-	0x0000b116,
-	0x0000b15f,
-	0x0000b1a7,
-	0x0000b1ef,
-	0x0000b238,
-	0x0000b280,
-	0x0000b2c8,
-	0x0000b30f,
-	0x0000b358,
-	0x0000b39f,
-	0x0000b3e7,
-	0x0000b42e,
-	0x0000b476,
-	0x0000b4bc,
-	0x0000b504,
-	0x0000b54b,
-	0x0000b592,
-	0x0000b5d9,
-	0x0000b61f,
-	0x0000b666,
-	0x0000b6ac,
-	0x0000b6f3,
-	0x0000b739,
-	0x0000b77f,
-	0x0000b7c5,
-	0x0000b80b,
-	0x0000b851,
-	0x0000b897,
-	0x0000b8dc,
-	0x0000b922,
-	0x0000b967,
-	0x0000b9ac,
-	0x0000b9f2,
-	0x0000ba37,
-	0x0000ba7c,
-	0x0000bac0,
-	0x0000bb05,
-	0x0000bb4a,
-	0x0000bb8e,
-	0x0000bbd2,
-	0x0000bc17,
-	0x0000bc5b,
-	0x0000bc9f,
-	0x0000bce3,
-	0x0000bd27,
-	0x0000bd6a,
-	0x0000bdae,
-	0x0000bdf1,
-	0x0000be35,
-	0x0000be78,
-	0x0000bebb,
-	0x0000befe,
-	0x0000bf41,
-	0x0000bf84,
-	0x0000bfc6,
-	0x0000c009,
-	0x0000c04b,
-	0x0000c08e,
-	0x0000c0d0,
-	0x0000c112,
-	0x0000c154,
-	0x0000c196,
-	0x0000c1d7,
-	0x0000c219,
-	0x0000c25b,
-	0x0000c29c,
-	0x0000c2dd,
-	0x0000c31e,
-	0x0000c360,
-	0x0000c3a0,
-	0x0000c3e1,
-	0x0000c421,
-	0x0000c462,
-	0x0000c4a2,
-	0x0000c4e3,
-	0x0000c523,
-	0x0000c563,
-	0x0000c5a3,
-	0x0000c5e3,
-	0x0000c622,
-	0x0000c662,
-	0x0000c6a2,
-	0x0000c6e1,
-	0x0000c721,
-	0x0000c75f,
-	0x0000c79f,
-	0x0000c7dd,
-	0x0000c81c,
-	0x0000c85b,
-	0x0000c899,
-	0x0000c8d7,
-	0x0000c916,
-	0x0000c954,
-	0x0000c992,
-	0x0000c9d0,
-	0x0000ca0e,
-	0x0000ca4b,
-	0x0000ca89,
-	0x0000cac7,
-	0x0000cb04,
-	0x0000cb41,
-	0x0000cb7e,
-	0x0000cbbb,
-	0x0000cbf8,
-	0x0000cc35,
-	0x0000cc71,
-	0x0000ccae,
-	0x0000ccea,
-	0x0000cd26,
-	0x0000cd62,
-	0x0000cd9e,
-	0x0000cdda,
-	0x0000ce16,
-	0x0000ce51,
-	0x0000ce8d,
-	0x0000cec8,
-	0x0000cf03,
-	0x0000cf3e,
-	0x0000cf79,
-	0x0000cfb4,
-	0x0000cfee,
-	0x0000d029,
-	0x0000d063,
-	0x0000d09e,
-	0x0000d0d8,
-	0x0000d112,
-	0x0000d14c,
-	0x0000d186,
-	0x0000d1c0,
-	0x0000d1f9,
-	0x0000d233,
-	0x0000d26c,
-	0x0000d2a6,
-	0x0000d2de,
-	0x0000d318,
-	0x0000d350,
-	0x0000d389,
-	0x0000d3c1,
-	0x0000d3fa,
-	0x0000d432,
-	0x0000d46a,
-	0x0000d4a2,
-	0x0000d4da,
-	0x0000d512,
-	0x0000d54a,
-	0x0000d581,
-	0x0000d5b9,
-	0x0000d5f0,
-	0x0000d627,
-	0x0000d65e,
-	0x0000d695,
-	0x0000d6cc,
-	0x0000d702,
-	0x0000d739,
-	0x0000d76f,
-	0x0000d7a6,
-	0x0000d7db,
-	0x0000d812,
-	0x0000d847,
-	0x0000d87d,
-	0x0000d8b2,
-	0x0000d8e8,
-	0x0000d91d,
-	0x0000d953,
-	0x0000d988,
-	0x0000d9bd,
-	0x0000d9f2,
-	0x0000da26,
-	0x0000da5b,
-	0x0000da8f,
-	0x0000dac4,
-	0x0000daf7,
-	0x0000db2c,
-	0x0000db5f,
-	0x0000db93,
-	0x0000dbc7,
-	0x0000dbfa,
-	0x0000dc2d,
-	0x0000dc61,
-	0x0000dc94,
-	0x0000dcc7,
-	0x0000dcfa,
-	0x0000dd2c,
-	0x0000dd5f,
-	0x0000dd91,
-	0x0000ddc4,
-	0x0000ddf6,
-	0x0000de28,
-	0x0000de5a,
-	0x0000de8c,
-	0x0000debd,
-	0x0000deef,
-	0x0000df20,
-	0x0000df51,
-	0x0000df82,
-	0x0000dfb3,
-	0x0000dfe4,
-	0x0000e015,
-	0x0000e045,
-	0x0000e076,
-	0x0000e0a6,
-	0x0000e0d6,
-	0x0000e106,
-	0x0000e136,
-	0x0000e166,
-	0x0000e195,
-	0x0000e1c5,
-	0x0000e1f4,
-	0x0000e223,
-	0x0000e252,
-	0x0000e281,
-	0x0000e2b0,
-	0x0000e2df,
-	0x0000e30d,
-	0x0000e33b,
-	0x0000e36a,
-	0x0000e398,
-	0x0000e3c6,
-	0x0000e3f3,
-	0x0000e421,
-	0x0000e44f,
-	0x0000e47c,
-	0x0000e4a9,
-	0x0000e4d7,
-	0x0000e503,
-	0x0000e530,
-	0x0000e55d,
-	0x0000e58a,
-	0x0000e5b6,
-	0x0000e5e2,
-	0x0000e60f,
-	0x0000e63b,
-	0x0000e667,
-	0x0000e692,
-	0x0000e6be,
-	0x0000e6e9,
-	0x0000e715,
-	0x0000e740,
-	0x0000e76b,
-	0x0000e796,
-	0x0000e7c1,
-	0x0000e7eb,
-	0x0000e816,
-	0x0000e840,
-	0x0000e86a,
-	0x0000e894,
-	0x0000e8be,
-	0x0000e8e8,
-	0x0000e912,
-	0x0000e93b,
-	0x0000e965,
-	0x0000e98e,
-	0x0000e9b7,
-	0x0000e9e0,
-	0x0000ea09,
-	0x0000ea32,
-	0x0000ea5a,
-	0x0000ea82,
-	0x0000eaaa,
-	0x0000ead3,
-	0x0000eafb,
-	0x0000eb22,
-	0x0000eb4a,
-	0x0000eb72,
-	0x0000eb99,
-	0x0000ebc0,
-	0x0000ebe8,
-	0x0000ec0e,
-	0x0000ec35,
-	0x0000ec5c,
-	0x0000ec83,
-	0x0000eca9,
-	0x0000eccf,
-	0x0000ecf5,
-	0x0000ed1b,
-	0x0000ed41,
-	0x0000ed67,
-	0x0000ed8c,
-	0x0000edb2,
-	0x0000edd7,
-	0x0000edfc,
-	0x0000ee21,
-	0x0000ee46,
-	0x0000ee6b,
-	0x0000ee8f,
-	0x0000eeb4,
-	0x0000eed8,
-	0x0000eefc,
-	0x0000ef20,
-	0x0000ef44,
-	0x0000ef67,
-	0x0000ef8b,
-	0x0000efae,
-	0x0000efd2,
-	0x0000eff4,
-	0x0000f018,
-	0x0000f03b,
-	0x0000f05d,
-	0x0000f080,
-	0x0000f0a2,
-	0x0000f0c4,
-	0x0000f0e6,
-	0x0000f108,
-	0x0000f12a,
-	0x0000f14c,
-	0x0000f16d,
-	0x0000f18f,
-	0x0000f1b0,
-	0x0000f1d1,
-	0x0000f1f2,
-	0x0000f213,
-	0x0000f233,
-	0x0000f254,
-	0x0000f274,
-	0x0000f294,
-	0x0000f2b4,
-	0x0000f2d4,
-	0x0000f2f4,
-	0x0000f313,
-	0x0000f333,
-	0x0000f352,
-	0x0000f372,
-	0x0000f390,
-	0x0000f3af,
-	0x0000f3ce,
-	0x0000f3ed,
-	0x0000f40b,
-	0x0000f429,
-	0x0000f448,
-	0x0000f465,
-	0x0000f483,
-	0x0000f4a1,
-	0x0000f4bf,
-	0x0000f4dc,
-	0x0000f4f9,
-	0x0000f516,
-	0x0000f533,
-	0x0000f550,
-	0x0000f56d,
-	0x0000f589,
-	0x0000f5a6,
-	0x0000f5c2,
-	0x0000f5de,
-	0x0000f5fa,
-	0x0000f616,
-	0x0000f632,
-	0x0000f64d,
-	0x0000f668,
-	0x0000f683,
-	0x0000f69f,
-	0x0000f6b9,
-	0x0000f6d4,
-	0x0000f6ef,
-	0x0000f709,
-	0x0000f723,
-	0x0000f73e,
-	0x0000f757,
-	0x0000f771,
-	0x0000f78b,
-	0x0000f7a5,
-	0x0000f7be,
-	0x0000f7d7,
-	0x0000f7f0,
-	0x0000f809,
-	0x0000f822,
-	0x0000f83b,
-	0x0000f853,
-	0x0000f86c,
-	0x0000f884,
-	0x0000f89c,
-	0x0000f8b4,
-	0x0000f8cc,
-	0x0000f8e3,
-	0x0000f8fb,
-	0x0000f912,
-	0x0000f929,
-	0x0000f940,
-	0x0000f957,
-	0x0000f96e,
-	0x0000f984,
-	0x0000f99b,
-	0x0000f9b1,
-	0x0000f9c7,
-	0x0000f9dd,
-	0x0000f9f3,
-	0x0000fa08,
-	0x0000fa1e,
-	0x0000fa33,
-	0x0000fa48,
-	0x0000fa5d,
-	0x0000fa72,
-	0x0000fa87,
-	0x0000fa9c,
-	0x0000fab0,
-	0x0000fac4,
-	0x0000fad9,
-	0x0000faed,
-	0x0000fb00,
-	0x0000fb14,
-	0x0000fb28,
-	0x0000fb3b,
-	0x0000fb4e,
-	0x0000fb61,
-	0x0000fb74,
-	0x0000fb87,
-	0x0000fb9a,
-	0x0000fbac,
-	0x0000fbbe,
-	0x0000fbd1,
-	0x0000fbe3,
-	0x0000fbf5,
-	0x0000fc06,
-	0x0000fc18,
-	0x0000fc29,
-	0x0000fc3b,
-	0x0000fc4c,
-	0x0000fc5d,
-	0x0000fc6e,
-	0x0000fc7e,
-	0x0000fc8f,
-	0x0000fc9f,
-	0x0000fcaf,
-	0x0000fcbf,
-	0x0000fccf,
-	0x0000fcdf,
-	0x0000fcef,
-	0x0000fcfe,
-	0x0000fd0d,
-	0x0000fd1c,
-	0x0000fd2b,
-	0x0000fd3a,
-	0x0000fd49,
-	0x0000fd57,
-	0x0000fd66,
-	0x0000fd74,
-	0x0000fd82,
-	0x0000fd90,
-	0x0000fd9e,
-	0x0000fdab,
-	0x0000fdb9,
-	0x0000fdc6,
-	0x0000fdd3,
-	0x0000fde0,
-	0x0000fded,
-	0x0000fdfa,
-	0x0000fe06,
-	0x0000fe13,
-	0x0000fe1f,
-	0x0000fe2b,
-	0x0000fe37,
-	0x0000fe43,
-	0x0000fe4e,
-	0x0000fe5a,
-	0x0000fe65,
-	0x0000fe70,
-	0x0000fe7b,
-	0x0000fe86,
-	0x0000fe91,
-	0x0000fe9b,
-	0x0000fea6,
-	0x0000feb0,
-	0x0000feba,
-	0x0000fec4,
-	0x0000fece,
-	0x0000fed7,
-	0x0000fee1,
-	0x0000feea,
-	0x0000fef3,
-	0x0000fefc,
-	0x0000ff05,
-	0x0000ff0e,
-	0x0000ff16,
-	0x0000ff1f,
-	0x0000ff27,
-	0x0000ff2f,
-	0x0000ff37,
-	0x0000ff3f,
-	0x0000ff47,
-	0x0000ff4e,
-	0x0000ff55,
-	0x0000ff5c,
-	0x0000ff64,
-	0x0000ff6a,
-	0x0000ff71,
-	0x0000ff78,
-	0x0000ff7e,
-	0x0000ff84,
-	0x0000ff8a,
-	0x0000ff90,
-	0x0000ff96,
-	0x0000ff9c,
-	0x0000ffa1,
-	0x0000ffa7,
-	0x0000ffac,
-	0x0000ffb1,
-	0x0000ffb6,
-	0x0000ffba,
-	0x0000ffbf,
-	0x0000ffc3,
-	0x0000ffc7,
-	0x0000ffcc,
-	0x0000ffcf,
-	0x0000ffd3,
-	0x0000ffd7,
-	0x0000ffda,
-	0x0000ffde,
-	0x0000ffe1,
-	0x0000ffe4,
-	0x0000ffe7,
-	0x0000ffe9,
-	0x0000ffec,
-	0x0000ffee,
-	0x0000fff1,
-	0x0000fff3,
-	0x0000fff5,
-	0x0000fff6,
-	0x0000fff8,
-	0x0000fff9,
-	0x0000fffb,
-	0x0000fffc,
-	0x0000fffd,
-	0x0000fffe,
-	0x0000ffff,
-	0x0000ffff,
-	0x00010000,
-	0x00010000,
-	0x00010000,
+/* generated by tools/tablegen.c -- sine 8 32 lerp */
+/* sine values for 0 <= x <= pi/2 */
+#define KL_SINE_BITS  8 /* 2^bits intervals */
+#define KL_SINE_FBITS 30 /* fractional bits of an entry */
+#define KL_SINE_LERP  1 /* interpolate between entries, rather than take the nearest */
+static const int32_t sine_values[0x0101] = {
+  0x00000000,
+  0x006487c4,
+  0x00c90e90,
+  0x012d936c,
+  0x0192155f,
+  0x01f69373,
+  0x025b0caf,
+  0x02bf801a,
+  0x0323ecbe,
+  0x038851a2,
+  0x03ecadcf,
+  0x0451004d,
+  0x04b54825,
+  0x0519845e,
+  0x057db403,
+  0x05e1d61b,
+  0x0645e9af,
+  0x06a9edc9,
+  0x070de172,
+  0x0771c3b3,
+  0x07d59396,
+  0x08395024,
+  0x089cf867,
+  0x09008b6a,
+  0x09640837,
+  0x09c76dd8,
+  0x0a2abb59,
+  0x0a8defc3,
+  0x0af10a22,
+  0x0b540982,
+  0x0bb6ecef,
+  0x0c19b374,
+  0x0c7c5c1e,
+  0x0cdee5f9,
+  0x0d415013,
+  0x0da39978,
+  0x0e05c135,
+  0x0e67c65a,
+  0x0ec9a7f3,
+  0x0f2b650f,
+  0x0f8cfcbe,
+  0x0fee6e0d,
+  0x104fb80e,
+  0x10b0d9d0,
+  0x1111d263,
+  0x1172a0d7,
+  0x11d3443f,
+  0x1233bbac,
+  0x1294062f,
+  0x12f422db,
+  0x135410c3,
+  0x13b3cefa,
+  0x14135c94,
+  0x1472b8a5,
+  0x14d1e242,
+  0x1530d881,
+  0x158f9a76,
+  0x15ee2738,
+  0x164c7ddd,
+  0x16aa9d7e,
+  0x17088531,
+  0x1766340f,
+  0x17c3a931,
+  0x1820e3b0,
+  0x187de2a7,
+  0x18daa52f,
+  0x19372a64,
+  0x19937161,
+  0x19ef7944,
+  0x1a4b4128,
+  0x1aa6c82b,
+  0x1b020d6c,
+  0x1b5d100a,
+  0x1bb7cf23,
+  0x1c1249d8,
+  0x1c6c7f4a,
+  0x1cc66e99,
+  0x1d2016e9,
+  0x1d79775c,
+  0x1dd28f15,
+  0x1e2b5d38,
+  0x1e83e0eb,
+  0x1edc1953,
+  0x1f340596,
+  0x1f8ba4dc,
+  0x1fe2f64c,
+  0x2039f90f,
+  0x2090ac4d,
+  0x20e70f32,
+  0x213d20e8,
+  0x2192e09b,
+  0x21e84d76,
+  0x223d66a8,
+  0x22922b5e,
+  0x22e69ac8,
+  0x233ab414,
+  0x238e7673,
+  0x23e1e117,
+  0x2434f332,
+  0x2487abf7,
+  0x24da0a9a,
+  0x252c0e4f,
+  0x257db64c,
+  0x25cf01c8,
+  0x261feffa,
+  0x2670801a,
+  0x26c0b162,
+  0x2710830c,
+  0x275ff452,
+  0x27af0472,
+  0x27fdb2a7,
+  0x284bfe2f,
+  0x2899e64a,
+  0x28e76a37,
+  0x29348937,
+  0x2981428c,
+  0x29cd9578,
+  0x2a19813f,
+  0x2a650525,
+  0x2ab02071,
+  0x2afad269,
+  0x2b451a55,
+  0x2b8ef77d,
+  0x2bd8692b,
+  0x2c216eaa,
+  0x2c6a0746,
+  0x2cb2324c,
+  0x2cf9ef09,
+  0x2d413ccd,
+  0x2d881ae8,
+  0x2dce88aa,
+  0x2e148566,
+  0x2e5a1070,
+  0x2e9f291b,
+  0x2ee3cebe,
+  0x2f2800af,
+  0x2f6bbe45,
+  0x2faf06da,
+  0x2ff1d9c7,
+  0x30343667,
+  0x30761c18,
+  0x30b78a36,
+  0x30f8801f,
+  0x3138fd35,
+  0x317900d6,
+  0x31b88a66,
+  0x31f79948,
+  0x32362ce0,
+  0x32744493,
+  0x32b1dfc9,
+  0x32eefdea,
+  0x332b9e5e,
+  0x3367c090,
+  0x33a363ec,
+  0x33de87de,
+  0x34192bd5,
+  0x34534f41,
+  0x348cf190,
+  0x34c61236,
+  0x34feb0a5,
+  0x3536cc52,
+  0x356e64b2,
+  0x35a5793c,
+  0x35dc0968,
+  0x361214b0,
+  0x36479a8e,
+  0x367c9a7e,
+  0x36b113fd,
+  0x36e5068a,
+  0x371871a5,
+  0x374b54ce,
+  0x377daf89,
+  0x37af8159,
+  0x37e0c9c3,
+  0x3811884d,
+  0x3841bc7f,
+  0x387165e3,
+  0x38a08402,
+  0x38cf1669,
+  0x38fd1ca4,
+  0x392a9642,
+  0x395782d3,
+  0x3983e1e8,
+  0x39afb313,
+  0x39daf5e8,
+  0x3a05a9fd,
+  0x3a2fcee8,
+  0x3a596442,
+  0x3a8269a3,
+  0x3aaadea6,
+  0x3ad2c2e8,
+  0x3afa1605,
+  0x3b20d79e,
+  0x3b470753,
+  0x3b6ca4c4,
+  0x3b91af97,
+  0x3bb6276e,
+  0x3bda0bf0,
+  0x3bfd5cc4,
+  0x3c201994,
+  0x3c42420a,
+  0x3c63d5d1,
+  0x3c84d496,
+  0x3ca53e09,
+  0x3cc511d9,
+  0x3ce44fb7,
+  0x3d02f757,
+  0x3d21086c,
+  0x3d3e82ae,
+  0x3d5b65d2,
+  0x3d77b192,
+  0x3d9365a8,
+  0x3dae81cf,
+  0x3dc905c5,
+  0x3de2f148,
+  0x3dfc4418,
+  0x3e14fdf7,
+  0x3e2d1ea8,
+  0x3e44a5ef,
+  0x3e5b9392,
+  0x3e71e759,
+  0x3e87a10c,
+  0x3e9cc076,
+  0x3eb14563,
+  0x3ec52fa0,
+  0x3ed87efc,
+  0x3eeb3347,
+  0x3efd4c54,
+  0x3f0ec9f5,
+  0x3f1fabff,
+  0x3f2ff24a,
+  0x3f3f9cab,
+  0x3f4eaafe,
+  0x3f5d1d1d,
+  0x3f6af2e3,
+  0x3f782c30,
+  0x3f84c8e2,
+  0x3f90c8da,
+  0x3f9c2bfb,
+  0x3fa6f228,
+  0x3fb11b48,
+  0x3fbaa740,
+  0x3fc395f9,
+  0x3fcbe75e,
+  0x3fd39b5a,
+  0x3fdab1d9,
+  0x3fe12acb,
+  0x3fe7061f,
+  0x3fec43c7,
+  0x3ff0e3b6,
+  0x3ff4e5e0,
+  0x3ff84a3c,
+  0x3ffb10c1,
+  0x3ffd3969,
+  0x3ffec42d,
+  0x3fffb10b,
+  0x40000000,
 };
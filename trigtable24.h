@@ -0,0 +1,4104 @@
+/* generated by tools/tablegen.c -- sine 12 32 lerp */
+/* sine values for 0 <= x <= pi/2 */
+#define KL_SINE_BITS  12 /* 2^bits intervals */
+#define KL_SINE_FBITS 30 /* fractional bits of an entry */
+#define KL_SINE_LERP  1 /* interpolate between entries, rather than take the nearest */
+static const int32_t sine_values[0x1001] = {
+  0x00000000,
+  0x0006487f,
+  0x000c90fe,
+  0x0012d97c,
+  0x001921fb,
+  0x001f6a79,
+  0x0025b2f7,
+  0x002bfb74,
+  0x003243f1,
+  0x00388c6e,
+  0x003ed4ea,
+  0x00451d66,
+  0x004b65e1,
+  0x0051ae5b,
+  0x0057f6d4,
+  0x005e3f4c,
+  0x006487c4,
+  0x006ad03b,
+  0x007118b0,
+  0x00776125,
+  0x007da998,
+  0x0083f20a,
+  0x008a3a7b,
+  0x009082ea,
+  0x0096cb58,
+  0x009d13c5,
+  0x00a35c30,
+  0x00a9a49a,
+  0x00afed02,
+  0x00b63568,
+  0x00bc7dcc,
+  0x00c2c62f,
+  0x00c90e90,
+  0x00cf56ef,
+  0x00d59f4c,
+  0x00dbe7a6,
+  0x00e22fff,
+  0x00e87856,
+  0x00eec0aa,
+  0x00f508fc,
+  0x00fb514b,
+  0x01019998,
+  0x0107e1e3,
+  0x010e2a2b,
+  0x01147271,
+  0x011abab4,
+  0x012102f4,
+  0x01274b31,
+  0x012d936c,
+  0x0133dba3,
+  0x013a23d8,
+  0x01406c0a,
+  0x0146b438,
+  0x014cfc63,
+  0x0153448c,
+  0x01598cb1,
+  0x015fd4d2,
+  0x01661cf0,
+  0x016c650b,
+  0x0172ad22,
+  0x0178f536,
+  0x017f3d46,
+  0x01858552,
+  0x018bcd5b,
+  0x0192155f,
+  0x01985d60,
+  0x019ea55d,
+  0x01a4ed56,
+  0x01ab354b,
+  0x01b17d3c,
+  0x01b7c528,
+  0x01be0d11,
+  0x01c454f5,
+  0x01ca9cd4,
+  0x01d0e4b0,
+  0x01d72c87,
+  0x01dd7459,
+  0x01e3bc26,
+  0x01ea03ef,
+  0x01f04bb4,
+  0x01f69373,
+  0x01fcdb2e,
+  0x020322e3,
+  0x02096a94,
+  0x020fb240,
+  0x0215f9e7,
+  0x021c4188,
+  0x02228924,
+  0x0228d0bb,
+  0x022f184d,
+  0x02355fd9,
+  0x023ba760,
+  0x0241eee2,
+  0x0248365d,
+  0x024e7dd4,
+  0x0254c544,
+  0x025b0caf,
+  0x02615414,
+  0x02679b73,
+  0x026de2cc,
+  0x02742a1f,
+  0x027a716c,
+  0x0280b8b3,
+  0x0286fff3,
+  0x028d472e,
+  0x02938e62,
+  0x0299d590,
+  0x02a01cb8,
+  0x02a663d8,
+  0x02acaaf3,
+  0x02b2f207,
+  0x02b93914,
+  0x02bf801a,
+  0x02c5c71a,
+  0x02cc0e13,
+  0x02d25505,
+  0x02d89bf0,
+  0x02dee2d4,
+  0x02e529b0,
+  0x02eb7086,
+  0x02f1b755,
+  0x02f7fe1c,
+  0x02fe44dc,
+  0x03048b94,
+  0x030ad245,
+  0x031118ef,
+  0x03175f91,
+  0x031da62b,
+  0x0323ecbe,
+  0x032a3349,
+  0x033079cc,
+  0x0336c047,
+  0x033d06bb,
+  0x03434d26,
+  0x03499389,
+  0x034fd9e5,
+  0x03562038,
+  0x035c6682,
+  0x0362acc5,
+  0x0368f2ff,
+  0x036f3931,
+  0x03757f5a,
+  0x037bc57b,
+  0x03820b93,
+  0x038851a2,
+  0x038e97a9,
+  0x0394dda7,
+  0x039b239c,
+  0x03a16988,
+  0x03a7af6c,
+  0x03adf546,
+  0x03b43b17,
+  0x03ba80df,
+  0x03c0c69e,
+  0x03c70c54,
+  0x03cd5200,
+  0x03d397a3,
+  0x03d9dd3c,
+  0x03e022cc,
+  0x03e66852,
+  0x03ecadcf,
+  0x03f2f342,
+  0x03f938ac,
+  0x03ff7e0b,
+  0x0405c361,
+  0x040c08ad,
+  0x04124dee,
+  0x04189326,
+  0x041ed854,
+  0x04251d77,
+  0x042b6290,
+  0x0431a79f,
+  0x0437eca4,
+  0x043e319e,
+  0x0444768d,
+  0x044abb73,
+  0x0451004d,
+  0x0457451d,
+  0x045d89e2,
+  0x0463ce9d,
+  0x046a134c,
+  0x047057f1,
+  0x04769c8b,
+  0x047ce11a,
+  0x0483259d,
+  0x04896a16,
+  0x048fae83,
+  0x0495f2e5,
+  0x049c373c,
+  0x04a27b87,
+  0x04a8bfc7,
+  0x04af03fc,
+  0x04b54825,
+  0x04bb8c42,
+  0x04c1d054,
+  0x04c81459,
+  0x04ce5854,
+  0x04d49c42,
+  0x04dae024,
+  0x04e123fa,
+  0x04e767c5,
+  0x04edab83,
+  0x04f3ef35,
+  0x04fa32db,
+  0x05007674,
+  0x0506ba01,
+  0x050cfd82,
+  0x051340f6,
+  0x0519845e,
+  0x051fc7b9,
+  0x05260b08,
+  0x052c4e4a,
+  0x0532917f,
+  0x0538d4a7,
+  0x053f17c3,
+  0x05455ad1,
+  0x054b9dd3,
+  0x0551e0c7,
+  0x055823ae,
+  0x055e6688,
+  0x0564a955,
+  0x056aec15,
+  0x05712ec7,
+  0x0577716b,
+  0x057db403,
+  0x0583f68c,
+  0x058a3908,
+  0x05907b77,
+  0x0596bdd7,
+  0x059d002a,
+  0x05a3426f,
+  0x05a984a6,
+  0x05afc6d0,
+  0x05b608eb,
+  0x05bc4af8,
+  0x05c28cf7,
+  0x05c8cee7,
+  0x05cf10ca,
+  0x05d5529e,
+  0x05db9463,
+  0x05e1d61b,
+  0x05e817c3,
+  0x05ee595d,
+  0x05f49ae9,
+  0x05fadc66,
+  0x06011dd4,
+  0x06075f33,
+  0x060da083,
+  0x0613e1c5,
+  0x061a22f7,
+  0x0620641a,
+  0x0626a52f,
+  0x062ce634,
+  0x0633272a,
+  0x06396810,
+  0x063fa8e7,
+  0x0645e9af,
+  0x064c2a67,
+  0x06526b10,
+  0x0658aba9,
+  0x065eec33,
+  0x06652cac,
+  0x066b6d16,
+  0x0671ad71,
+  0x0677edbb,
+  0x067e2df5,
+  0x06846e1f,
+  0x068aae3a,
+  0x0690ee44,
+  0x06972e3d,
+  0x069d6e27,
+  0x06a3ae00,
+  0x06a9edc9,
+  0x06b02d81,
+  0x06b66d29,
+  0x06bcacc1,
+  0x06c2ec48,
+  0x06c92bbe,
+  0x06cf6b23,
+  0x06d5aa77,
+  0x06dbe9bb,
+  0x06e228ee,
+  0x06e86810,
+  0x06eea720,
+  0x06f4e620,
+  0x06fb250e,
+  0x070163eb,
+  0x0707a2b7,
+  0x070de172,
+  0x0714201b,
+  0x071a5eb3,
+  0x07209d39,
+  0x0726dbae,
+  0x072d1a10,
+  0x07335862,
+  0x073996a1,
+  0x073fd4cf,
+  0x074612eb,
+  0x074c50f4,
+  0x07528eec,
+  0x0758ccd2,
+  0x075f0aa5,
+  0x07654867,
+  0x076b8616,
+  0x0771c3b3,
+  0x0778013d,
+  0x077e3eb5,
+  0x07847c1b,
+  0x078ab96e,
+  0x0790f6ae,
+  0x079733dc,
+  0x079d70f7,
+  0x07a3adff,
+  0x07a9eaf5,
+  0x07b027d7,
+  0x07b664a7,
+  0x07bca163,
+  0x07c2de0d,
+  0x07c91aa3,
+  0x07cf5726,
+  0x07d59396,
+  0x07dbcff2,
+  0x07e20c3b,
+  0x07e84871,
+  0x07ee8493,
+  0x07f4c0a1,
+  0x07fafc9c,
+  0x08013883,
+  0x08077457,
+  0x080db016,
+  0x0813ebc2,
+  0x081a275a,
+  0x082062de,
+  0x08269e4d,
+  0x082cd9a9,
+  0x083314f1,
+  0x08395024,
+  0x083f8b43,
+  0x0845c64d,
+  0x084c0144,
+  0x08523c25,
+  0x085876f3,
+  0x085eb1ab,
+  0x0864ec4f,
+  0x086b26de,
+  0x08716159,
+  0x08779bbe,
+  0x087dd60f,
+  0x0884104b,
+  0x088a4a72,
+  0x08908483,
+  0x0896be80,
+  0x089cf867,
+  0x08a3323a,
+  0x08a96bf6,
+  0x08afa59e,
+  0x08b5df30,
+  0x08bc18ac,
+  0x08c25213,
+  0x08c88b65,
+  0x08cec4a0,
+  0x08d4fdc6,
+  0x08db36d6,
+  0x08e16fd1,
+  0x08e7a8b5,
+  0x08ede184,
+  0x08f41a3c,
+  0x08fa52de,
+  0x09008b6a,
+  0x0906c3e0,
+  0x090cfc40,
+  0x09133489,
+  0x09196cbc,
+  0x091fa4d9,
+  0x0925dcdf,
+  0x092c14ce,
+  0x09324ca7,
+  0x09388469,
+  0x093ebc14,
+  0x0944f3a9,
+  0x094b2b27,
+  0x0951628d,
+  0x095799dd,
+  0x095dd116,
+  0x09640837,
+  0x096a3f42,
+  0x09707635,
+  0x0976ad11,
+  0x097ce3d5,
+  0x09831a82,
+  0x09895118,
+  0x098f8796,
+  0x0995bdfd,
+  0x099bf44c,
+  0x09a22a83,
+  0x09a860a2,
+  0x09ae96aa,
+  0x09b4cc99,
+  0x09bb0271,
+  0x09c13831,
+  0x09c76dd8,
+  0x09cda368,
+  0x09d3d8df,
+  0x09da0e3e,
+  0x09e04385,
+  0x09e678b4,
+  0x09ecadc9,
+  0x09f2e2c7,
+  0x09f917ac,
+  0x09ff4c78,
+  0x0a05812c,
+  0x0a0bb5c7,
+  0x0a11ea49,
+  0x0a181eb2,
+  0x0a1e5303,
+  0x0a24873a,
+  0x0a2abb59,
+  0x0a30ef5e,
+  0x0a37234a,
+  0x0a3d571d,
+  0x0a438ad7,
+  0x0a49be77,
+  0x0a4ff1fe,
+  0x0a56256c,
+  0x0a5c58c0,
+  0x0a628bfa,
+  0x0a68bf1b,
+  0x0a6ef222,
+  0x0a752510,
+  0x0a7b57e3,
+  0x0a818a9d,
+  0x0a87bd3d,
+  0x0a8defc3,
+  0x0a94222f,
+  0x0a9a5480,
+  0x0aa086b8,
+  0x0aa6b8d5,
+  0x0aacead8,
+  0x0ab31cc1,
+  0x0ab94e8f,
+  0x0abf8043,
+  0x0ac5b1dc,
+  0x0acbe35b,
+  0x0ad214bf,
+  0x0ad84609,
+  0x0ade7737,
+  0x0ae4a84b,
+  0x0aead944,
+  0x0af10a22,
+  0x0af73ae5,
+  0x0afd6b8d,
+  0x0b039c1a,
+  0x0b09cc8c,
+  0x0b0ffce2,
+  0x0b162d1d,
+  0x0b1c5d3d,
+  0x0b228d42,
+  0x0b28bd2a,
+  0x0b2eecf8,
+  0x0b351caa,
+  0x0b3b4c40,
+  0x0b417bba,
+  0x0b47ab19,
+  0x0b4dda5c,
+  0x0b540982,
+  0x0b5a388d,
+  0x0b60677c,
+  0x0b66964f,
+  0x0b6cc506,
+  0x0b72f3a1,
+  0x0b79221f,
+  0x0b7f5081,
+  0x0b857ec7,
+  0x0b8bacf0,
+  0x0b91dafc,
+  0x0b9808ed,
+  0x0b9e36c0,
+  0x0ba46477,
+  0x0baa9211,
+  0x0bb0bf8f,
+  0x0bb6ecef,
+  0x0bbd1a33,
+  0x0bc34759,
+  0x0bc97463,
+  0x0bcfa150,
+  0x0bd5ce1f,
+  0x0bdbfad1,
+  0x0be22766,
+  0x0be853de,
+  0x0bee8038,
+  0x0bf4ac75,
+  0x0bfad894,
+  0x0c010496,
+  0x0c07307a,
+  0x0c0d5c41,
+  0x0c1387e9,
+  0x0c19b374,
+  0x0c1fdee1,
+  0x0c260a31,
+  0x0c2c3562,
+  0x0c326075,
+  0x0c388b6a,
+  0x0c3eb641,
+  0x0c44e0f9,
+  0x0c4b0b94,
+  0x0c513610,
+  0x0c57606e,
+  0x0c5d8aad,
+  0x0c63b4ce,
+  0x0c69ded0,
+  0x0c7008b3,
+  0x0c763278,
+  0x0c7c5c1e,
+  0x0c8285a5,
+  0x0c88af0e,
+  0x0c8ed857,
+  0x0c950182,
+  0x0c9b2a8d,
+  0x0ca1537a,
+  0x0ca77c47,
+  0x0cada4f5,
+  0x0cb3cd84,
+  0x0cb9f5f3,
+  0x0cc01e43,
+  0x0cc64673,
+  0x0ccc6e84,
+  0x0cd29676,
+  0x0cd8be47,
+  0x0cdee5f9,
+  0x0ce50d8c,
+  0x0ceb34fe,
+  0x0cf15c51,
+  0x0cf78383,
+  0x0cfdaa96,
+  0x0d03d189,
+  0x0d09f85b,
+  0x0d101f0e,
+  0x0d1645a0,
+  0x0d1c6c11,
+  0x0d229263,
+  0x0d28b894,
+  0x0d2edea5,
+  0x0d350495,
+  0x0d3b2a64,
+  0x0d415013,
+  0x0d4775a1,
+  0x0d4d9b0e,
+  0x0d53c05b,
+  0x0d59e586,
+  0x0d600a91,
+  0x0d662f7b,
+  0x0d6c5443,
+  0x0d7278eb,
+  0x0d789d71,
+  0x0d7ec1d6,
+  0x0d84e61a,
+  0x0d8b0a3d,
+  0x0d912e3e,
+  0x0d97521d,
+  0x0d9d75db,
+  0x0da39978,
+  0x0da9bcf2,
+  0x0dafe04b,
+  0x0db60383,
+  0x0dbc2698,
+  0x0dc2498c,
+  0x0dc86c5d,
+  0x0dce8f0d,
+  0x0dd4b19a,
+  0x0ddad406,
+  0x0de0f64f,
+  0x0de71876,
+  0x0ded3a7b,
+  0x0df35c5d,
+  0x0df97e1d,
+  0x0dff9fba,
+  0x0e05c135,
+  0x0e0be28e,
+  0x0e1203c3,
+  0x0e1824d6,
+  0x0e1e45c6,
+  0x0e246693,
+  0x0e2a873e,
+  0x0e30a7c5,
+  0x0e36c82a,
+  0x0e3ce86b,
+  0x0e430889,
+  0x0e492884,
+  0x0e4f485c,
+  0x0e556811,
+  0x0e5b87a2,
+  0x0e61a70f,
+  0x0e67c65a,
+  0x0e6de580,
+  0x0e740483,
+  0x0e7a2363,
+  0x0e80421e,
+  0x0e8660b6,
+  0x0e8c7f2a,
+  0x0e929d7a,
+  0x0e98bba7,
+  0x0e9ed9af,
+  0x0ea4f793,
+  0x0eab1553,
+  0x0eb132ef,
+  0x0eb75066,
+  0x0ebd6db9,
+  0x0ec38ae8,
+  0x0ec9a7f3,
+  0x0ecfc4d9,
+  0x0ed5e19a,
+  0x0edbfe37,
+  0x0ee21aaf,
+  0x0ee83702,
+  0x0eee5331,
+  0x0ef46f3b,
+  0x0efa8b20,
+  0x0f00a6df,
+  0x0f06c27a,
+  0x0f0cddf0,
+  0x0f12f941,
+  0x0f19146c,
+  0x0f1f2f73,
+  0x0f254a53,
+  0x0f2b650f,
+  0x0f317fa5,
+  0x0f379a16,
+  0x0f3db461,
+  0x0f43ce86,
+  0x0f49e886,
+  0x0f500260,
+  0x0f561c15,
+  0x0f5c35a3,
+  0x0f624f0c,
+  0x0f68684e,
+  0x0f6e816b,
+  0x0f749a61,
+  0x0f7ab332,
+  0x0f80cbdc,
+  0x0f86e460,
+  0x0f8cfcbe,
+  0x0f9314f5,
+  0x0f992d06,
+  0x0f9f44f0,
+  0x0fa55cb4,
+  0x0fab7451,
+  0x0fb18bc8,
+  0x0fb7a317,
+  0x0fbdba40,
+  0x0fc3d143,
+  0x0fc9e81e,
+  0x0fcffed2,
+  0x0fd6155f,
+  0x0fdc2bc6,
+  0x0fe24205,
+  0x0fe8581d,
+  0x0fee6e0d,
+  0x0ff483d7,
+  0x0ffa9979,
+  0x1000aef3,
+  0x1006c446,
+  0x100cd972,
+  0x1012ee76,
+  0x10190352,
+  0x101f1807,
+  0x10252c94,
+  0x102b40f8,
+  0x10315535,
+  0x1037694b,
+  0x103d7d38,
+  0x104390fd,
+  0x1049a49a,
+  0x104fb80e,
+  0x1055cb5b,
+  0x105bde7f,
+  0x1061f17b,
+  0x1068044e,
+  0x106e16f9,
+  0x1074297b,
+  0x107a3bd5,
+  0x10804e06,
+  0x1086600e,
+  0x108c71ee,
+  0x109283a5,
+  0x10989532,
+  0x109ea697,
+  0x10a4b7d3,
+  0x10aac8e6,
+  0x10b0d9d0,
+  0x10b6ea90,
+  0x10bcfb28,
+  0x10c30b96,
+  0x10c91bda,
+  0x10cf2bf6,
+  0x10d53be7,
+  0x10db4baf,
+  0x10e15b4e,
+  0x10e76ac3,
+  0x10ed7a0e,
+  0x10f38930,
+  0x10f99827,
+  0x10ffa6f5,
+  0x1105b599,
+  0x110bc413,
+  0x1111d263,
+  0x1117e088,
+  0x111dee84,
+  0x1123fc55,
+  0x112a09fc,
+  0x11301779,
+  0x113624cb,
+  0x113c31f3,
+  0x11423ef0,
+  0x11484bc2,
+  0x114e586a,
+  0x115464e8,
+  0x115a713a,
+  0x11607d62,
+  0x1166895f,
+  0x116c9531,
+  0x1172a0d7,
+  0x1178ac53,
+  0x117eb7a4,
+  0x1184c2ca,
+  0x118acdc4,
+  0x1190d893,
+  0x1196e337,
+  0x119cedaf,
+  0x11a2f7fc,
+  0x11a9021d,
+  0x11af0c13,
+  0x11b515dd,
+  0x11bb1f7c,
+  0x11c128ee,
+  0x11c73235,
+  0x11cd3b50,
+  0x11d3443f,
+  0x11d94d02,
+  0x11df5599,
+  0x11e55e04,
+  0x11eb6643,
+  0x11f16e56,
+  0x11f7763c,
+  0x11fd7df6,
+  0x12038584,
+  0x12098ce5,
+  0x120f941a,
+  0x12159b22,
+  0x121ba1fd,
+  0x1221a8ac,
+  0x1227af2e,
+  0x122db583,
+  0x1233bbac,
+  0x1239c1a7,
+  0x123fc776,
+  0x1245cd17,
+  0x124bd28c,
+  0x1251d7d3,
+  0x1257dced,
+  0x125de1da,
+  0x1263e699,
+  0x1269eb2b,
+  0x126fef90,
+  0x1275f3c7,
+  0x127bf7d1,
+  0x1281fbad,
+  0x1287ff5b,
+  0x128e02dc,
+  0x1294062f,
+  0x129a0954,
+  0x12a00c4b,
+  0x12a60f14,
+  0x12ac11af,
+  0x12b2141c,
+  0x12b8165b,
+  0x12be186c,
+  0x12c41a4f,
+  0x12ca1c03,
+  0x12d01d89,
+  0x12d61ee0,
+  0x12dc2009,
+  0x12e22103,
+  0x12e821cf,
+  0x12ee226c,
+  0x12f422db,
+  0x12fa231b,
+  0x1300232c,
+  0x1306230d,
+  0x130c22c1,
+  0x13122245,
+  0x1318219a,
+  0x131e20c0,
+  0x13241fb6,
+  0x132a1e7e,
+  0x13301d16,
+  0x13361b7f,
+  0x133c19b8,
+  0x134217c2,
+  0x1348159d,
+  0x134e1348,
+  0x135410c3,
+  0x135a0e0e,
+  0x13600b2a,
+  0x13660816,
+  0x136c04d2,
+  0x1372015f,
+  0x1377fdbb,
+  0x137df9e7,
+  0x1383f5e3,
+  0x1389f1af,
+  0x138fed4b,
+  0x1395e8b7,
+  0x139be3f2,
+  0x13a1defd,
+  0x13a7d9d7,
+  0x13add481,
+  0x13b3cefa,
+  0x13b9c943,
+  0x13bfc35b,
+  0x13c5bd42,
+  0x13cbb6f8,
+  0x13d1b07e,
+  0x13d7a9d3,
+  0x13dda2f7,
+  0x13e39be9,
+  0x13e994ab,
+  0x13ef8d3c,
+  0x13f5859b,
+  0x13fb7dc9,
+  0x140175c6,
+  0x14076d91,
+  0x140d652c,
+  0x14135c94,
+  0x141953cb,
+  0x141f4ad1,
+  0x142541a4,
+  0x142b3846,
+  0x14312eb7,
+  0x143724f5,
+  0x143d1b02,
+  0x144310dd,
+  0x14490685,
+  0x144efbfc,
+  0x1454f140,
+  0x145ae653,
+  0x1460db33,
+  0x1466cfe1,
+  0x146cc45c,
+  0x1472b8a5,
+  0x1478acbc,
+  0x147ea0a0,
+  0x14849452,
+  0x148a87d1,
+  0x14907b1d,
+  0x14966e36,
+  0x149c611d,
+  0x14a253d1,
+  0x14a84652,
+  0x14ae38a0,
+  0x14b42abb,
+  0x14ba1ca3,
+  0x14c00e58,
+  0x14c5ffd9,
+  0x14cbf127,
+  0x14d1e242,
+  0x14d7d32a,
+  0x14ddc3de,
+  0x14e3b45f,
+  0x14e9a4ac,
+  0x14ef94c6,
+  0x14f584ac,
+  0x14fb745e,
+  0x150163dc,
+  0x15075327,
+  0x150d423d,
+  0x15133120,
+  0x15191fcf,
+  0x151f0e4a,
+  0x1524fc90,
+  0x152aeaa3,
+  0x1530d881,
+  0x1536c62b,
+  0x153cb3a0,
+  0x1542a0e1,
+  0x15488dee,
+  0x154e7ac6,
+  0x1554676a,
+  0x155a53d9,
+  0x15604013,
+  0x15662c18,
+  0x156c17e9,
+  0x15720385,
+  0x1577eeec,
+  0x157dda1e,
+  0x1583c51b,
+  0x1589afe3,
+  0x158f9a76,
+  0x159584d3,
+  0x159b6efb,
+  0x15a158ee,
+  0x15a742ac,
+  0x15ad2c34,
+  0x15b31587,
+  0x15b8fea4,
+  0x15bee78c,
+  0x15c4d03e,
+  0x15cab8ba,
+  0x15d0a100,
+  0x15d68911,
+  0x15dc70eb,
+  0x15e25890,
+  0x15e83fff,
+  0x15ee2738,
+  0x15f40e3a,
+  0x15f9f507,
+  0x15ffdb9d,
+  0x1605c1fd,
+  0x160ba826,
+  0x16118e1a,
+  0x161773d6,
+  0x161d595d,
+  0x16233eac,
+  0x162923c5,
+  0x162f08a8,
+  0x1634ed53,
+  0x163ad1c8,
+  0x1640b606,
+  0x16469a0d,
+  0x164c7ddd,
+  0x16526176,
+  0x165844d8,
+  0x165e2803,
+  0x16640af7,
+  0x1669edb3,
+  0x166fd039,
+  0x1675b286,
+  0x167b949d,
+  0x1681767c,
+  0x16875823,
+  0x168d3993,
+  0x16931acb,
+  0x1698fbcb,
+  0x169edc94,
+  0x16a4bd25,
+  0x16aa9d7e,
+  0x16b07d9f,
+  0x16b65d88,
+  0x16bc3d39,
+  0x16c21cb2,
+  0x16c7fbf3,
+  0x16cddafb,
+  0x16d3b9cc,
+  0x16d99864,
+  0x16df76c3,
+  0x16e554ea,
+  0x16eb32d9,
+  0x16f1108f,
+  0x16f6ee0d,
+  0x16fccb51,
+  0x1702a85e,
+  0x17088531,
+  0x170e61cc,
+  0x17143e2d,
+  0x171a1a56,
+  0x171ff646,
+  0x1725d1fc,
+  0x172bad7a,
+  0x173188be,
+  0x173763c9,
+  0x173d3e9b,
+  0x17431933,
+  0x1748f393,
+  0x174ecdb8,
+  0x1754a7a4,
+  0x175a8157,
+  0x17605ad0,
+  0x1766340f,
+  0x176c0d15,
+  0x1771e5e0,
+  0x1777be72,
+  0x177d96ca,
+  0x17836ee8,
+  0x178946cc,
+  0x178f1e76,
+  0x1794f5e6,
+  0x179acd1c,
+  0x17a0a417,
+  0x17a67ad8,
+  0x17ac515f,
+  0x17b227ab,
+  0x17b7fdbd,
+  0x17bdd394,
+  0x17c3a931,
+  0x17c97e93,
+  0x17cf53bb,
+  0x17d528a7,
+  0x17dafd59,
+  0x17e0d1d0,
+  0x17e6a60c,
+  0x17ec7a0d,
+  0x17f24dd3,
+  0x17f8215e,
+  0x17fdf4ae,
+  0x1803c7c3,
+  0x18099a9c,
+  0x180f6d3a,
+  0x18153f9d,
+  0x181b11c4,
+  0x1820e3b0,
+  0x1826b561,
+  0x182c86d5,
+  0x1832580e,
+  0x1838290c,
+  0x183df9cd,
+  0x1843ca53,
+  0x18499a9d,
+  0x184f6aab,
+  0x18553a7d,
+  0x185b0a13,
+  0x1860d96d,
+  0x1866a88a,
+  0x186c776c,
+  0x18724611,
+  0x1878147a,
+  0x187de2a7,
+  0x1883b097,
+  0x18897e4a,
+  0x188f4bc2,
+  0x189518fc,
+  0x189ae5fa,
+  0x18a0b2bb,
+  0x18a67f3f,
+  0x18ac4b87,
+  0x18b21791,
+  0x18b7e35f,
+  0x18bdaef0,
+  0x18c37a44,
+  0x18c9455a,
+  0x18cf1034,
+  0x18d4dad0,
+  0x18daa52f,
+  0x18e06f50,
+  0x18e63935,
+  0x18ec02db,
+  0x18f1cc45,
+  0x18f79571,
+  0x18fd5e5f,
+  0x1903270f,
+  0x1908ef82,
+  0x190eb7b7,
+  0x19147fae,
+  0x191a4767,
+  0x19200ee3,
+  0x1925d620,
+  0x192b9d1f,
+  0x193163e1,
+  0x19372a64,
+  0x193cf0a9,
+  0x1942b6af,
+  0x19487c77,
+  0x194e4201,
+  0x1954074d,
+  0x1959cc5a,
+  0x195f9128,
+  0x196555b8,
+  0x196b1a09,
+  0x1970de1b,
+  0x1976a1ef,
+  0x197c6584,
+  0x198228d9,
+  0x1987ebf0,
+  0x198daec8,
+  0x19937161,
+  0x199933bb,
+  0x199ef5d6,
+  0x19a4b7b1,
+  0x19aa794d,
+  0x19b03aaa,
+  0x19b5fbc8,
+  0x19bbbca6,
+  0x19c17d44,
+  0x19c73da3,
+  0x19ccfdc2,
+  0x19d2bda2,
+  0x19d87d42,
+  0x19de3ca2,
+  0x19e3fbc3,
+  0x19e9baa3,
+  0x19ef7944,
+  0x19f537a4,
+  0x19faf5c5,
+  0x1a00b3a5,
+  0x1a067145,
+  0x1a0c2ea5,
+  0x1a11ebc5,
+  0x1a17a8a5,
+  0x1a1d6544,
+  0x1a2321a2,
+  0x1a28ddc0,
+  0x1a2e999e,
+  0x1a34553b,
+  0x1a3a1097,
+  0x1a3fcbb3,
+  0x1a45868e,
+  0x1a4b4128,
+  0x1a50fb81,
+  0x1a56b599,
+  0x1a5c6f70,
+  0x1a622907,
+  0x1a67e25c,
+  0x1a6d9b70,
+  0x1a735442,
+  0x1a790cd4,
+  0x1a7ec524,
+  0x1a847d33,
+  0x1a8a3500,
+  0x1a8fec8c,
+  0x1a95a3d6,
+  0x1a9b5adf,
+  0x1aa111a6,
+  0x1aa6c82b,
+  0x1aac7e6f,
+  0x1ab23471,
+  0x1ab7ea31,
+  0x1abd9faf,
+  0x1ac354eb,
+  0x1ac909e5,
+  0x1acebe9d,
+  0x1ad47312,
+  0x1ada2746,
+  0x1adfdb37,
+  0x1ae58ee6,
+  0x1aeb4253,
+  0x1af0f57d,
+  0x1af6a865,
+  0x1afc5b0a,
+  0x1b020d6c,
+  0x1b07bf8c,
+  0x1b0d716a,
+  0x1b132304,
+  0x1b18d45c,
+  0x1b1e8571,
+  0x1b243643,
+  0x1b29e6d2,
+  0x1b2f971e,
+  0x1b354727,
+  0x1b3af6ec,
+  0x1b40a66f,
+  0x1b4655ae,
+  0x1b4c04aa,
+  0x1b51b363,
+  0x1b5761d8,
+  0x1b5d100a,
+  0x1b62bdf8,
+  0x1b686ba3,
+  0x1b6e190a,
+  0x1b73c62d,
+  0x1b79730d,
+  0x1b7f1fa9,
+  0x1b84cc01,
+  0x1b8a7815,
+  0x1b9023e5,
+  0x1b95cf71,
+  0x1b9b7ab9,
+  0x1ba125bd,
+  0x1ba6d07d,
+  0x1bac7af9,
+  0x1bb22530,
+  0x1bb7cf23,
+  0x1bbd78d2,
+  0x1bc3223c,
+  0x1bc8cb61,
+  0x1bce7442,
+  0x1bd41cdf,
+  0x1bd9c537,
+  0x1bdf6d4a,
+  0x1be51518,
+  0x1beabca1,
+  0x1bf063e6,
+  0x1bf60ae6,
+  0x1bfbb1a0,
+  0x1c015816,
+  0x1c06fe46,
+  0x1c0ca432,
+  0x1c1249d8,
+  0x1c17ef39,
+  0x1c1d9454,
+  0x1c23392b,
+  0x1c28ddbb,
+  0x1c2e8207,
+  0x1c34260c,
+  0x1c39c9cd,
+  0x1c3f6d47,
+  0x1c45107c,
+  0x1c4ab36b,
+  0x1c505614,
+  0x1c55f878,
+  0x1c5b9a95,
+  0x1c613c6d,
+  0x1c66ddfe,
+  0x1c6c7f4a,
+  0x1c72204f,
+  0x1c77c10e,
+  0x1c7d6187,
+  0x1c8301b9,
+  0x1c88a1a6,
+  0x1c8e414b,
+  0x1c93e0ab,
+  0x1c997fc4,
+  0x1c9f1e96,
+  0x1ca4bd21,
+  0x1caa5b66,
+  0x1caff965,
+  0x1cb5971c,
+  0x1cbb348d,
+  0x1cc0d1b6,
+  0x1cc66e99,
+  0x1ccc0b35,
+  0x1cd1a78a,
+  0x1cd74397,
+  0x1cdcdf5e,
+  0x1ce27add,
+  0x1ce81615,
+  0x1cedb106,
+  0x1cf34baf,
+  0x1cf8e611,
+  0x1cfe802b,
+  0x1d0419fe,
+  0x1d09b389,
+  0x1d0f4ccd,
+  0x1d14e5c9,
+  0x1d1a7e7d,
+  0x1d2016e9,
+  0x1d25af0d,
+  0x1d2b46ea,
+  0x1d30de7e,
+  0x1d3675cb,
+  0x1d3c0ccf,
+  0x1d41a38c,
+  0x1d473a00,
+  0x1d4cd02c,
+  0x1d52660f,
+  0x1d57fbaa,
+  0x1d5d90fd,
+  0x1d632608,
+  0x1d68baca,
+  0x1d6e4f43,
+  0x1d73e374,
+  0x1d79775c,
+  0x1d7f0afb,
+  0x1d849e51,
+  0x1d8a315f,
+  0x1d8fc424,
+  0x1d9556a0,
+  0x1d9ae8d2,
+  0x1da07abc,
+  0x1da60c5d,
+  0x1dab9db5,
+  0x1db12ec3,
+  0x1db6bf88,
+  0x1dbc5004,
+  0x1dc1e036,
+  0x1dc7701f,
+  0x1dccffbf,
+  0x1dd28f15,
+  0x1dd81e21,
+  0x1dddace4,
+  0x1de33b5d,
+  0x1de8c98c,
+  0x1dee5771,
+  0x1df3e50d,
+  0x1df9725f,
+  0x1dfeff67,
+  0x1e048c24,
+  0x1e0a1898,
+  0x1e0fa4c2,
+  0x1e1530a1,
+  0x1e1abc36,
+  0x1e204781,
+  0x1e25d282,
+  0x1e2b5d38,
+  0x1e30e7a4,
+  0x1e3671c5,
+  0x1e3bfb9c,
+  0x1e418528,
+  0x1e470e69,
+  0x1e4c9760,
+  0x1e52200c,
+  0x1e57a86d,
+  0x1e5d3084,
+  0x1e62b84f,
+  0x1e683fcf,
+  0x1e6dc705,
+  0x1e734def,
+  0x1e78d48e,
+  0x1e7e5ae2,
+  0x1e83e0eb,
+  0x1e8966a8,
+  0x1e8eec1b,
+  0x1e947141,
+  0x1e99f61d,
+  0x1e9f7aac,
+  0x1ea4fef0,
+  0x1eaa82e9,
+  0x1eb00696,
+  0x1eb589f7,
+  0x1ebb0d0d,
+  0x1ec08fd6,
+  0x1ec61254,
+  0x1ecb9486,
+  0x1ed1166b,
+  0x1ed69805,
+  0x1edc1953,
+  0x1ee19a54,
+  0x1ee71b0a,
+  0x1eec9b73,
+  0x1ef21b90,
+  0x1ef79b60,
+  0x1efd1ae4,
+  0x1f029a1c,
+  0x1f081907,
+  0x1f0d97a5,
+  0x1f1315f7,
+  0x1f1893fc,
+  0x1f1e11b5,
+  0x1f238f20,
+  0x1f290c3f,
+  0x1f2e8911,
+  0x1f340596,
+  0x1f3981ce,
+  0x1f3efdb9,
+  0x1f447957,
+  0x1f49f4a8,
+  0x1f4f6fab,
+  0x1f54ea62,
+  0x1f5a64cb,
+  0x1f5fdee6,
+  0x1f6558b5,
+  0x1f6ad235,
+  0x1f704b69,
+  0x1f75c44e,
+  0x1f7b3ce6,
+  0x1f80b531,
+  0x1f862d2d,
+  0x1f8ba4dc,
+  0x1f911c3d,
+  0x1f969350,
+  0x1f9c0a15,
+  0x1fa1808c,
+  0x1fa6f6b6,
+  0x1fac6c91,
+  0x1fb1e21d,
+  0x1fb7575c,
+  0x1fbccc4d,
+  0x1fc240ef,
+  0x1fc7b542,
+  0x1fcd2948,
+  0x1fd29cff,
+  0x1fd81067,
+  0x1fdd8381,
+  0x1fe2f64c,
+  0x1fe868c8,
+  0x1feddaf6,
+  0x1ff34cd5,
+  0x1ff8be65,
+  0x1ffe2fa6,
+  0x2003a099,
+  0x2009113c,
+  0x200e8190,
+  0x2013f196,
+  0x2019614c,
+  0x201ed0b2,
+  0x20243fca,
+  0x2029ae92,
+  0x202f1d0b,
+  0x20348b35,
+  0x2039f90f,
+  0x203f6699,
+  0x2044d3d4,
+  0x204a40bf,
+  0x204fad5b,
+  0x205519a7,
+  0x205a85a3,
+  0x205ff14f,
+  0x20655cac,
+  0x206ac7b8,
+  0x20703275,
+  0x20759ce1,
+  0x207b06fe,
+  0x208070ca,
+  0x2085da46,
+  0x208b4372,
+  0x2090ac4d,
+  0x209614d9,
+  0x209b7d13,
+  0x20a0e4fe,
+  0x20a64c97,
+  0x20abb3e1,
+  0x20b11ad9,
+  0x20b68181,
+  0x20bbe7d8,
+  0x20c14ddf,
+  0x20c6b395,
+  0x20cc18f9,
+  0x20d17e0d,
+  0x20d6e2d0,
+  0x20dc4742,
+  0x20e1ab63,
+  0x20e70f32,
+  0x20ec72b1,
+  0x20f1d5de,
+  0x20f738ba,
+  0x20fc9b44,
+  0x2101fd7e,
+  0x21075f65,
+  0x210cc0fc,
+  0x21122240,
+  0x21178334,
+  0x211ce3d5,
+  0x21224425,
+  0x2127a423,
+  0x212d03cf,
+  0x21326329,
+  0x2137c232,
+  0x213d20e8,
+  0x21427f4d,
+  0x2147dd5f,
+  0x214d3b1f,
+  0x2152988d,
+  0x2157f5a9,
+  0x215d5273,
+  0x2162aeea,
+  0x21680b0f,
+  0x216d66e2,
+  0x2172c262,
+  0x21781d8f,
+  0x217d786a,
+  0x2182d2f2,
+  0x21882d28,
+  0x218d870b,
+  0x2192e09b,
+  0x219839d8,
+  0x219d92c2,
+  0x21a2eb5a,
+  0x21a8439e,
+  0x21ad9b8f,
+  0x21b2f32e,
+  0x21b84a79,
+  0x21bda171,
+  0x21c2f815,
+  0x21c84e67,
+  0x21cda465,
+  0x21d2fa0f,
+  0x21d84f66,
+  0x21dda46a,
+  0x21e2f91a,
+  0x21e84d76,
+  0x21eda17f,
+  0x21f2f534,
+  0x21f84895,
+  0x21fd9ba3,
+  0x2202ee5d,
+  0x220840c2,
+  0x220d92d4,
+  0x2212e492,
+  0x221835fb,
+  0x221d8711,
+  0x2222d7d2,
+  0x2228283f,
+  0x222d7858,
+  0x2232c81c,
+  0x2238178d,
+  0x223d66a8,
+  0x2242b56f,
+  0x224803e2,
+  0x224d5200,
+  0x22529fca,
+  0x2257ed3e,
+  0x225d3a5e,
+  0x22628729,
+  0x2267d3a0,
+  0x226d1fc1,
+  0x22726b8e,
+  0x2277b705,
+  0x227d0228,
+  0x22824cf5,
+  0x2287976e,
+  0x228ce191,
+  0x22922b5e,
+  0x229774d7,
+  0x229cbdfa,
+  0x22a206c8,
+  0x22a74f40,
+  0x22ac9763,
+  0x22b1df30,
+  0x22b726a8,
+  0x22bc6dca,
+  0x22c1b496,
+  0x22c6fb0c,
+  0x22cc412d,
+  0x22d186f8,
+  0x22d6cc6d,
+  0x22dc118c,
+  0x22e15655,
+  0x22e69ac8,
+  0x22ebdee5,
+  0x22f122ab,
+  0x22f6661c,
+  0x22fba936,
+  0x2300ebf9,
+  0x23062e67,
+  0x230b707e,
+  0x2310b23e,
+  0x2315f3a8,
+  0x231b34bc,
+  0x23207579,
+  0x2325b5df,
+  0x232af5ee,
+  0x233035a7,
+  0x23357509,
+  0x233ab414,
+  0x233ff2c8,
+  0x23453125,
+  0x234a6f2b,
+  0x234facda,
+  0x2354ea32,
+  0x235a2733,
+  0x235f63dc,
+  0x2364a02e,
+  0x2369dc29,
+  0x236f17cc,
+  0x23745318,
+  0x23798e0d,
+  0x237ec8aa,
+  0x238402ef,
+  0x23893cdd,
+  0x238e7673,
+  0x2393afb2,
+  0x2398e898,
+  0x239e2127,
+  0x23a3595e,
+  0x23a8913d,
+  0x23adc8c4,
+  0x23b2fff3,
+  0x23b836ca,
+  0x23bd6d48,
+  0x23c2a36f,
+  0x23c7d93d,
+  0x23cd0eb3,
+  0x23d243d1,
+  0x23d77896,
+  0x23dcad03,
+  0x23e1e117,
+  0x23e714d3,
+  0x23ec4837,
+  0x23f17b41,
+  0x23f6adf3,
+  0x23fbe04c,
+  0x2401124d,
+  0x240643f4,
+  0x240b7543,
+  0x2410a639,
+  0x2415d6d5,
+  0x241b0719,
+  0x24203704,
+  0x24256695,
+  0x242a95ce,
+  0x242fc4ad,
+  0x2434f332,
+  0x243a215f,
+  0x243f4f32,
+  0x24447cac,
+  0x2449a9cc,
+  0x244ed692,
+  0x245402ff,
+  0x24592f13,
+  0x245e5acc,
+  0x2463862c,
+  0x2468b132,
+  0x246ddbdf,
+  0x24730631,
+  0x2478302a,
+  0x247d59c8,
+  0x2482830d,
+  0x2487abf7,
+  0x248cd487,
+  0x2491fcbe,
+  0x24972499,
+  0x249c4c1b,
+  0x24a17342,
+  0x24a69a0f,
+  0x24abc082,
+  0x24b0e699,
+  0x24b60c57,
+  0x24bb31ba,
+  0x24c056c2,
+  0x24c57b6f,
+  0x24ca9fc2,
+  0x24cfc3ba,
+  0x24d4e757,
+  0x24da0a9a,
+  0x24df2d81,
+  0x24e4500e,
+  0x24e9723f,
+  0x24ee9415,
+  0x24f3b590,
+  0x24f8d6b0,
+  0x24fdf775,
+  0x250317df,
+  0x250837ed,
+  0x250d57a0,
+  0x251276f7,
+  0x251795f3,
+  0x251cb493,
+  0x2521d2d8,
+  0x2526f0c1,
+  0x252c0e4f,
+  0x25312b81,
+  0x25364857,
+  0x253b64d1,
+  0x254080ef,
+  0x25459cb2,
+  0x254ab818,
+  0x254fd323,
+  0x2554edd1,
+  0x255a0823,
+  0x255f2219,
+  0x25643bb3,
+  0x256954f1,
+  0x256e6dd2,
+  0x25738657,
+  0x25789e80,
+  0x257db64c,
+  0x2582cdbc,
+  0x2587e4cf,
+  0x258cfb85,
+  0x259211df,
+  0x259727dc,
+  0x259c3d7c,
+  0x25a152c0,
+  0x25a667a7,
+  0x25ab7c30,
+  0x25b0905d,
+  0x25b5a42d,
+  0x25bab7a0,
+  0x25bfcab6,
+  0x25c4dd6e,
+  0x25c9efca,
+  0x25cf01c8,
+  0x25d41369,
+  0x25d924ac,
+  0x25de3592,
+  0x25e3461b,
+  0x25e85646,
+  0x25ed6614,
+  0x25f27584,
+  0x25f78497,
+  0x25fc934b,
+  0x2601a1a2,
+  0x2606af9c,
+  0x260bbd37,
+  0x2610ca75,
+  0x2615d754,
+  0x261ae3d6,
+  0x261feffa,
+  0x2624fbbf,
+  0x262a0727,
+  0x262f1230,
+  0x26341cdb,
+  0x26392728,
+  0x263e3117,
+  0x26433aa7,
+  0x264843d9,
+  0x264d4cac,
+  0x26525521,
+  0x26575d37,
+  0x265c64ef,
+  0x26616c48,
+  0x26667342,
+  0x266b79dd,
+  0x2670801a,
+  0x267585f8,
+  0x267a8b77,
+  0x267f9097,
+  0x26849558,
+  0x268999ba,
+  0x268e9dbd,
+  0x2693a161,
+  0x2698a4a6,
+  0x269da78b,
+  0x26a2aa11,
+  0x26a7ac38,
+  0x26acadff,
+  0x26b1af67,
+  0x26b6b070,
+  0x26bbb119,
+  0x26c0b162,
+  0x26c5b14c,
+  0x26cab0d6,
+  0x26cfb000,
+  0x26d4aecb,
+  0x26d9ad36,
+  0x26deab41,
+  0x26e3a8ec,
+  0x26e8a637,
+  0x26eda322,
+  0x26f29fad,
+  0x26f79bd8,
+  0x26fc97a3,
+  0x2701930e,
+  0x27068e18,
+  0x270b88c2,
+  0x2710830c,
+  0x27157cf5,
+  0x271a767e,
+  0x271f6fa6,
+  0x2724686e,
+  0x272960d6,
+  0x272e58dc,
+  0x27335082,
+  0x273847c8,
+  0x273d3eac,
+  0x27423530,
+  0x27472b53,
+  0x274c2115,
+  0x27511676,
+  0x27560b76,
+  0x275b0014,
+  0x275ff452,
+  0x2764e82f,
+  0x2769dbaa,
+  0x276ecec5,
+  0x2773c17d,
+  0x2778b3d5,
+  0x277da5cb,
+  0x27829760,
+  0x27878893,
+  0x278c7965,
+  0x279169d5,
+  0x279659e3,
+  0x279b4990,
+  0x27a038db,
+  0x27a527c4,
+  0x27aa164c,
+  0x27af0472,
+  0x27b3f235,
+  0x27b8df97,
+  0x27bdcc97,
+  0x27c2b934,
+  0x27c7a570,
+  0x27cc9149,
+  0x27d17cc1,
+  0x27d667d5,
+  0x27db5288,
+  0x27e03cd8,
+  0x27e526c6,
+  0x27ea1052,
+  0x27eef97b,
+  0x27f3e241,
+  0x27f8caa5,
+  0x27fdb2a7,
+  0x28029a45,
+  0x28078181,
+  0x280c685a,
+  0x28114ed0,
+  0x281634e4,
+  0x281b1a94,
+  0x281fffe2,
+  0x2824e4cc,
+  0x2829c954,
+  0x282ead78,
+  0x2833913a,
+  0x28387498,
+  0x283d5793,
+  0x28423a2a,
+  0x28471c5e,
+  0x284bfe2f,
+  0x2850df9d,
+  0x2855c0a6,
+  0x285aa14d,
+  0x285f8190,
+  0x2864616f,
+  0x286940ea,
+  0x286e2002,
+  0x2872feb6,
+  0x2877dd07,
+  0x287cbaf3,
+  0x2881987c,
+  0x288675a0,
+  0x288b5261,
+  0x28902ebd,
+  0x28950ab6,
+  0x2899e64a,
+  0x289ec17a,
+  0x28a39c46,
+  0x28a876ae,
+  0x28ad50b1,
+  0x28b22a50,
+  0x28b7038b,
+  0x28bbdc61,
+  0x28c0b4d2,
+  0x28c58cdf,
+  0x28ca6488,
+  0x28cf3bcc,
+  0x28d412ab,
+  0x28d8e925,
+  0x28ddbf3b,
+  0x28e294eb,
+  0x28e76a37,
+  0x28ec3f1e,
+  0x28f113a0,
+  0x28f5e7bd,
+  0x28fabb75,
+  0x28ff8ec8,
+  0x290461b5,
+  0x2909343e,
+  0x290e0661,
+  0x2912d81f,
+  0x2917a977,
+  0x291c7a6a,
+  0x29214af8,
+  0x29261b20,
+  0x292aeae3,
+  0x292fba40,
+  0x29348937,
+  0x293957c9,
+  0x293e25f5,
+  0x2942f3bb,
+  0x2947c11c,
+  0x294c8e16,
+  0x29515aab,
+  0x295626da,
+  0x295af2a3,
+  0x295fbe06,
+  0x29648902,
+  0x29695399,
+  0x296e1dc9,
+  0x2972e793,
+  0x2977b0f7,
+  0x297c79f5,
+  0x2981428c,
+  0x29860abd,
+  0x298ad287,
+  0x298f99eb,
+  0x299460e8,
+  0x2999277f,
+  0x299dedaf,
+  0x29a2b378,
+  0x29a778db,
+  0x29ac3dd7,
+  0x29b1026c,
+  0x29b5c69a,
+  0x29ba8a61,
+  0x29bf4dc1,
+  0x29c410ba,
+  0x29c8d34d,
+  0x29cd9578,
+  0x29d2573c,
+  0x29d71899,
+  0x29dbd98e,
+  0x29e09a1c,
+  0x29e55a43,
+  0x29ea1a03,
+  0x29eed95b,
+  0x29f3984c,
+  0x29f856d5,
+  0x29fd14f6,
+  0x2a01d2b0,
+  0x2a069003,
+  0x2a0b4ced,
+  0x2a100970,
+  0x2a14c58b,
+  0x2a19813f,
+  0x2a1e3c8a,
+  0x2a22f76e,
+  0x2a27b1e9,
+  0x2a2c6bfd,
+  0x2a3125a8,
+  0x2a35deeb,
+  0x2a3a97c7,
+  0x2a3f503a,
+  0x2a440844,
+  0x2a48bfe7,
+  0x2a4d7721,
+  0x2a522df3,
+  0x2a56e45c,
+  0x2a5b9a5d,
+  0x2a604ff5,
+  0x2a650525,
+  0x2a69b9ec,
+  0x2a6e6e4b,
+  0x2a732241,
+  0x2a77d5ce,
+  0x2a7c88f2,
+  0x2a813bae,
+  0x2a85ee00,
+  0x2a8a9fea,
+  0x2a8f516b,
+  0x2a940283,
+  0x2a98b331,
+  0x2a9d6377,
+  0x2aa21353,
+  0x2aa6c2c6,
+  0x2aab71d0,
+  0x2ab02071,
+  0x2ab4cea9,
+  0x2ab97c77,
+  0x2abe29db,
+  0x2ac2d6d6,
+  0x2ac78368,
+  0x2acc2f90,
+  0x2ad0db4e,
+  0x2ad586a3,
+  0x2ada318e,
+  0x2adedc10,
+  0x2ae38627,
+  0x2ae82fd5,
+  0x2aecd919,
+  0x2af181f3,
+  0x2af62a63,
+  0x2afad269,
+  0x2aff7a05,
+  0x2b042137,
+  0x2b08c7ff,
+  0x2b0d6e5c,
+  0x2b121450,
+  0x2b16b9d9,
+  0x2b1b5ef8,
+  0x2b2003ac,
+  0x2b24a7f6,
+  0x2b294bd5,
+  0x2b2def4b,
+  0x2b329255,
+  0x2b3734f5,
+  0x2b3bd72a,
+  0x2b4078f5,
+  0x2b451a55,
+  0x2b49bb4a,
+  0x2b4e5bd4,
+  0x2b52fbf4,
+  0x2b579ba8,
+  0x2b5c3af2,
+  0x2b60d9d0,
+  0x2b657844,
+  0x2b6a164d,
+  0x2b6eb3ea,
+  0x2b73511c,
+  0x2b77ede3,
+  0x2b7c8a3f,
+  0x2b812630,
+  0x2b85c1b5,
+  0x2b8a5cce,
+  0x2b8ef77d,
+  0x2b9391c0,
+  0x2b982b97,
+  0x2b9cc503,
+  0x2ba15e03,
+  0x2ba5f697,
+  0x2baa8ec0,
+  0x2baf267d,
+  0x2bb3bdce,
+  0x2bb854b4,
+  0x2bbceb2d,
+  0x2bc1813b,
+  0x2bc616dd,
+  0x2bcaac12,
+  0x2bcf40dc,
+  0x2bd3d53a,
+  0x2bd8692b,
+  0x2bdcfcb0,
+  0x2be18fc9,
+  0x2be62276,
+  0x2beab4b6,
+  0x2bef468a,
+  0x2bf3d7f2,
+  0x2bf868ed,
+  0x2bfcf97c,
+  0x2c01899e,
+  0x2c061953,
+  0x2c0aa89c,
+  0x2c0f3779,
+  0x2c13c5e8,
+  0x2c1853eb,
+  0x2c1ce181,
+  0x2c216eaa,
+  0x2c25fb66,
+  0x2c2a87b6,
+  0x2c2f1398,
+  0x2c339f0e,
+  0x2c382a16,
+  0x2c3cb4b1,
+  0x2c413edf,
+  0x2c45c8a0,
+  0x2c4a51f3,
+  0x2c4edada,
+  0x2c536353,
+  0x2c57eb5e,
+  0x2c5c72fd,
+  0x2c60fa2d,
+  0x2c6580f1,
+  0x2c6a0746,
+  0x2c6e8d2e,
+  0x2c7312a9,
+  0x2c7797b6,
+  0x2c7c1c55,
+  0x2c80a086,
+  0x2c85244a,
+  0x2c89a79f,
+  0x2c8e2a87,
+  0x2c92ad01,
+  0x2c972f0d,
+  0x2c9bb0ab,
+  0x2ca031da,
+  0x2ca4b29c,
+  0x2ca932ef,
+  0x2cadb2d5,
+  0x2cb2324c,
+  0x2cb6b155,
+  0x2cbb2fef,
+  0x2cbfae1b,
+  0x2cc42bd9,
+  0x2cc8a928,
+  0x2ccd2609,
+  0x2cd1a27b,
+  0x2cd61e7f,
+  0x2cda9a14,
+  0x2cdf153a,
+  0x2ce38ff1,
+  0x2ce80a3a,
+  0x2cec8414,
+  0x2cf0fd80,
+  0x2cf5767c,
+  0x2cf9ef09,
+  0x2cfe6728,
+  0x2d02ded7,
+  0x2d075617,
+  0x2d0bcce8,
+  0x2d10434a,
+  0x2d14b93d,
+  0x2d192ec1,
+  0x2d1da3d5,
+  0x2d22187a,
+  0x2d268cb0,
+  0x2d2b0076,
+  0x2d2f73cd,
+  0x2d33e6b4,
+  0x2d38592c,
+  0x2d3ccb34,
+  0x2d413ccd,
+  0x2d45adf6,
+  0x2d4a1eaf,
+  0x2d4e8ef9,
+  0x2d52fed2,
+  0x2d576e3c,
+  0x2d5bdd36,
+  0x2d604bc0,
+  0x2d64b9da,
+  0x2d692784,
+  0x2d6d94bf,
+  0x2d720189,
+  0x2d766de2,
+  0x2d7ad9cc,
+  0x2d7f4545,
+  0x2d83b04f,
+  0x2d881ae8,
+  0x2d8c8510,
+  0x2d90eec8,
+  0x2d955810,
+  0x2d99c0e7,
+  0x2d9e294e,
+  0x2da29144,
+  0x2da6f8ca,
+  0x2dab5fdf,
+  0x2dafc683,
+  0x2db42cb6,
+  0x2db89279,
+  0x2dbcf7cb,
+  0x2dc15cac,
+  0x2dc5c11c,
+  0x2dca251c,
+  0x2dce88aa,
+  0x2dd2ebc7,
+  0x2dd74e73,
+  0x2ddbb0ae,
+  0x2de01278,
+  0x2de473d1,
+  0x2de8d4b8,
+  0x2ded352f,
+  0x2df19534,
+  0x2df5f4c7,
+  0x2dfa53e9,
+  0x2dfeb29a,
+  0x2e0310d9,
+  0x2e076ea7,
+  0x2e0bcc03,
+  0x2e1028ed,
+  0x2e148566,
+  0x2e18e16d,
+  0x2e1d3d03,
+  0x2e219826,
+  0x2e25f2d8,
+  0x2e2a4d18,
+  0x2e2ea6e6,
+  0x2e330042,
+  0x2e37592c,
+  0x2e3bb1a4,
+  0x2e4009aa,
+  0x2e44613e,
+  0x2e48b860,
+  0x2e4d0f0f,
+  0x2e51654c,
+  0x2e55bb17,
+  0x2e5a1070,
+  0x2e5e6556,
+  0x2e62b9ca,
+  0x2e670dcb,
+  0x2e6b615a,
+  0x2e6fb477,
+  0x2e740720,
+  0x2e785958,
+  0x2e7cab1c,
+  0x2e80fc6e,
+  0x2e854d4d,
+  0x2e899db9,
+  0x2e8dedb3,
+  0x2e923d39,
+  0x2e968c4d,
+  0x2e9adaee,
+  0x2e9f291b,
+  0x2ea376d6,
+  0x2ea7c41e,
+  0x2eac10f2,
+  0x2eb05d53,
+  0x2eb4a942,
+  0x2eb8f4bc,
+  0x2ebd3fc4,
+  0x2ec18a58,
+  0x2ec5d479,
+  0x2eca1e27,
+  0x2ece6761,
+  0x2ed2b027,
+  0x2ed6f87a,
+  0x2edb405a,
+  0x2edf87c6,
+  0x2ee3cebe,
+  0x2ee81543,
+  0x2eec5b53,
+  0x2ef0a0f0,
+  0x2ef4e619,
+  0x2ef92acf,
+  0x2efd6f10,
+  0x2f01b2de,
+  0x2f05f637,
+  0x2f0a391d,
+  0x2f0e7b8e,
+  0x2f12bd8b,
+  0x2f16ff14,
+  0x2f1b4029,
+  0x2f1f80ca,
+  0x2f23c0f6,
+  0x2f2800af,
+  0x2f2c3ff2,
+  0x2f307ec2,
+  0x2f34bd1d,
+  0x2f38fb03,
+  0x2f3d3875,
+  0x2f417573,
+  0x2f45b1fb,
+  0x2f49ee0f,
+  0x2f4e29af,
+  0x2f5264da,
+  0x2f569f90,
+  0x2f5ad9d1,
+  0x2f5f139d,
+  0x2f634cf5,
+  0x2f6785d7,
+  0x2f6bbe45,
+  0x2f6ff63d,
+  0x2f742dc1,
+  0x2f7864cf,
+  0x2f7c9b69,
+  0x2f80d18d,
+  0x2f85073c,
+  0x2f893c75,
+  0x2f8d713a,
+  0x2f91a589,
+  0x2f95d963,
+  0x2f9a0cc7,
+  0x2f9e3fb6,
+  0x2fa2722f,
+  0x2fa6a433,
+  0x2faad5c1,
+  0x2faf06da,
+  0x2fb3377c,
+  0x2fb767aa,
+  0x2fbb9761,
+  0x2fbfc6a3,
+  0x2fc3f56f,
+  0x2fc823c5,
+  0x2fcc51a5,
+  0x2fd07f0f,
+  0x2fd4ac04,
+  0x2fd8d882,
+  0x2fdd048a,
+  0x2fe1301c,
+  0x2fe55b38,
+  0x2fe985de,
+  0x2fedb00d,
+  0x2ff1d9c7,
+  0x2ff6030a,
+  0x2ffa2bd6,
+  0x2ffe542d,
+  0x30027c0c,
+  0x3006a376,
+  0x300aca69,
+  0x300ef0e5,
+  0x301316eb,
+  0x30173c7a,
+  0x301b6193,
+  0x301f8634,
+  0x3023aa5f,
+  0x3027ce14,
+  0x302bf151,
+  0x30301418,
+  0x30343667,
+  0x30385840,
+  0x303c79a2,
+  0x30409a8d,
+  0x3044bb00,
+  0x3048dafd,
+  0x304cfa83,
+  0x30511991,
+  0x30553828,
+  0x30595648,
+  0x305d73f0,
+  0x30619121,
+  0x3065addb,
+  0x3069ca1e,
+  0x306de5e9,
+  0x3072013c,
+  0x30761c18,
+  0x307a367c,
+  0x307e5069,
+  0x308269de,
+  0x308682dc,
+  0x308a9b61,
+  0x308eb36f,
+  0x3092cb05,
+  0x3096e223,
+  0x309af8ca,
+  0x309f0ef8,
+  0x30a324af,
+  0x30a739ed,
+  0x30ab4eb3,
+  0x30af6302,
+  0x30b376d8,
+  0x30b78a36,
+  0x30bb9d1c,
+  0x30bfaf89,
+  0x30c3c17e,
+  0x30c7d2fb,
+  0x30cbe400,
+  0x30cff48c,
+  0x30d404a0,
+  0x30d8143b,
+  0x30dc235e,
+  0x30e03208,
+  0x30e4403a,
+  0x30e84df3,
+  0x30ec5b33,
+  0x30f067fb,
+  0x30f47449,
+  0x30f8801f,
+  0x30fc8b7d,
+  0x31009661,
+  0x3104a0cc,
+  0x3108aabf,
+  0x310cb438,
+  0x3110bd39,
+  0x3114c5c0,
+  0x3118cdcf,
+  0x311cd564,
+  0x3120dc80,
+  0x3124e322,
+  0x3128e94c,
+  0x312ceefc,
+  0x3130f433,
+  0x3134f8f1,
+  0x3138fd35,
+  0x313d00ff,
+  0x31410450,
+  0x31450728,
+  0x31490986,
+  0x314d0b6a,
+  0x31510cd5,
+  0x31550dc6,
+  0x31590e3e,
+  0x315d0e3b,
+  0x31610dbf,
+  0x31650cc9,
+  0x31690b59,
+  0x316d096f,
+  0x3171070c,
+  0x3175042e,
+  0x317900d6,
+  0x317cfd04,
+  0x3180f8b8,
+  0x3184f3f2,
+  0x3188eeb2,
+  0x318ce8f7,
+  0x3190e2c3,
+  0x3194dc14,
+  0x3198d4ea,
+  0x319ccd46,
+  0x31a0c528,
+  0x31a4bc90,
+  0x31a8b37c,
+  0x31aca9ef,
+  0x31b09fe7,
+  0x31b49564,
+  0x31b88a66,
+  0x31bc7eee,
+  0x31c072fb,
+  0x31c4668d,
+  0x31c859a5,
+  0x31cc4c42,
+  0x31d03e64,
+  0x31d4300b,
+  0x31d82137,
+  0x31dc11e8,
+  0x31e0021e,
+  0x31e3f1d8,
+  0x31e7e118,
+  0x31ebcfdd,
+  0x31efbe27,
+  0x31f3abf5,
+  0x31f79948,
+  0x31fb8620,
+  0x31ff727c,
+  0x32035e5d,
+  0x320749c3,
+  0x320b34ad,
+  0x320f1f1c,
+  0x3213090f,
+  0x3216f287,
+  0x321adb83,
+  0x321ec403,
+  0x3222ac08,
+  0x32269391,
+  0x322a7a9e,
+  0x322e6130,
+  0x32324746,
+  0x32362ce0,
+  0x323a11fe,
+  0x323df6a0,
+  0x3241dac6,
+  0x3245be70,
+  0x3249a19e,
+  0x324d8450,
+  0x32516686,
+  0x32554840,
+  0x3259297d,
+  0x325d0a3e,
+  0x3260ea83,
+  0x3264ca4c,
+  0x3268a998,
+  0x326c8868,
+  0x327066bc,
+  0x32744493,
+  0x327821ee,
+  0x327bfecc,
+  0x327fdb2d,
+  0x3283b712,
+  0x3287927b,
+  0x328b6d66,
+  0x328f47d5,
+  0x329321c7,
+  0x3296fb3d,
+  0x329ad435,
+  0x329eacb1,
+  0x32a284b0,
+  0x32a65c32,
+  0x32aa3336,
+  0x32ae09be,
+  0x32b1dfc9,
+  0x32b5b557,
+  0x32b98a67,
+  0x32bd5efb,
+  0x32c13311,
+  0x32c506aa,
+  0x32c8d9c6,
+  0x32ccac64,
+  0x32d07e85,
+  0x32d45029,
+  0x32d82150,
+  0x32dbf1f8,
+  0x32dfc224,
+  0x32e391d2,
+  0x32e76102,
+  0x32eb2fb5,
+  0x32eefdea,
+  0x32f2cba1,
+  0x32f698db,
+  0x32fa6596,
+  0x32fe31d5,
+  0x3301fd95,
+  0x3305c8d7,
+  0x3309939c,
+  0x330d5de3,
+  0x331127ab,
+  0x3314f0f6,
+  0x3318b9c2,
+  0x331c8211,
+  0x332049e1,
+  0x33241134,
+  0x3327d808,
+  0x332b9e5e,
+  0x332f6435,
+  0x3333298f,
+  0x3336ee6a,
+  0x333ab2c6,
+  0x333e76a4,
+  0x33423a04,
+  0x3345fce6,
+  0x3349bf48,
+  0x334d812d,
+  0x33514292,
+  0x33550379,
+  0x3358c3e2,
+  0x335c83cb,
+  0x33604336,
+  0x33640223,
+  0x3367c090,
+  0x336b7e7e,
+  0x336f3bee,
+  0x3372f8df,
+  0x3376b551,
+  0x337a7144,
+  0x337e2cb7,
+  0x3381e7ac,
+  0x3385a222,
+  0x33895c18,
+  0x338d1590,
+  0x3390ce88,
+  0x33948701,
+  0x33983efb,
+  0x339bf675,
+  0x339fad70,
+  0x33a363ec,
+  0x33a719e8,
+  0x33aacf65,
+  0x33ae8462,
+  0x33b238e0,
+  0x33b5ecde,
+  0x33b9a05d,
+  0x33bd535c,
+  0x33c105db,
+  0x33c4b7db,
+  0x33c8695b,
+  0x33cc1a5b,
+  0x33cfcadc,
+  0x33d37adc,
+  0x33d72a5d,
+  0x33dad95e,
+  0x33de87de,
+  0x33e235df,
+  0x33e5e360,
+  0x33e99061,
+  0x33ed3ce1,
+  0x33f0e8e2,
+  0x33f49462,
+  0x33f83f62,
+  0x33fbe9e2,
+  0x33ff93e2,
+  0x34033d61,
+  0x3406e660,
+  0x340a8edf,
+  0x340e36dd,
+  0x3411de5b,
+  0x34158559,
+  0x34192bd5,
+  0x341cd1d2,
+  0x3420774d,
+  0x34241c49,
+  0x3427c0c3,
+  0x342b64bd,
+  0x342f0836,
+  0x3432ab2e,
+  0x34364da6,
+  0x3439ef9c,
+  0x343d9112,
+  0x34413207,
+  0x3444d27b,
+  0x3448726e,
+  0x344c11e0,
+  0x344fb0d1,
+  0x34534f41,
+  0x3456ed2f,
+  0x345a8a9d,
+  0x345e2789,
+  0x3461c3f5,
+  0x34655fdf,
+  0x3468fb47,
+  0x346c962f,
+  0x34703095,
+  0x3473ca79,
+  0x347763dd,
+  0x347afcbe,
+  0x347e951f,
+  0x34822cfd,
+  0x3485c45b,
+  0x34895b36,
+  0x348cf190,
+  0x34908768,
+  0x34941cbf,
+  0x3497b194,
+  0x349b45e7,
+  0x349ed9b8,
+  0x34a26d08,
+  0x34a5ffd5,
+  0x34a99221,
+  0x34ad23eb,
+  0x34b0b533,
+  0x34b445f8,
+  0x34b7d63c,
+  0x34bb65fe,
+  0x34bef53d,
+  0x34c283fb,
+  0x34c61236,
+  0x34c99fef,
+  0x34cd2d26,
+  0x34d0b9da,
+  0x34d4460c,
+  0x34d7d1bc,
+  0x34db5cea,
+  0x34dee795,
+  0x34e271bd,
+  0x34e5fb63,
+  0x34e98487,
+  0x34ed0d28,
+  0x34f09546,
+  0x34f41ce2,
+  0x34f7a3fb,
+  0x34fb2a92,
+  0x34feb0a5,
+  0x35023636,
+  0x3505bb44,
+  0x35093fd0,
+  0x350cc3d8,
+  0x3510475e,
+  0x3513ca60,
+  0x35174ce0,
+  0x351acedd,
+  0x351e5056,
+  0x3521d14d,
+  0x352551c0,
+  0x3528d1b1,
+  0x352c511e,
+  0x352fd008,
+  0x35334e6f,
+  0x3536cc52,
+  0x353a49b2,
+  0x353dc68f,
+  0x354142e9,
+  0x3544bebf,
+  0x35483a11,
+  0x354bb4e1,
+  0x354f2f2c,
+  0x3552a8f4,
+  0x35562239,
+  0x35599afa,
+  0x355d1337,
+  0x35608af1,
+  0x35640227,
+  0x356778d9,
+  0x356aef08,
+  0x356e64b2,
+  0x3571d9d9,
+  0x35754e7c,
+  0x3578c29b,
+  0x357c3636,
+  0x357fa94d,
+  0x35831be0,
+  0x35868def,
+  0x3589ff7a,
+  0x358d7081,
+  0x3590e104,
+  0x35945103,
+  0x3597c07d,
+  0x359b2f73,
+  0x359e9de5,
+  0x35a20bd3,
+  0x35a5793c,
+  0x35a8e621,
+  0x35ac5282,
+  0x35afbe5e,
+  0x35b329b5,
+  0x35b69489,
+  0x35b9fed7,
+  0x35bd68a1,
+  0x35c0d1e7,
+  0x35c43aa7,
+  0x35c7a2e3,
+  0x35cb0a9b,
+  0x35ce71ce,
+  0x35d1d87c,
+  0x35d53ea5,
+  0x35d8a449,
+  0x35dc0968,
+  0x35df6e03,
+  0x35e2d219,
+  0x35e635a9,
+  0x35e998b5,
+  0x35ecfb3c,
+  0x35f05d3d,
+  0x35f3beba,
+  0x35f71fb1,
+  0x35fa8023,
+  0x35fde011,
+  0x36013f78,
+  0x36049e5b,
+  0x3607fcb8,
+  0x360b5a90,
+  0x360eb7e3,
+  0x361214b0,
+  0x361570f8,
+  0x3618ccba,
+  0x361c27f7,
+  0x361f82af,
+  0x3622dce1,
+  0x3626368d,
+  0x36298fb4,
+  0x362ce855,
+  0x36304070,
+  0x36339806,
+  0x3636ef16,
+  0x363a45a0,
+  0x363d9ba4,
+  0x3640f123,
+  0x3644461b,
+  0x36479a8e,
+  0x364aee7b,
+  0x364e41e2,
+  0x365194c3,
+  0x3654e71d,
+  0x365838f2,
+  0x365b8a41,
+  0x365edb09,
+  0x36622b4c,
+  0x36657b08,
+  0x3668ca3e,
+  0x366c18ee,
+  0x366f6717,
+  0x3672b4bb,
+  0x367601d7,
+  0x36794e6e,
+  0x367c9a7e,
+  0x367fe608,
+  0x3683310b,
+  0x36867b87,
+  0x3689c57d,
+  0x368d0eed,
+  0x369057d6,
+  0x3693a038,
+  0x3696e814,
+  0x369a2f69,
+  0x369d7637,
+  0x36a0bc7e,
+  0x36a4023f,
+  0x36a74779,
+  0x36aa8c2c,
+  0x36add058,
+  0x36b113fd,
+  0x36b4571b,
+  0x36b799b3,
+  0x36badbc3,
+  0x36be1d4c,
+  0x36c15e4e,
+  0x36c49ec9,
+  0x36c7debd,
+  0x36cb1e2a,
+  0x36ce5d10,
+  0x36d19b6e,
+  0x36d4d945,
+  0x36d81695,
+  0x36db535d,
+  0x36de8f9e,
+  0x36e1cb58,
+  0x36e5068a,
+  0x36e84135,
+  0x36eb7b58,
+  0x36eeb4f4,
+  0x36f1ee09,
+  0x36f52695,
+  0x36f85e9a,
+  0x36fb9618,
+  0x36fecd0e,
+  0x3702037c,
+  0x37053962,
+  0x37086ec1,
+  0x370ba398,
+  0x370ed7e7,
+  0x37120bae,
+  0x37153eee,
+  0x371871a5,
+  0x371ba3d4,
+  0x371ed57c,
+  0x3722069b,
+  0x37253733,
+  0x37286742,
+  0x372b96ca,
+  0x372ec5c9,
+  0x3731f440,
+  0x3735222f,
+  0x37384f95,
+  0x373b7c73,
+  0x373ea8ca,
+  0x3741d497,
+  0x3744ffdd,
+  0x37482a9a,
+  0x374b54ce,
+  0x374e7e7b,
+  0x3751a79e,
+  0x3754d03a,
+  0x3757f84c,
+  0x375b1fd7,
+  0x375e46d8,
+  0x37616d51,
+  0x37649341,
+  0x3767b8a9,
+  0x376add88,
+  0x376e01de,
+  0x377125ac,
+  0x377448f0,
+  0x37776bac,
+  0x377a8ddf,
+  0x377daf89,
+  0x3780d0aa,
+  0x3783f143,
+  0x37871152,
+  0x378a30d8,
+  0x378d4fd5,
+  0x37906e49,
+  0x37938c34,
+  0x3796a996,
+  0x3799c66f,
+  0x379ce2be,
+  0x379ffe85,
+  0x37a319c2,
+  0x37a63476,
+  0x37a94ea0,
+  0x37ac6841,
+  0x37af8159,
+  0x37b299e7,
+  0x37b5b1ec,
+  0x37b8c968,
+  0x37bbe05a,
+  0x37bef6c2,
+  0x37c20ca1,
+  0x37c521f6,
+  0x37c836c2,
+  0x37cb4b04,
+  0x37ce5ebd,
+  0x37d171eb,
+  0x37d48490,
+  0x37d796ac,
+  0x37daa83d,
+  0x37ddb945,
+  0x37e0c9c3,
+  0x37e3d9b7,
+  0x37e6e921,
+  0x37e9f801,
+  0x37ed0657,
+  0x37f01423,
+  0x37f32165,
+  0x37f62e1d,
+  0x37f93a4b,
+  0x37fc45ef,
+  0x37ff5109,
+  0x38025b98,
+  0x3805659e,
+  0x38086f19,
+  0x380b780a,
+  0x380e8071,
+  0x3811884d,
+  0x38148f9f,
+  0x38179666,
+  0x381a9ca4,
+  0x381da256,
+  0x3820a77f,
+  0x3823ac1d,
+  0x3826b030,
+  0x3829b3b9,
+  0x382cb6b7,
+  0x382fb92a,
+  0x3832bb13,
+  0x3835bc71,
+  0x3838bd45,
+  0x383bbd8e,
+  0x383ebd4c,
+  0x3841bc7f,
+  0x3844bb28,
+  0x3847b946,
+  0x384ab6d8,
+  0x384db3e0,
+  0x3850b05d,
+  0x3853ac4f,
+  0x3856a7b6,
+  0x3859a292,
+  0x385c9ce3,
+  0x385f96a9,
+  0x38628fe4,
+  0x38658894,
+  0x386880b8,
+  0x386b7852,
+  0x386e6f60,
+  0x387165e3,
+  0x38745bdb,
+  0x38775147,
+  0x387a4628,
+  0x387d3a7e,
+  0x38802e48,
+  0x38832187,
+  0x3886143b,
+  0x38890663,
+  0x388bf7ff,
+  0x388ee910,
+  0x3891d995,
+  0x3894c98f,
+  0x3897b8fe,
+  0x389aa7e0,
+  0x389d9637,
+  0x38a08402,
+  0x38a37142,
+  0x38a65df6,
+  0x38a94a1e,
+  0x38ac35ba,
+  0x38af20ca,
+  0x38b20b4f,
+  0x38b4f547,
+  0x38b7deb4,
+  0x38bac795,
+  0x38bdafea,
+  0x38c097b2,
+  0x38c37eef,
+  0x38c665a0,
+  0x38c94bc4,
+  0x38cc315d,
+  0x38cf1669,
+  0x38d1fae9,
+  0x38d4dedd,
+  0x38d7c245,
+  0x38daa520,
+  0x38dd8770,
+  0x38e06932,
+  0x38e34a69,
+  0x38e62b13,
+  0x38e90b31,
+  0x38ebeac2,
+  0x38eec9c7,
+  0x38f1a840,
+  0x38f4862c,
+  0x38f7638b,
+  0x38fa405e,
+  0x38fd1ca4,
+  0x38fff85e,
+  0x3902d38b,
+  0x3905ae2b,
+  0x3908883f,
+  0x390b61c6,
+  0x390e3ac0,
+  0x3911132d,
+  0x3913eb0e,
+  0x3916c262,
+  0x39199929,
+  0x391c6f63,
+  0x391f4510,
+  0x39221a30,
+  0x3924eec3,
+  0x3927c2c9,
+  0x392a9642,
+  0x392d692f,
+  0x39303b8e,
+  0x39330d5f,
+  0x3935dea4,
+  0x3938af5c,
+  0x393b7f86,
+  0x393e4f23,
+  0x39411e33,
+  0x3943ecb6,
+  0x3946baac,
+  0x39498814,
+  0x394c54ee,
+  0x394f213c,
+  0x3951ecfc,
+  0x3954b82e,
+  0x395782d3,
+  0x395a4ceb,
+  0x395d1675,
+  0x395fdf71,
+  0x3962a7e0,
+  0x39656fc2,
+  0x39683715,
+  0x396afddc,
+  0x396dc414,
+  0x397089bf,
+  0x39734edc,
+  0x3976136b,
+  0x3978d76c,
+  0x397b9ae0,
+  0x397e5dc6,
+  0x3981201e,
+  0x3983e1e8,
+  0x3986a324,
+  0x398963d2,
+  0x398c23f3,
+  0x398ee385,
+  0x3991a289,
+  0x399460ff,
+  0x39971ee7,
+  0x3999dc42,
+  0x399c990d,
+  0x399f554b,
+  0x39a210fb,
+  0x39a4cc1c,
+  0x39a786af,
+  0x39aa40b4,
+  0x39acfa2b,
+  0x39afb313,
+  0x39b26b6d,
+  0x39b52339,
+  0x39b7da76,
+  0x39ba9125,
+  0x39bd4745,
+  0x39bffcd7,
+  0x39c2b1da,
+  0x39c5664f,
+  0x39c81a36,
+  0x39cacd8d,
+  0x39cd8056,
+  0x39d03291,
+  0x39d2e43d,
+  0x39d5955a,
+  0x39d845e9,
+  0x39daf5e8,
+  0x39dda55a,
+  0x39e0543c,
+  0x39e3028f,
+  0x39e5b054,
+  0x39e85d8a,
+  0x39eb0a31,
+  0x39edb649,
+  0x39f061d2,
+  0x39f30ccc,
+  0x39f5b737,
+  0x39f86113,
+  0x39fb0a60,
+  0x39fdb31e,
+  0x3a005b4d,
+  0x3a0302ed,
+  0x3a05a9fd,
+  0x3a08507f,
+  0x3a0af671,
+  0x3a0d9bd4,
+  0x3a1040a8,
+  0x3a12e4ed,
+  0x3a1588a2,
+  0x3a182bc8,
+  0x3a1ace5f,
+  0x3a1d7066,
+  0x3a2011de,
+  0x3a22b2c6,
+  0x3a25531f,
+  0x3a27f2e9,
+  0x3a2a9223,
+  0x3a2d30cd,
+  0x3a2fcee8,
+  0x3a326c74,
+  0x3a350970,
+  0x3a37a5dc,
+  0x3a3a41b9,
+  0x3a3cdd05,
+  0x3a3f77c3,
+  0x3a4211f0,
+  0x3a44ab8e,
+  0x3a47449c,
+  0x3a49dd1a,
+  0x3a4c7508,
+  0x3a4f0c67,
+  0x3a51a335,
+  0x3a543974,
+  0x3a56cf23,
+  0x3a596442,
+  0x3a5bf8d1,
+  0x3a5e8cd0,
+  0x3a61203e,
+  0x3a63b31d,
+  0x3a66456c,
+  0x3a68d72b,
+  0x3a6b6859,
+  0x3a6df8f8,
+  0x3a708906,
+  0x3a731884,
+  0x3a75a772,
+  0x3a7835cf,
+  0x3a7ac39d,
+  0x3a7d50da,
+  0x3a7fdd86,
+  0x3a8269a3,
+  0x3a84f52f,
+  0x3a87802a,
+  0x3a8a0a95,
+  0x3a8c9470,
+  0x3a8f1dba,
+  0x3a91a674,
+  0x3a942e9d,
+  0x3a96b636,
+  0x3a993d3e,
+  0x3a9bc3b6,
+  0x3a9e499d,
+  0x3aa0cef3,
+  0x3aa353b9,
+  0x3aa5d7ee,
+  0x3aa85b92,
+  0x3aaadea6,
+  0x3aad6129,
+  0x3aafe31b,
+  0x3ab2647c,
+  0x3ab4e54c,
+  0x3ab7658c,
+  0x3ab9e53a,
+  0x3abc6458,
+  0x3abee2e5,
+  0x3ac160e1,
+  0x3ac3de4c,
+  0x3ac65b26,
+  0x3ac8d76f,
+  0x3acb5327,
+  0x3acdce4d,
+  0x3ad048e3,
+  0x3ad2c2e8,
+  0x3ad53c5b,
+  0x3ad7b53d,
+  0x3ada2d8e,
+  0x3adca54e,
+  0x3adf1c7d,
+  0x3ae1931a,
+  0x3ae40926,
+  0x3ae67ea1,
+  0x3ae8f38b,
+  0x3aeb67e3,
+  0x3aeddba9,
+  0x3af04edf,
+  0x3af2c183,
+  0x3af53395,
+  0x3af7a516,
+  0x3afa1605,
+  0x3afc8663,
+  0x3afef630,
+  0x3b01656b,
+  0x3b03d414,
+  0x3b06422c,
+  0x3b08afb2,
+  0x3b0b1ca6,
+  0x3b0d8909,
+  0x3b0ff4d9,
+  0x3b126019,
+  0x3b14cac6,
+  0x3b1734e2,
+  0x3b199e6c,
+  0x3b1c0764,
+  0x3b1e6fca,
+  0x3b20d79e,
+  0x3b233ee1,
+  0x3b25a591,
+  0x3b280bb0,
+  0x3b2a713d,
+  0x3b2cd637,
+  0x3b2f3aa0,
+  0x3b319e77,
+  0x3b3401bb,
+  0x3b36646e,
+  0x3b38c68e,
+  0x3b3b281c,
+  0x3b3d8918,
+  0x3b3fe982,
+  0x3b42495a,
+  0x3b44a8a0,
+  0x3b470753,
+  0x3b496574,
+  0x3b4bc303,
+  0x3b4e1fff,
+  0x3b507c69,
+  0x3b52d841,
+  0x3b553386,
+  0x3b578e39,
+  0x3b59e85a,
+  0x3b5c41e8,
+  0x3b5e9ae4,
+  0x3b60f34d,
+  0x3b634b23,
+  0x3b65a268,
+  0x3b67f919,
+  0x3b6a4f38,
+  0x3b6ca4c4,
+  0x3b6ef9be,
+  0x3b714e25,
+  0x3b73a1fa,
+  0x3b75f53c,
+  0x3b7847eb,
+  0x3b7a9a07,
+  0x3b7ceb90,
+  0x3b7f3c87,
+  0x3b818ceb,
+  0x3b83dcbc,
+  0x3b862bfb,
+  0x3b887aa6,
+  0x3b8ac8bf,
+  0x3b8d1644,
+  0x3b8f6337,
+  0x3b91af97,
+  0x3b93fb63,
+  0x3b96469d,
+  0x3b989144,
+  0x3b9adb57,
+  0x3b9d24d8,
+  0x3b9f6dc5,
+  0x3ba1b620,
+  0x3ba3fde7,
+  0x3ba6451b,
+  0x3ba88bbc,
+  0x3baad1ca,
+  0x3bad1744,
+  0x3baf5c2c,
+  0x3bb1a080,
+  0x3bb3e440,
+  0x3bb6276e,
+  0x3bb86a08,
+  0x3bbaac0e,
+  0x3bbced82,
+  0x3bbf2e62,
+  0x3bc16eae,
+  0x3bc3ae67,
+  0x3bc5ed8d,
+  0x3bc82c1f,
+  0x3bca6a1d,
+  0x3bcca789,
+  0x3bcee460,
+  0x3bd120a4,
+  0x3bd35c54,
+  0x3bd59771,
+  0x3bd7d1fa,
+  0x3bda0bf0,
+  0x3bdc4552,
+  0x3bde7e20,
+  0x3be0b65a,
+  0x3be2ee01,
+  0x3be52513,
+  0x3be75b93,
+  0x3be9917e,
+  0x3bebc6d5,
+  0x3bedfb99,
+  0x3bf02fc9,
+  0x3bf26364,
+  0x3bf4966c,
+  0x3bf6c8e0,
+  0x3bf8fac0,
+  0x3bfb2c0c,
+  0x3bfd5cc4,
+  0x3bff8ce8,
+  0x3c01bc78,
+  0x3c03eb74,
+  0x3c0619dc,
+  0x3c0847b0,
+  0x3c0a74f0,
+  0x3c0ca19b,
+  0x3c0ecdb2,
+  0x3c10f935,
+  0x3c132424,
+  0x3c154e7f,
+  0x3c177845,
+  0x3c19a178,
+  0x3c1bca16,
+  0x3c1df21f,
+  0x3c201994,
+  0x3c224075,
+  0x3c2466c2,
+  0x3c268c7a,
+  0x3c28b19e,
+  0x3c2ad62d,
+  0x3c2cfa28,
+  0x3c2f1d8e,
+  0x3c314060,
+  0x3c33629d,
+  0x3c358446,
+  0x3c37a55a,
+  0x3c39c5da,
+  0x3c3be5c5,
+  0x3c3e051b,
+  0x3c4023dd,
+  0x3c42420a,
+  0x3c445fa2,
+  0x3c467ca6,
+  0x3c489915,
+  0x3c4ab4ef,
+  0x3c4cd035,
+  0x3c4eeae5,
+  0x3c510501,
+  0x3c531e88,
+  0x3c55377b,
+  0x3c574fd8,
+  0x3c5967a1,
+  0x3c5b7ed4,
+  0x3c5d9573,
+  0x3c5fab7c,
+  0x3c61c0f1,
+  0x3c63d5d1,
+  0x3c65ea1c,
+  0x3c67fdd1,
+  0x3c6a10f2,
+  0x3c6c237e,
+  0x3c6e3574,
+  0x3c7046d6,
+  0x3c7257a2,
+  0x3c7467d9,
+  0x3c76777b,
+  0x3c788688,
+  0x3c7a94ff,
+  0x3c7ca2e2,
+  0x3c7eb02f,
+  0x3c80bce7,
+  0x3c82c909,
+  0x3c84d496,
+  0x3c86df8e,
+  0x3c88e9f1,
+  0x3c8af3be,
+  0x3c8cfcf6,
+  0x3c8f0598,
+  0x3c910da5,
+  0x3c93151d,
+  0x3c951bff,
+  0x3c97224c,
+  0x3c992803,
+  0x3c9b2d24,
+  0x3c9d31b0,
+  0x3c9f35a7,
+  0x3ca13908,
+  0x3ca33bd3,
+  0x3ca53e09,
+  0x3ca73fa9,
+  0x3ca940b3,
+  0x3cab4128,
+  0x3cad4107,
+  0x3caf4051,
+  0x3cb13f04,
+  0x3cb33d22,
+  0x3cb53aaa,
+  0x3cb7379c,
+  0x3cb933f9,
+  0x3cbb2fbf,
+  0x3cbd2af0,
+  0x3cbf258b,
+  0x3cc11f90,
+  0x3cc318ff,
+  0x3cc511d9,
+  0x3cc70a1c,
+  0x3cc901c9,
+  0x3ccaf8e0,
+  0x3cccef62,
+  0x3ccee54d,
+  0x3cd0daa2,
+  0x3cd2cf62,
+  0x3cd4c38b,
+  0x3cd6b71e,
+  0x3cd8aa1b,
+  0x3cda9c81,
+  0x3cdc8e52,
+  0x3cde7f8d,
+  0x3ce07031,
+  0x3ce2603f,
+  0x3ce44fb7,
+  0x3ce63e98,
+  0x3ce82ce4,
+  0x3cea1a99,
+  0x3cec07b8,
+  0x3cedf440,
+  0x3cefe032,
+  0x3cf1cb8e,
+  0x3cf3b653,
+  0x3cf5a082,
+  0x3cf78a1b,
+  0x3cf9731d,
+  0x3cfb5b89,
+  0x3cfd435e,
+  0x3cff2a9d,
+  0x3d011145,
+  0x3d02f757,
+  0x3d04dcd2,
+  0x3d06c1b6,
+  0x3d08a604,
+  0x3d0a89bc,
+  0x3d0c6cdd,
+  0x3d0e4f67,
+  0x3d10315a,
+  0x3d1212b7,
+  0x3d13f37e,
+  0x3d15d3ad,
+  0x3d17b346,
+  0x3d199248,
+  0x3d1b70b3,
+  0x3d1d4e88,
+  0x3d1f2bc5,
+  0x3d21086c,
+  0x3d22e47c,
+  0x3d24bff6,
+  0x3d269ad8,
+  0x3d287523,
+  0x3d2a4ed8,
+  0x3d2c27f6,
+  0x3d2e007c,
+  0x3d2fd86c,
+  0x3d31afc5,
+  0x3d338687,
+  0x3d355cb1,
+  0x3d373245,
+  0x3d390742,
+  0x3d3adba7,
+  0x3d3caf76,
+  0x3d3e82ae,
+  0x3d40554e,
+  0x3d422757,
+  0x3d43f8c9,
+  0x3d45c9a4,
+  0x3d4799e8,
+  0x3d496994,
+  0x3d4b38aa,
+  0x3d4d0728,
+  0x3d4ed50f,
+  0x3d50a25e,
+  0x3d526f16,
+  0x3d543b37,
+  0x3d5606c1,
+  0x3d57d1b3,
+  0x3d599c0e,
+  0x3d5b65d2,
+  0x3d5d2efe,
+  0x3d5ef793,
+  0x3d60bf90,
+  0x3d6286f6,
+  0x3d644dc4,
+  0x3d6613fb,
+  0x3d67d99b,
+  0x3d699ea3,
+  0x3d6b6313,
+  0x3d6d26ec,
+  0x3d6eea2d,
+  0x3d70acd7,
+  0x3d726ee9,
+  0x3d743064,
+  0x3d75f147,
+  0x3d77b192,
+  0x3d797145,
+  0x3d7b3061,
+  0x3d7ceee5,
+  0x3d7eacd2,
+  0x3d806a27,
+  0x3d8226e4,
+  0x3d83e309,
+  0x3d859e96,
+  0x3d87598c,
+  0x3d8913ea,
+  0x3d8acdb0,
+  0x3d8c86de,
+  0x3d8e3f74,
+  0x3d8ff772,
+  0x3d91aed9,
+  0x3d9365a8,
+  0x3d951bde,
+  0x3d96d17d,
+  0x3d988684,
+  0x3d9a3af2,
+  0x3d9beec9,
+  0x3d9da208,
+  0x3d9f54af,
+  0x3da106bd,
+  0x3da2b834,
+  0x3da46912,
+  0x3da61959,
+  0x3da7c907,
+  0x3da9781d,
+  0x3dab269b,
+  0x3dacd481,
+  0x3dae81cf,
+  0x3db02e84,
+  0x3db1daa2,
+  0x3db38627,
+  0x3db53113,
+  0x3db6db68,
+  0x3db88524,
+  0x3dba2e48,
+  0x3dbbd6d4,
+  0x3dbd7ec7,
+  0x3dbf2622,
+  0x3dc0cce5,
+  0x3dc2730f,
+  0x3dc418a1,
+  0x3dc5bd9b,
+  0x3dc761fc,
+  0x3dc905c5,
+  0x3dcaa8f5,
+  0x3dcc4b8d,
+  0x3dcded8c,
+  0x3dcf8ef3,
+  0x3dd12fc1,
+  0x3dd2cff7,
+  0x3dd46f94,
+  0x3dd60e99,
+  0x3dd7ad05,
+  0x3dd94ad8,
+  0x3ddae813,
+  0x3ddc84b5,
+  0x3dde20bf,
+  0x3ddfbc30,
+  0x3de15708,
+  0x3de2f148,
+  0x3de48aef,
+  0x3de623fd,
+  0x3de7bc72,
+  0x3de9544f,
+  0x3deaeb93,
+  0x3dec823e,
+  0x3dee1851,
+  0x3defadca,
+  0x3df142ab,
+  0x3df2d6f3,
+  0x3df46aa2,
+  0x3df5fdb8,
+  0x3df79036,
+  0x3df9221a,
+  0x3dfab365,
+  0x3dfc4418,
+  0x3dfdd432,
+  0x3dff63b2,
+  0x3e00f29a,
+  0x3e0280e9,
+  0x3e040e9f,
+  0x3e059bbb,
+  0x3e07283f,
+  0x3e08b42a,
+  0x3e0a3f7b,
+  0x3e0bca34,
+  0x3e0d5453,
+  0x3e0eddd9,
+  0x3e1066c7,
+  0x3e11ef1b,
+  0x3e1376d5,
+  0x3e14fdf7,
+  0x3e168480,
+  0x3e180a6f,
+  0x3e198fc5,
+  0x3e1b1482,
+  0x3e1c98a6,
+  0x3e1e1c30,
+  0x3e1f9f21,
+  0x3e212179,
+  0x3e22a338,
+  0x3e24245d,
+  0x3e25a4e9,
+  0x3e2724db,
+  0x3e28a435,
+  0x3e2a22f4,
+  0x3e2ba11b,
+  0x3e2d1ea8,
+  0x3e2e9b9c,
+  0x3e3017f6,
+  0x3e3193b7,
+  0x3e330ede,
+  0x3e34896c,
+  0x3e360360,
+  0x3e377cbb,
+  0x3e38f57c,
+  0x3e3a6da4,
+  0x3e3be532,
+  0x3e3d5c27,
+  0x3e3ed282,
+  0x3e404844,
+  0x3e41bd6c,
+  0x3e4331fa,
+  0x3e44a5ef,
+  0x3e46194a,
+  0x3e478c0b,
+  0x3e48fe33,
+  0x3e4a6fc1,
+  0x3e4be0b6,
+  0x3e4d5110,
+  0x3e4ec0d1,
+  0x3e502ff9,
+  0x3e519e86,
+  0x3e530c7a,
+  0x3e5479d4,
+  0x3e55e694,
+  0x3e5752ba,
+  0x3e58be47,
+  0x3e5a2939,
+  0x3e5b9392,
+  0x3e5cfd51,
+  0x3e5e6676,
+  0x3e5fcf01,
+  0x3e6136f3,
+  0x3e629e4a,
+  0x3e640507,
+  0x3e656b2b,
+  0x3e66d0b4,
+  0x3e6835a4,
+  0x3e6999fa,
+  0x3e6afdb5,
+  0x3e6c60d7,
+  0x3e6dc35e,
+  0x3e6f254c,
+  0x3e70869f,
+  0x3e71e759,
+  0x3e734778,
+  0x3e74a6fd,
+  0x3e7605e9,
+  0x3e77643a,
+  0x3e78c1f0,
+  0x3e7a1f0d,
+  0x3e7b7b90,
+  0x3e7cd778,
+  0x3e7e32c6,
+  0x3e7f8d7b,
+  0x3e80e794,
+  0x3e824114,
+  0x3e8399f9,
+  0x3e84f245,
+  0x3e8649f5,
+  0x3e87a10c,
+  0x3e88f788,
+  0x3e8a4d6a,
+  0x3e8ba2b2,
+  0x3e8cf75f,
+  0x3e8e4b72,
+  0x3e8f9eeb,
+  0x3e90f1ca,
+  0x3e92440d,
+  0x3e9395b7,
+  0x3e94e6c6,
+  0x3e96373b,
+  0x3e978715,
+  0x3e98d655,
+  0x3e9a24fb,
+  0x3e9b7306,
+  0x3e9cc076,
+  0x3e9e0d4c,
+  0x3e9f5988,
+  0x3ea0a529,
+  0x3ea1f02f,
+  0x3ea33a9b,
+  0x3ea4846c,
+  0x3ea5cda3,
+  0x3ea7163f,
+  0x3ea85e41,
+  0x3ea9a5a8,
+  0x3eaaec74,
+  0x3eac32a6,
+  0x3ead783d,
+  0x3eaebd3a,
+  0x3eb0019c,
+  0x3eb14563,
+  0x3eb2888f,
+  0x3eb3cb21,
+  0x3eb50d18,
+  0x3eb64e75,
+  0x3eb78f36,
+  0x3eb8cf5d,
+  0x3eba0ee9,
+  0x3ebb4ddb,
+  0x3ebc8c31,
+  0x3ebdc9ed,
+  0x3ebf070e,
+  0x3ec04394,
+  0x3ec17f7f,
+  0x3ec2bad0,
+  0x3ec3f585,
+  0x3ec52fa0,
+  0x3ec66920,
+  0x3ec7a205,
+  0x3ec8da4f,
+  0x3eca11fe,
+  0x3ecb4912,
+  0x3ecc7f8b,
+  0x3ecdb56a,
+  0x3eceeaad,
+  0x3ed01f55,
+  0x3ed15363,
+  0x3ed286d5,
+  0x3ed3b9ad,
+  0x3ed4ebe9,
+  0x3ed61d8a,
+  0x3ed74e91,
+  0x3ed87efc,
+  0x3ed9aecc,
+  0x3edade01,
+  0x3edc0c9b,
+  0x3edd3a9a,
+  0x3ede67fe,
+  0x3edf94c7,
+  0x3ee0c0f4,
+  0x3ee1ec87,
+  0x3ee3177e,
+  0x3ee441da,
+  0x3ee56b9b,
+  0x3ee694c1,
+  0x3ee7bd4b,
+  0x3ee8e53a,
+  0x3eea0c8e,
+  0x3eeb3347,
+  0x3eec5965,
+  0x3eed7ee7,
+  0x3eeea3ce,
+  0x3eefc81a,
+  0x3ef0ebcb,
+  0x3ef20ee0,
+  0x3ef3315a,
+  0x3ef45338,
+  0x3ef5747b,
+  0x3ef69523,
+  0x3ef7b530,
+  0x3ef8d4a1,
+  0x3ef9f377,
+  0x3efb11b1,
+  0x3efc2f50,
+  0x3efd4c54,
+  0x3efe68bc,
+  0x3eff8489,
+  0x3f009fba,
+  0x3f01ba50,
+  0x3f02d44a,
+  0x3f03eda9,
+  0x3f05066d,
+  0x3f061e95,
+  0x3f073621,
+  0x3f084d12,
+  0x3f096367,
+  0x3f0a7921,
+  0x3f0b8e3f,
+  0x3f0ca2c2,
+  0x3f0db6a9,
+  0x3f0ec9f5,
+  0x3f0fdca5,
+  0x3f10eeb9,
+  0x3f120032,
+  0x3f13110f,
+  0x3f142151,
+  0x3f1530f7,
+  0x3f164001,
+  0x3f174e70,
+  0x3f185c43,
+  0x3f19697a,
+  0x3f1a7615,
+  0x3f1b8215,
+  0x3f1c8d79,
+  0x3f1d9842,
+  0x3f1ea26e,
+  0x3f1fabff,
+  0x3f20b4f5,
+  0x3f21bd4e,
+  0x3f22c50c,
+  0x3f23cc2e,
+  0x3f24d2b4,
+  0x3f25d89e,
+  0x3f26ddec,
+  0x3f27e29f,
+  0x3f28e6b6,
+  0x3f29ea31,
+  0x3f2aed10,
+  0x3f2bef53,
+  0x3f2cf0fb,
+  0x3f2df206,
+  0x3f2ef276,
+  0x3f2ff24a,
+  0x3f30f181,
+  0x3f31f01d,
+  0x3f32ee1d,
+  0x3f33eb81,
+  0x3f34e849,
+  0x3f35e476,
+  0x3f36e006,
+  0x3f37dafa,
+  0x3f38d552,
+  0x3f39cf0e,
+  0x3f3ac82f,
+  0x3f3bc0b3,
+  0x3f3cb89b,
+  0x3f3dafe7,
+  0x3f3ea697,
+  0x3f3f9cab,
+  0x3f409223,
+  0x3f4186ff,
+  0x3f427b3f,
+  0x3f436ee3,
+  0x3f4461eb,
+  0x3f455456,
+  0x3f464626,
+  0x3f473759,
+  0x3f4827f0,
+  0x3f4917eb,
+  0x3f4a074a,
+  0x3f4af60d,
+  0x3f4be433,
+  0x3f4cd1be,
+  0x3f4dbeac,
+  0x3f4eaafe,
+  0x3f4f96b4,
+  0x3f5081cd,
+  0x3f516c4b,
+  0x3f52562c,
+  0x3f533f71,
+  0x3f54281a,
+  0x3f551026,
+  0x3f55f796,
+  0x3f56de6a,
+  0x3f57c4a2,
+  0x3f58aa3d,
+  0x3f598f3c,
+  0x3f5a739e,
+  0x3f5b5765,
+  0x3f5c3a8f,
+  0x3f5d1d1d,
+  0x3f5dff0e,
+  0x3f5ee063,
+  0x3f5fc11c,
+  0x3f60a138,
+  0x3f6180b8,
+  0x3f625f9b,
+  0x3f633de2,
+  0x3f641b8d,
+  0x3f64f89b,
+  0x3f65d50d,
+  0x3f66b0e3,
+  0x3f678c1c,
+  0x3f6866b8,
+  0x3f6940b8,
+  0x3f6a1a1c,
+  0x3f6af2e3,
+  0x3f6bcb0e,
+  0x3f6ca29c,
+  0x3f6d798e,
+  0x3f6e4fe3,
+  0x3f6f259c,
+  0x3f6ffab8,
+  0x3f70cf38,
+  0x3f71a31b,
+  0x3f727661,
+  0x3f73490b,
+  0x3f741b19,
+  0x3f74ec8a,
+  0x3f75bd5e,
+  0x3f768d96,
+  0x3f775d31,
+  0x3f782c30,
+  0x3f78fa92,
+  0x3f79c857,
+  0x3f7a9580,
+  0x3f7b620c,
+  0x3f7c2dfc,
+  0x3f7cf94e,
+  0x3f7dc405,
+  0x3f7e8e1e,
+  0x3f7f579b,
+  0x3f80207b,
+  0x3f80e8bf,
+  0x3f81b065,
+  0x3f827770,
+  0x3f833ddd,
+  0x3f8403ae,
+  0x3f84c8e2,
+  0x3f858d79,
+  0x3f865174,
+  0x3f8714d1,
+  0x3f87d792,
+  0x3f8899b7,
+  0x3f895b3e,
+  0x3f8a1c29,
+  0x3f8adc77,
+  0x3f8b9c28,
+  0x3f8c5b3d,
+  0x3f8d19b4,
+  0x3f8dd78f,
+  0x3f8e94cd,
+  0x3f8f516e,
+  0x3f900d72,
+  0x3f90c8da,
+  0x3f9183a5,
+  0x3f923dd2,
+  0x3f92f763,
+  0x3f93b058,
+  0x3f9468af,
+  0x3f952069,
+  0x3f95d787,
+  0x3f968e07,
+  0x3f9743eb,
+  0x3f97f932,
+  0x3f98addb,
+  0x3f9961e8,
+  0x3f9a1558,
+  0x3f9ac82c,
+  0x3f9b7a62,
+  0x3f9c2bfb,
+  0x3f9cdcf7,
+  0x3f9d8d56,
+  0x3f9e3d19,
+  0x3f9eec3e,
+  0x3f9f9ac6,
+  0x3fa048b2,
+  0x3fa0f600,
+  0x3fa1a2b2,
+  0x3fa24ec6,
+  0x3fa2fa3d,
+  0x3fa3a518,
+  0x3fa44f55,
+  0x3fa4f8f6,
+  0x3fa5a1f9,
+  0x3fa64a5f,
+  0x3fa6f228,
+  0x3fa79954,
+  0x3fa83fe3,
+  0x3fa8e5d5,
+  0x3fa98b2a,
+  0x3faa2fe2,
+  0x3faad3fd,
+  0x3fab777b,
+  0x3fac1a5b,
+  0x3facbc9f,
+  0x3fad5e45,
+  0x3fadff4e,
+  0x3fae9fbb,
+  0x3faf3f89,
+  0x3fafdebb,
+  0x3fb07d50,
+  0x3fb11b48,
+  0x3fb1b8a2,
+  0x3fb2555f,
+  0x3fb2f17f,
+  0x3fb38d02,
+  0x3fb427e8,
+  0x3fb4c231,
+  0x3fb55bdc,
+  0x3fb5f4ea,
+  0x3fb68d5b,
+  0x3fb7252f,
+  0x3fb7bc65,
+  0x3fb852ff,
+  0x3fb8e8fb,
+  0x3fb97e5a,
+  0x3fba131b,
+  0x3fbaa740,
+  0x3fbb3ac7,
+  0x3fbbcdb1,
+  0x3fbc5ffe,
+  0x3fbcf1ad,
+  0x3fbd82bf,
+  0x3fbe1334,
+  0x3fbea30c,
+  0x3fbf3246,
+  0x3fbfc0e3,
+  0x3fc04ee3,
+  0x3fc0dc45,
+  0x3fc1690a,
+  0x3fc1f532,
+  0x3fc280bc,
+  0x3fc30baa,
+  0x3fc395f9,
+  0x3fc41fac,
+  0x3fc4a8c1,
+  0x3fc53139,
+  0x3fc5b913,
+  0x3fc64051,
+  0x3fc6c6f0,
+  0x3fc74cf3,
+  0x3fc7d258,
+  0x3fc8571f,
+  0x3fc8db4a,
+  0x3fc95ed7,
+  0x3fc9e1c6,
+  0x3fca6418,
+  0x3fcae5cd,
+  0x3fcb66e4,
+  0x3fcbe75e,
+  0x3fcc673b,
+  0x3fcce67a,
+  0x3fcd651c,
+  0x3fcde320,
+  0x3fce6087,
+  0x3fcedd50,
+  0x3fcf597c,
+  0x3fcfd50b,
+  0x3fd04ffc,
+  0x3fd0ca4f,
+  0x3fd14405,
+  0x3fd1bd1e,
+  0x3fd23599,
+  0x3fd2ad77,
+  0x3fd324b7,
+  0x3fd39b5a,
+  0x3fd4115f,
+  0x3fd486c7,
+  0x3fd4fb91,
+  0x3fd56fbe,
+  0x3fd5e34e,
+  0x3fd6563f,
+  0x3fd6c894,
+  0x3fd73a4a,
+  0x3fd7ab64,
+  0x3fd81bdf,
+  0x3fd88bbe,
+  0x3fd8fafe,
+  0x3fd969a1,
+  0x3fd9d7a7,
+  0x3fda450f,
+  0x3fdab1d9,
+  0x3fdb1e06,
+  0x3fdb8996,
+  0x3fdbf488,
+  0x3fdc5edc,
+  0x3fdcc892,
+  0x3fdd31ac,
+  0x3fdd9a27,
+  0x3fde0205,
+  0x3fde6945,
+  0x3fdecfe8,
+  0x3fdf35ed,
+  0x3fdf9b55,
+  0x3fe0001f,
+  0x3fe0644b,
+  0x3fe0c7da,
+  0x3fe12acb,
+  0x3fe18d1f,
+  0x3fe1eed5,
+  0x3fe24fed,
+  0x3fe2b067,
+  0x3fe31045,
+  0x3fe36f84,
+  0x3fe3ce26,
+  0x3fe42c2a,
+  0x3fe48990,
+  0x3fe4e659,
+  0x3fe54284,
+  0x3fe59e12,
+  0x3fe5f902,
+  0x3fe65354,
+  0x3fe6ad08,
+  0x3fe7061f,
+  0x3fe75e98,
+  0x3fe7b674,
+  0x3fe80db2,
+  0x3fe86452,
+  0x3fe8ba54,
+  0x3fe90fb9,
+  0x3fe96480,
+  0x3fe9b8a9,
+  0x3fea0c35,
+  0x3fea5f23,
+  0x3feab173,
+  0x3feb0326,
+  0x3feb543b,
+  0x3feba4b2,
+  0x3febf48b,
+  0x3fec43c7,
+  0x3fec9265,
+  0x3fece065,
+  0x3fed2dc8,
+  0x3fed7a8c,
+  0x3fedc6b4,
+  0x3fee123d,
+  0x3fee5d28,
+  0x3feea776,
+  0x3feef126,
+  0x3fef3a39,
+  0x3fef82ad,
+  0x3fefca84,
+  0x3ff011bd,
+  0x3ff05858,
+  0x3ff09e56,
+  0x3ff0e3b6,
+  0x3ff12878,
+  0x3ff16c9c,
+  0x3ff1b022,
+  0x3ff1f30b,
+  0x3ff23556,
+  0x3ff27703,
+  0x3ff2b813,
+  0x3ff2f884,
+  0x3ff33858,
+  0x3ff3778e,
+  0x3ff3b626,
+  0x3ff3f420,
+  0x3ff4317d,
+  0x3ff46e3c,
+  0x3ff4aa5d,
+  0x3ff4e5e0,
+  0x3ff520c5,
+  0x3ff55b0d,
+  0x3ff594b7,
+  0x3ff5cdc3,
+  0x3ff60631,
+  0x3ff63e01,
+  0x3ff67534,
+  0x3ff6abc8,
+  0x3ff6e1bf,
+  0x3ff71718,
+  0x3ff74bd3,
+  0x3ff77ff1,
+  0x3ff7b370,
+  0x3ff7e652,
+  0x3ff81896,
+  0x3ff84a3c,
+  0x3ff87b44,
+  0x3ff8abae,
+  0x3ff8db7b,
+  0x3ff90aaa,
+  0x3ff9393a,
+  0x3ff9672d,
+  0x3ff99483,
+  0x3ff9c13a,
+  0x3ff9ed53,
+  0x3ffa18cf,
+  0x3ffa43ac,
+  0x3ffa6dec,
+  0x3ffa978e,
+  0x3ffac092,
+  0x3ffae8f9,
+  0x3ffb10c1,
+  0x3ffb37ec,
+  0x3ffb5e78,
+  0x3ffb8467,
+  0x3ffba9b8,
+  0x3ffbce6b,
+  0x3ffbf280,
+  0x3ffc15f7,
+  0x3ffc38d1,
+  0x3ffc5b0c,
+  0x3ffc7caa,
+  0x3ffc9daa,
+  0x3ffcbe0c,
+  0x3ffcddd0,
+  0x3ffcfcf6,
+  0x3ffd1b7e,
+  0x3ffd3969,
+  0x3ffd56b5,
+  0x3ffd7364,
+  0x3ffd8f74,
+  0x3ffdaae7,
+  0x3ffdc5bc,
+  0x3ffddff3,
+  0x3ffdf98c,
+  0x3ffe1288,
+  0x3ffe2ae5,
+  0x3ffe42a4,
+  0x3ffe59c6,
+  0x3ffe704a,
+  0x3ffe862f,
+  0x3ffe9b77,
+  0x3ffeb021,
+  0x3ffec42d,
+  0x3ffed79b,
+  0x3ffeea6c,
+  0x3ffefc9e,
+  0x3fff0e32,
+  0x3fff1f29,
+  0x3fff2f82,
+  0x3fff3f3c,
+  0x3fff4e59,
+  0x3fff5cd8,
+  0x3fff6ab9,
+  0x3fff77fc,
+  0x3fff84a1,
+  0x3fff90a9,
+  0x3fff9c12,
+  0x3fffa6de,
+  0x3fffb10b,
+  0x3fffba9b,
+  0x3fffc38c,
+  0x3fffcbe0,
+  0x3fffd396,
+  0x3fffdaae,
+  0x3fffe128,
+  0x3fffe705,
+  0x3fffec43,
+  0x3ffff0e3,
+  0x3ffff4e6,
+  0x3ffff84a,
+  0x3ffffb11,
+  0x3ffffd39,
+  0x3ffffec4,
+  0x3fffffb1,
+  0x40000000,
+};
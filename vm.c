@@ -1,9 +1,18 @@
 #include "vm.h"
 
 #include "langdefs.h"
+#include "numarray.h"
+#include "shape.h"
 
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if KL_VM_PROFILE && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
 
 static inline void kl_vm_stack_push(kl_vm_t* vm, kl_valref_t valref) {
   int sp = ++vm->sp;
@@ -67,14 +76,14 @@ static inline kl_valref_t kl_vm_div(kl_valref_t x, kl_valref_t y) {
 
 static inline kl_valref_t kl_vm_fdiv(kl_valref_t x, kl_valref_t y) {
   if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE) {
-    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_div(x.val.num, y.val.num) & ~KL_NUM_FMASK };
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_fdiv(x.val.num, y.val.num) };
   }
   return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
 }
 
 static inline kl_valref_t kl_vm_mod(kl_valref_t x, kl_valref_t y) {
   if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE) {
-    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = x.val.num % y.val.num };
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_mod(x.val.num, y.val.num) };
   }
   return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
 }
@@ -109,28 +118,28 @@ static inline kl_valref_t kl_vm_lshftr(kl_valref_t x, kl_valref_t y) {
 
 static inline kl_valref_t kl_vm_bitand(kl_valref_t x, kl_valref_t y) {
   if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE) {
-    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = x.val.num & y.val.num };
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_and(x.val.num, y.val.num) };
   }
   return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
 }
 
 static inline kl_valref_t kl_vm_bitor(kl_valref_t x, kl_valref_t y) {
   if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE) {
-    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = x.val.num | y.val.num };
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_or(x.val.num, y.val.num) };
   }
   return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
 }
 
 static inline kl_valref_t kl_vm_bitxor(kl_valref_t x, kl_valref_t y) {
   if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE) {
-    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = x.val.num ^ y.val.num };
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_xor(x.val.num, y.val.num) };
   }
   return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
 }
 
 static inline kl_valref_t kl_vm_bitnot(kl_valref_t x) {
   if (x.ns == KL_NS_IMMEDIATE) {
-    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = ~x.val.num };
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_not(x.val.num) };
   }
   return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
 }
@@ -192,6 +201,48 @@ static inline kl_valref_t kl_vm_lg(kl_valref_t x) {
   return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
 }
 
+static inline kl_valref_t kl_vm_sqrt(kl_valref_t x) {
+  if (x.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_sqrt(x.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_exp(kl_valref_t x) {
+  if (x.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_exp(x.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_exp2(kl_valref_t x) {
+  if (x.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_exp2(x.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_tan(kl_valref_t x) {
+  if (x.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_tan(x.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_pow(kl_valref_t x, kl_valref_t y) {
+  if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_pow(x.val.num, y.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_atan2(kl_valref_t x, kl_valref_t y) {
+  if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_atan2(x.val.num, y.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
 
 static inline kl_valref_t kl_vm_eq(kl_valref_t x, kl_valref_t y) {
   if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE) {
@@ -242,23 +293,631 @@ static inline kl_valref_t kl_vm_cmp(kl_valref_t x, kl_valref_t y) {
   return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
 }
 
+static inline kl_valref_t kl_vm_abs(kl_valref_t x) {
+  if (x.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_abs(x.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_sign(kl_valref_t x) {
+  if (x.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_sign(x.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_min(kl_valref_t x, kl_valref_t y) {
+  if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_min(x.val.num, y.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_max(kl_valref_t x, kl_valref_t y) {
+  if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_max(x.val.num, y.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_clamp(kl_valref_t x, kl_valref_t lo, kl_valref_t hi) {
+  if (x.ns == KL_NS_IMMEDIATE && lo.ns == KL_NS_IMMEDIATE && hi.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_clamp(x.val.num, lo.val.num, hi.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_muladd(kl_valref_t x, kl_valref_t y, kl_valref_t z) {
+  if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE && z.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_muladd(x.val.num, y.val.num, z.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+static inline kl_valref_t kl_vm_addmul(kl_valref_t z, kl_valref_t x, kl_valref_t y) {
+  return kl_vm_muladd(x, y, z);
+}
+
+static inline kl_valref_t kl_vm_lerp(kl_valref_t x, kl_valref_t y, kl_valref_t t) {
+  if (x.ns == KL_NS_IMMEDIATE && y.ns == KL_NS_IMMEDIATE && t.ns == KL_NS_IMMEDIATE) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = kl_num_lerp(x.val.num, y.val.num, t.val.num) };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = 0 };
+}
+
+void kl_vm_gc_step(kl_vm_t* vm) {
+  kl_heap_roots_t roots[] = {
+    { vm->stack,       vm->sp + 1 },
+    { vm->globals.val, vm->globals.n },
+    { &vm->self,       1 },
+  };
+  kl_heap_step(&vm->heap, roots, sizeof(roots) / sizeof(roots[0]));
+}
+
+void kl_vm_gc(kl_vm_t* vm) {
+  kl_heap_roots_t roots[] = {
+    { vm->stack,       vm->sp + 1 },
+    { vm->globals.val, vm->globals.n },
+    { &vm->self,       1 },
+  };
+  kl_heap_collect(&vm->heap, roots, sizeof(roots) / sizeof(roots[0]));
+}
+
+#define KL_VM_INSTSIZE 0x40 /* initial cell size of an instance */
+
+static inline size_t kl_vm_inst_size(int cap) {
+  return sizeof(kl_obj_inst_t) + cap * sizeof(kl_valref_t);
+}
+
+static inline int kl_vm_inst_cap(size_t size) {
+  return (size - sizeof(kl_obj_inst_t)) / sizeof(kl_valref_t);
+}
+
+static inline kl_obj_inst_t* kl_vm_inst(kl_vm_t* vm, kl_valref_t ref) {
+  kl_object_t *obj = kl_heap_deref(&vm->heap, ref);
+  return obj != NULL && obj->type == KL_OBJ_INST ? (kl_obj_inst_t*)obj : NULL;
+}
+
+kl_valref_t kl_vm_instance(kl_vm_t* vm) {
+  kl_valref_t    ref;
+  kl_obj_inst_t *inst = (kl_obj_inst_t*)kl_vm_alloc(vm, KL_OBJ_INST, KL_VM_INSTSIZE, &ref);
+  inst->shape = KL_SHAPE_EMPTY;
+  inst->n     = 0;
+  inst->cap   = kl_vm_inst_cap(KL_VM_INSTSIZE);
+  return ref;
+}
+
+kl_valref_t kl_vm_getfield(kl_vm_t* vm, kl_valref_t ref, uint32_t sym) {
+  kl_obj_inst_t *inst = kl_vm_inst(vm, ref);
+  int            i    = inst != NULL ? kl_shape_lookup(inst->shape, sym) : -1;
+  if (i < 0) return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+  return inst->field[i];
+}
+
+/* offset of a field, adding it (and moving the instance to a bigger cell if full) when missing */
+static int kl_vm_field(kl_vm_t* vm, kl_valref_t ref, kl_obj_inst_t** inst, uint32_t sym) {
+  int i = kl_shape_lookup((*inst)->shape, sym);
+  if (i >= 0) return i;
+
+  if ((*inst)->n == (*inst)->cap) {
+    size_t size = kl_vm_inst_size((*inst)->cap);
+    *inst = (kl_obj_inst_t*)kl_heap_resize(&vm->heap, ref, size, size * 2);
+    (*inst)->cap = kl_vm_inst_cap(size * 2);
+  }
+  (*inst)->shape = kl_shape_add((*inst)->shape, sym);
+  return (*inst)->n++;
+}
+
+void kl_vm_setfield(kl_vm_t* vm, kl_valref_t ref, uint32_t sym, kl_valref_t val) {
+  kl_obj_inst_t *inst = kl_vm_inst(vm, ref);
+  if (inst == NULL) return;
+
+  int i = kl_vm_field(vm, ref, &inst, sym);
+  if (vm->heap.phase == KL_GC_MARK) kl_heap_shade(&vm->heap, val);
+  inst->field[i] = val;
+}
+
+/* inline cache misses for instance variables -- only fields that exist are cached */
+static kl_valref_t kl_vm_loadi(kl_obj_inst_t* inst, kl_cache_t* cache, uint32_t sym) {
+  int i = inst != NULL ? kl_shape_lookup(inst->shape, sym) : -1;
+  if (i < 0) return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+
+  cache->key = inst->shape;
+  cache->val = i;
+  return inst->field[i];
+}
+
+static void kl_vm_storei(kl_vm_t* vm, kl_obj_inst_t* inst, kl_cache_t* cache, uint32_t sym, kl_valref_t val) {
+  if (inst == NULL) return;
+
+  int i = kl_vm_field(vm, vm->self, &inst, sym);
+  cache->key = inst->shape;
+  cache->val = i;
+
+  if (vm->heap.phase == KL_GC_MARK) kl_heap_shade(&vm->heap, val);
+  inst->field[i] = val;
+}
+
+/* inline cache misses for globals -- a store defines the global, a load of an undefined one reads zero
+ * and leaves both table and cache alone, so that LOADG can run speculatively */
+static kl_valref_t kl_vm_loadg(kl_vm_t* vm, kl_cache_t* cache, uint32_t sym) {
+  uint32_t slot = kl_globals_find(&vm->globals, sym);
+  if (slot == KL_GLOBALS_NOSLOT) return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+
+  cache->val = slot;
+  cache->key = vm->globals.version;
+  return vm->globals.val[slot];
+}
+
+static uint32_t kl_vm_global(kl_vm_t* vm, kl_cache_t* cache, uint32_t sym) {
+  cache->val = kl_globals_slot(&vm->globals, sym);
+  cache->key = vm->globals.version;
+  return cache->val;
+}
+
+static inline size_t kl_vm_array_size(uint32_t n) {
+  return sizeof(kl_obj_array_t) + (size_t)n * sizeof(kl_number_t);
+}
+
+static inline kl_obj_array_t* kl_vm_arr(kl_vm_t* vm, kl_valref_t ref) {
+  kl_object_t *obj = kl_heap_deref(&vm->heap, ref);
+  return obj != NULL && obj->type == KL_OBJ_ARRAY ? (kl_obj_array_t*)obj : NULL;
+}
+
+kl_valref_t kl_vm_array(kl_vm_t* vm, uint32_t n) {
+  kl_valref_t     ref;
+  kl_obj_array_t *arr = (kl_obj_array_t*)kl_vm_alloc(vm, KL_OBJ_ARRAY, kl_vm_array_size(n), &ref);
+  arr->n = n;
+  memset(arr->data, 0, n * sizeof(kl_number_t));
+  return ref;
+}
+
+kl_number_t* kl_vm_array_data(kl_vm_t* vm, kl_valref_t ref, uint32_t* n) {
+  kl_obj_array_t *arr = kl_vm_arr(vm, ref);
+  if (arr == NULL) return NULL;
+  *n = arr->n;
+  return arr->data;
+}
+
+/* element-wise slow path, taken when one of the k operands on top of the stack is a reference.  operands
+ * stay on the stack until the result is allocated so a collector step can't reclaim them.  numbers are
+ * broadcast and arrays of different lengths combine over the shortest; anything that isn't a number or
+ * an array reads as zero, as before */
+static void kl_vm_elementwise(kl_vm_t* vm, int op, int k) {
+  kl_valref_t    *arg = &vm->stack[vm->sp - k + 1];
+  kl_obj_array_t *arr[3];
+  kl_valref_t     z   = { .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+
+  /* a fused product of anything but numbers and arrays is zero, as MUL would have left it, and the sum
+   * goes on with that zero just as the ADD after it would have */
+  if (op == KL_MULADD || op == KL_ADDMUL) {
+    int add = op == KL_MULADD ? 2 : 0; /* the addend */
+    for (int i=0; i < 3; i++) {
+      if (i == add || arg[i].ns == KL_NS_IMMEDIATE || kl_vm_arr(vm, arg[i]) != NULL) continue;
+      kl_valref_t addend = arg[add];
+      vm->sp--;
+      vm->stack[vm->sp - 1] = op == KL_MULADD ? z : addend;
+      vm->stack[vm->sp]     = op == KL_MULADD ? addend : z;
+      if (addend.ns == KL_NS_IMMEDIATE) {
+        vm->stack[--vm->sp] = addend;
+      } else {
+        kl_vm_elementwise(vm, KL_ADD, 2);
+      }
+      return;
+    }
+  }
+
+  uint32_t n  = UINT32_MAX;
+  int      ok = 1;
+  for (int i=0; i < k; i++) {
+    arr[i] = arg[i].ns != KL_NS_IMMEDIATE ? kl_vm_arr(vm, arg[i]) : NULL;
+    if (arr[i] != NULL && arr[i]->n < n) n = arr[i]->n;
+    if (arr[i] == NULL && arg[i].ns != KL_NS_IMMEDIATE) ok = 0;
+  }
+
+  if (ok && n != UINT32_MAX) {
+    z = kl_vm_array(vm, n);
+
+    kl_number_t *data[3];
+    for (int i=0; i < k; i++) data[i] = arr[i] != NULL ? arr[i]->data : &arg[i].val.num;
+
+    kl_number_t *out = kl_vm_arr(vm, z)->data;
+    int          err;
+    switch (k) {
+      case 1:  err = kl_numarray_unop(op, out, data[0], n); break;
+      case 2:  err = kl_numarray_binop(op, out, data[0], !arr[0], data[1], !arr[1], n); break;
+      default: err = kl_numarray_ternop(op, out, data[0], !arr[0], data[1], !arr[1], data[2], !arr[2], n); break;
+    }
+    if (err != 0) z = (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+  }
+
+  vm->sp -= k - 1;
+  vm->stack[vm->sp] = z;
+}
+
+/* vector operators -- operands are arrays (vec2 to vec4, though any length works), or numbers where that
+ * has an obvious meaning: the dot product of two numbers is their product, the length of a number its
+ * absolute value.  anything else gives zero */
+static void kl_vm_vector_binop(kl_vm_t* vm, int op) {
+  kl_valref_t    *x  = &vm->stack[vm->sp - 1];
+  kl_valref_t    *y  = &vm->stack[vm->sp];
+  kl_obj_array_t *ax = kl_vm_arr(vm, *x);
+  kl_obj_array_t *ay = kl_vm_arr(vm, *y);
+  kl_valref_t     z  = { .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+
+  switch (op) {
+    case KL_DOT:
+      if (ax != NULL && ay != NULL) {
+        z.val.num = kl_num_narrowsat(kl_numarray_dot(ax->data, ay->data, ax->n < ay->n ? ax->n : ay->n));
+      } else if (x->ns == KL_NS_IMMEDIATE && y->ns == KL_NS_IMMEDIATE) {
+        z.val.num = kl_num_mul(x->val.num, y->val.num);
+      }
+      break;
+    case KL_CROSS:
+      if (ax != NULL && ay != NULL && ax->n >= 3 && ay->n >= 3) {
+        z = kl_vm_array(vm, 3);
+        kl_numarray_cross(kl_vm_arr(vm, z)->data, ax->data, ay->data);
+      } else if (ax != NULL && ay != NULL && ax->n == 2 && ay->n == 2) {
+        /* the z component of the 3d cross product, i.e. the signed area */
+        z.val.num = kl_num_mul(ax->data[0], ay->data[1]) - kl_num_mul(ax->data[1], ay->data[0]);
+      }
+      break;
+    case KL_ROTATE:
+      if (ax != NULL && y->ns == KL_NS_IMMEDIATE) {
+        z = kl_vm_array(vm, ax->n);
+        kl_numarray_rotate(kl_vm_arr(vm, z)->data, ax->data, ax->n, y->val.num);
+      }
+      break;
+  }
+
+  vm->sp--;
+  vm->stack[vm->sp] = z;
+}
+
+static void kl_vm_vector_unop(kl_vm_t* vm, int op) {
+  kl_valref_t    *x  = &vm->stack[vm->sp];
+  kl_obj_array_t *ax = kl_vm_arr(vm, *x);
+  kl_valref_t     z  = { .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+  kl_number_t     v  = x->ns == KL_NS_IMMEDIATE ? x->val.num : KL_NUM_ZERO;
+
+  switch (op) {
+    case KL_LENGTH:
+      z.val.num = ax != NULL ? kl_numarray_length(ax->data, ax->n) : v < 0 ? -v : v;
+      break;
+    case KL_NORMALIZE:
+      if (ax != NULL) {
+        z = kl_vm_array(vm, ax->n);
+        kl_numarray_normalize(kl_vm_arr(vm, z)->data, ax->data, ax->n);
+      } else {
+        z.val.num = kl_inttonum((v > 0) - (v < 0));
+      }
+      break;
+  }
+
+  vm->stack[vm->sp] = z;
+}
+
+/* sine and cosine of every element of an array, as two new arrays.  the operand stays on the stack, and
+ * the first result goes there too, until both are allocated.  anything else gives two zeros */
+static void kl_vm_sincos_array(kl_vm_t* vm) {
+  kl_valref_t     z   = { .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+  kl_obj_array_t *arr = kl_vm_arr(vm, vm->stack[vm->sp]);
+  if (arr == NULL) {
+    vm->stack[vm->sp] = z;
+    kl_vm_stack_push(vm, z);
+    return;
+  }
+
+  kl_vm_stack_push(vm, kl_vm_array(vm, arr->n));
+  z = kl_vm_array(vm, arr->n);
+  kl_numarray_sincos(kl_vm_arr(vm, vm->stack[vm->sp])->data, kl_vm_arr(vm, z)->data, arr->data, arr->n);
+  vm->stack[vm->sp - 1] = vm->stack[vm->sp];
+  vm->stack[vm->sp]     = z;
+}
+
+/* elements are copied out of the stack after allocating, so they stay rooted until then.  references
+ * can't be nested in an array and are stored as zero */
+static void kl_vm_array_literal(kl_vm_t* vm, uint32_t n) {
+  kl_valref_t     z   = kl_vm_array(vm, n);
+  kl_obj_array_t *arr = kl_vm_arr(vm, z);
+  kl_valref_t    *src = &vm->stack[vm->sp - (int)n + 1];
+  for (uint32_t i=0; i < n; i++) {
+    arr->data[i] = src[i].ns == KL_NS_IMMEDIATE ? src[i].val.num : KL_NUM_ZERO;
+  }
+  vm->sp -= n;
+  kl_vm_stack_push(vm, z);
+}
+
+static inline kl_valref_t kl_vm_index(kl_vm_t* vm, kl_valref_t x, kl_valref_t y) {
+  kl_obj_array_t *arr = kl_vm_arr(vm, x);
+  int             i   = kl_floorint(y.val.num);
+  if (arr == NULL || y.ns != KL_NS_IMMEDIATE || i < 0 || (uint32_t)i >= arr->n) {
+    return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+  }
+  return (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = arr->data[i] };
+}
+
+int kl_vm_opcost(uint32_t op) {
+  switch (op) {
+    case KL_PUSH:
+    case KL_LOAD:
+    case KL_POP:
+    case KL_UADD:
+    case KL_USUB:
+    case KL_ADD:
+    case KL_SUB:
+    case KL_ASHFTL:
+    case KL_ASHFTR:
+    case KL_LSHFTL:
+    case KL_LSHFTR:
+    case KL_BITAND:
+    case KL_BITOR:
+    case KL_BITXOR:
+    case KL_BITNOT:
+    case KL_LOGNOT:
+    case KL_CMP:
+    case KL_NEQ:
+    case KL_EQ:
+    case KL_LT:
+    case KL_GT:
+    case KL_LEQ:
+    case KL_GEQ:
+    case KL_JMPF:
+    case KL_JMPT:
+    case KL_SELECT:
+    case KL_ABS:
+    case KL_SIGN:
+    case KL_MIN:
+    case KL_MAX:
+      return 1;
+    case KL_MUL:
+    case KL_MULADD:
+    case KL_ADDMUL:
+    case KL_DIVC:  /* the divisor is known not to be zero */
+    case KL_FDIVC:
+    case KL_MODC:
+    case KL_LOGAND:
+    case KL_LOGOR:
+    case KL_LOADG: /* inline cache check, a miss defines nothing */
+    case KL_LOADI:
+    case KL_INDEX:
+    case KL_CLAMP:
+    case KL_LERP:
+      return 2;
+    case KL_SINE:   /* table lookup */
+    case KL_COSINE:
+    case KL_SINCOS:
+    case KL_EXP_E:
+    case KL_EXP_2:
+      return 4;
+    case KL_LOG_E:  /* table lookup and a division */
+    case KL_LOG_2:
+    case KL_LOG_10:
+    case KL_SQRT:
+      return 8;
+    case KL_TANGENT: /* CORDIC */
+    case KL_ATAN2:
+    case KL_POW:
+      return 16;
+    case KL_DOT:
+    case KL_CROSS:
+    case KL_ROTATE:
+    case KL_LENGTH:
+    case KL_NORMALIZE:
+      return 16;
+    default:        /* stores, allocation, division (traps on zero) and anything new */
+      return KL_VM_COST_UNSAFE;
+  }
+}
+
+/* evaluates an operator on constant operands at compile time, with the same code the vm would run.
+ * returns -1 for operators that can't be folded, or would trap */
+int kl_vm_fold(uint32_t op, const kl_valref_t* arg, kl_valref_t* out) {
+  kl_valref_t x = arg[0], y = arg[1], w = arg[2];
+  switch (op) {
+    case KL_UADD:   *out = kl_vm_uadd(x);       return 0;
+    case KL_USUB:   *out = kl_vm_usub(x);       return 0;
+    case KL_BITNOT: *out = kl_vm_bitnot(x);     return 0;
+    case KL_LOGNOT: *out = kl_vm_lognot(x);     return 0;
+    case KL_SINE:   *out = kl_vm_sin(x);        return 0;
+    case KL_COSINE: *out = kl_vm_cos(x);        return 0;
+    case KL_LOG_2:  *out = kl_vm_lb(x);         return 0;
+    case KL_LOG_E:  *out = kl_vm_ln(x);         return 0;
+    case KL_LOG_10: *out = kl_vm_lg(x);         return 0;
+    case KL_SQRT:   *out = kl_vm_sqrt(x);       return 0;
+    case KL_EXP_E:  *out = kl_vm_exp(x);        return 0;
+    case KL_EXP_2:  *out = kl_vm_exp2(x);       return 0;
+    case KL_TANGENT: *out = kl_vm_tan(x);       return 0;
+    case KL_ABS:    *out = kl_vm_abs(x);        return 0;
+    case KL_SIGN:   *out = kl_vm_sign(x);       return 0;
+
+    case KL_ADD:    *out = kl_vm_add(x, y);     return 0;
+    case KL_SUB:    *out = kl_vm_sub(x, y);     return 0;
+    case KL_MUL:    *out = kl_vm_mul(x, y);     return 0;
+    case KL_DIV:
+    case KL_FDIV:
+    case KL_MOD:
+      if (y.val.num == 0 || (op == KL_MOD && x.val.num == KL_NUM_MIN && y.val.num == -1)) return -1;
+      *out = op == KL_DIV ? kl_vm_div(x, y) : op == KL_FDIV ? kl_vm_fdiv(x, y) : kl_vm_mod(x, y);
+      return 0;
+    case KL_ASHFTL: *out = kl_vm_ashftl(x, y);  return 0;
+    case KL_ASHFTR: *out = kl_vm_ashftr(x, y);  return 0;
+    case KL_LSHFTL: *out = kl_vm_lshftl(x, y);  return 0;
+    case KL_LSHFTR: *out = kl_vm_lshftr(x, y);  return 0;
+    case KL_BITAND: *out = kl_vm_bitand(x, y);  return 0;
+    case KL_BITOR:  *out = kl_vm_bitor(x, y);   return 0;
+    case KL_BITXOR: *out = kl_vm_bitxor(x, y);  return 0;
+    case KL_CMP:    *out = kl_vm_cmp(x, y);     return 0;
+    case KL_NEQ:    *out = kl_vm_neq(x, y);     return 0;
+    case KL_EQ:     *out = kl_vm_eq(x, y);      return 0;
+    case KL_LT:     *out = kl_vm_lt(x, y);      return 0;
+    case KL_GT:     *out = kl_vm_gt(x, y);      return 0;
+    case KL_LEQ:    *out = kl_vm_leq(x, y);     return 0;
+    case KL_GEQ:    *out = kl_vm_geq(x, y);     return 0;
+    case KL_MIN:    *out = kl_vm_min(x, y);     return 0;
+    case KL_MAX:    *out = kl_vm_max(x, y);     return 0;
+    case KL_POW:    *out = kl_vm_pow(x, y);     return 0;
+    case KL_ATAN2:  *out = kl_vm_atan2(x, y);   return 0;
+
+    case KL_CLAMP:  *out = kl_vm_clamp(x, y, w); return 0;
+    case KL_LERP:   *out = kl_vm_lerp(x, y, w);  return 0;
+    case KL_MULADD: *out = kl_vm_muladd(x, y, w); return 0;
+    case KL_ADDMUL: *out = kl_vm_addmul(x, y, w); return 0;
+    case KL_SELECT: *out = x.val.num != KL_NUM_ZERO ? y : w; return 0;
+  }
+  return -1;
+}
+
+#if KL_VM_PROFILE
+#if defined(__x86_64__) || defined(__i386__)
+#define KL_VM_PROFILE_UNIT "cycles"
+/* the fence keeps the handler from overlapping the reads on either side of it */
+static inline uint64_t kl_vm_ticks(void) {
+  _mm_lfence();
+  uint64_t t = __rdtsc();
+  _mm_lfence();
+  return t;
+}
+#else
+#define KL_VM_PROFILE_UNIT "ns"
+static inline uint64_t kl_vm_ticks(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+}
+#endif
+
+/* unary plus and minus share the low byte with addition and subtraction */
+#define KL_VM_PROFILE_KEY(op) (((op) & 0xFF) | ((op) & KL_FLAG_UNOP) >> 1)
+
+/* gap to the next timed instruction, uniform over 1 .. 2 * KL_VM_PROFILE_PERIOD - 1 */
+static uint32_t kl_vm_profile_gap(kl_vm_profile_t* p) {
+  p->seed = p->seed * 1664525u + 1013904223u;
+  return 1 + (uint32_t)(((uint64_t)(p->seed >> 8) * (2 * KL_VM_PROFILE_PERIOD - 1)) >> 24);
+}
+
+static void kl_vm_profile_sample(kl_vm_profile_t* p, kl_vm_opstats_t* stats, uint64_t ticks) {
+  if (p->overhead == 0) {
+    /* the cheapest of a few empty regions, as nothing in a handler can cost less */
+    uint64_t least = UINT64_MAX;
+    for (int i=0; i < 0x100; i++) {
+      uint64_t t0 = kl_vm_ticks();
+      uint64_t t1 = kl_vm_ticks();
+      if (t1 - t0 < least) least = t1 - t0;
+    }
+    p->overhead = least > 0 ? least : 1;
+  }
+  ticks = ticks > p->overhead ? ticks - p->overhead : 0;
+
+  int k = ticks == 0 ? 0 : 64 - __builtin_clzll(ticks);
+  if (k >= KL_VM_PROFILE_BUCKETS) k = KL_VM_PROFILE_BUCKETS - 1;
+  stats->samples++;
+  stats->ticks += ticks;
+  stats->hist[k]++;
+  p->countdown = kl_vm_profile_gap(p);
+}
+
+const kl_vm_opstats_t* kl_vm_profile_op(kl_vm_t* vm, int op) {
+  const kl_vm_opstats_t *stats = &vm->profile.op[KL_VM_PROFILE_KEY(op)];
+  return stats->count > 0 && stats->op == op ? stats : NULL;
+}
+
+void kl_vm_profile_reset(kl_vm_t* vm) {
+  memset(vm->profile.op, 0, sizeof(vm->profile.op));
+}
+
+static int kl_vm_profile_cmp(const void* a, const void* b) {
+  uint64_t x = (*(const kl_vm_opstats_t* const*)a)->count;
+  uint64_t y = (*(const kl_vm_opstats_t* const*)b)->count;
+  return x < y ? 1 : x > y ? -1 : 0;
+}
+
+void kl_vm_profile_dump(kl_vm_t* vm, FILE* out) {
+  const kl_vm_opstats_t *sorted[KL_VM_PROFILE_OPS];
+  uint64_t               total = 0;
+  int                    n     = 0;
+  for (int k=0; k < KL_VM_PROFILE_OPS; k++) {
+    if (vm->profile.op[k].count == 0) continue;
+    sorted[n++] = &vm->profile.op[k];
+    total      += vm->profile.op[k].count;
+  }
+  qsort(sorted, n, sizeof(sorted[0]), kl_vm_profile_cmp);
+
+  fprintf(out, "%-10s %12s %7s %10s %8s  timed by " KL_VM_PROFILE_UNIT " below 2^k\n",
+          "opcode", "count", "share", "timed", "mean");
+  for (int i=0; i < n; i++) {
+    const kl_vm_opstats_t *s = sorted[i];
+    fprintf(out, "%-10s %12llu %6.2f%% %10llu %8.1f ", kl_langdef_name(s->op), (unsigned long long)s->count,
+            100.0 * s->count / total, (unsigned long long)s->samples,
+            s->samples > 0 ? (double)s->ticks / s->samples : 0.0);
+    for (int k=0; k < KL_VM_PROFILE_BUCKETS; k++) {
+      if (s->hist[k] > 0) fprintf(out, " %d:%llu", k, (unsigned long long)s->hist[k]);
+    }
+    fprintf(out, "\n");
+  }
+}
+#endif
+
 #define KL_VM_BINOP(func) \
+  if ((vm->stack[vm->sp].ns & vm->stack[vm->sp - 1].ns) != KL_NS_IMMEDIATE) {\
+    kl_vm_elementwise(vm, ins->op, 2);\
+    break;\
+  }\
   y = kl_vm_stack_pop(vm);\
   x = kl_vm_stack_pop(vm);\
   z = (func)(x, y);\
   kl_vm_stack_push(vm, z);
 
 #define KL_VM_UNOP(func) \
+  if (vm->stack[vm->sp].ns != KL_NS_IMMEDIATE) {\
+    kl_vm_elementwise(vm, ins->op, 1);\
+    break;\
+  }\
   x = kl_vm_stack_pop(vm);\
   z = (func)(x);\
   kl_vm_stack_push(vm, z);
 
+#define KL_VM_TERNOP(func) \
+  if ((vm->stack[vm->sp].ns & vm->stack[vm->sp - 1].ns & vm->stack[vm->sp - 2].ns) != KL_NS_IMMEDIATE) {\
+    kl_vm_elementwise(vm, ins->op, 3);\
+    break;\
+  }\
+  w = kl_vm_stack_pop(vm);\
+  y = kl_vm_stack_pop(vm);\
+  x = kl_vm_stack_pop(vm);\
+  z = (func)(x, y, w);\
+  kl_vm_stack_push(vm, z);
+
 void kl_vm_exec(kl_vm_t* vm, kl_code_t* code) {
+  /* slots for newly bound locals start out as zero -- the caller must not leave temporaries on top of
+   * the frame between statements, or they would be claimed as locals */
+  while (vm->sp < vm->fp + code->nlocals - 1) {
+    kl_vm_stack_push(vm, (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO });
+  }
+
+#if KL_VM_SAMPLE
+  kl_code_t*      outer    = vm->code;
+  const kl_ins_t* outerins = vm->ins;
+  vm->ins  = code->ins;
+  vm->code = code;
+#endif
+
   int ip = 0;
   while (ip < code->n) {
     kl_ins_t* ins = code->ins + ip;
+#if KL_VM_SAMPLE
+    vm->ins = ins;
+#endif
+
+#if KL_VM_PROFILE
+    kl_vm_opstats_t *stats = &vm->profile.op[KL_VM_PROFILE_KEY(ins->op)];
+    stats->op = ins->op;
+    stats->count++;
+    uint64_t t0 = vm->profile.countdown-- == 0 ? kl_vm_ticks() : 0;
+#endif
 
-    kl_valref_t x, y, z;
+    kl_valref_t x, y, z, w;
     switch (ins->op) {
       case KL_ADD:
         KL_VM_BINOP(kl_vm_add)
@@ -324,6 +983,16 @@ void kl_vm_exec(kl_vm_t* vm, kl_code_t* code) {
       case KL_COSINE:
         KL_VM_UNOP(kl_vm_cos)
         break;
+      case KL_SINCOS:
+        /* two results, sine below cosine */
+        if (vm->stack[vm->sp].ns != KL_NS_IMMEDIATE) {
+          kl_vm_sincos_array(vm);
+          break;
+        }
+        z = (kl_valref_t){ .ns = KL_NS_IMMEDIATE };
+        kl_num_sincos(vm->stack[vm->sp].val.num, &vm->stack[vm->sp].val.num, &z.val.num);
+        kl_vm_stack_push(vm, z);
+        break;
       case KL_LOG_2:
         KL_VM_UNOP(kl_vm_lb);
         break;
@@ -333,6 +1002,59 @@ void kl_vm_exec(kl_vm_t* vm, kl_code_t* code) {
       case KL_LOG_10:
         KL_VM_UNOP(kl_vm_lg);
         break;
+      case KL_SQRT:
+        KL_VM_UNOP(kl_vm_sqrt);
+        break;
+      case KL_EXP_E:
+        KL_VM_UNOP(kl_vm_exp);
+        break;
+      case KL_EXP_2:
+        KL_VM_UNOP(kl_vm_exp2);
+        break;
+      case KL_TANGENT:
+        KL_VM_UNOP(kl_vm_tan);
+        break;
+      case KL_POW:
+        KL_VM_BINOP(kl_vm_pow);
+        break;
+      case KL_ATAN2:
+        KL_VM_BINOP(kl_vm_atan2);
+        break;
+
+      case KL_DOT:
+      case KL_CROSS:
+      case KL_ROTATE:
+        kl_vm_vector_binop(vm, ins->op);
+        break;
+      case KL_LENGTH:
+      case KL_NORMALIZE:
+        kl_vm_vector_unop(vm, ins->op);
+        break;
+
+      case KL_ABS:
+        KL_VM_UNOP(kl_vm_abs)
+        break;
+      case KL_SIGN:
+        KL_VM_UNOP(kl_vm_sign)
+        break;
+      case KL_MIN:
+        KL_VM_BINOP(kl_vm_min)
+        break;
+      case KL_MAX:
+        KL_VM_BINOP(kl_vm_max)
+        break;
+      case KL_CLAMP:
+        KL_VM_TERNOP(kl_vm_clamp)
+        break;
+      case KL_LERP:
+        KL_VM_TERNOP(kl_vm_lerp)
+        break;
+      case KL_MULADD:
+        KL_VM_TERNOP(kl_vm_muladd)
+        break;
+      case KL_ADDMUL:
+        KL_VM_TERNOP(kl_vm_addmul)
+        break;
 
       case KL_EQ:
         KL_VM_BINOP(kl_vm_eq)
@@ -359,8 +1081,117 @@ void kl_vm_exec(kl_vm_t* vm, kl_code_t* code) {
       case KL_PUSH:
         kl_vm_stack_push(vm, ins->arg);
         break;
+      case KL_LOAD:
+        kl_vm_stack_push(vm, vm->stack[vm->fp + ins->arg.val.ref]);
+        break;
+      case KL_STORE:
+        vm->stack[vm->fp + ins->arg.val.ref] = kl_vm_stack_peek(vm);
+        break;
+      case KL_POP:
+        kl_vm_stack_pop(vm);
+        break;
+      case KL_ARRAY:
+        kl_vm_array_literal(vm, ins->arg.val.ref);
+        break;
+      case KL_INDEX:
+        y = kl_vm_stack_pop(vm);
+        x = kl_vm_stack_pop(vm);
+        kl_vm_stack_push(vm, kl_vm_index(vm, x, y));
+        break;
+      case KL_JMPF:
+        z = kl_vm_stack_peek(vm);
+        if (z.ns == KL_NS_IMMEDIATE && z.val.num == KL_NUM_ZERO) ip += ins->arg.val.ref;
+        break;
+      case KL_JMPT:
+        z = kl_vm_stack_peek(vm);
+        if (z.ns == KL_NS_IMMEDIATE && z.val.num != KL_NUM_ZERO) {
+          vm->stack[vm->sp].val.num = KL_NUM_ONE;
+          ip += ins->arg.val.ref;
+        }
+        break;
+#if KL_NUM_MAGIC
+      case KL_DIVC:
+      case KL_FDIVC:
+      case KL_MODC: {
+        kl_num_magic_t *m = &code->magic[ins->arg.val.ref];
+        x = kl_vm_stack_peek(vm);
+        if (x.ns != KL_NS_IMMEDIATE) {
+          /* arrays take the element-wise path with the divisor pushed back */
+          kl_vm_stack_push(vm, (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = m->div });
+          kl_vm_elementwise(vm, ins->op == KL_DIVC ? KL_DIV : ins->op == KL_FDIVC ? KL_FDIV : KL_MOD, 2);
+          break;
+        }
+        kl_number_t a = x.val.num;
+        vm->stack[vm->sp].val.num = ins->op == KL_DIVC  ? kl_num_divc(a, m)
+                                  : ins->op == KL_FDIVC ? kl_num_fdivc(a, m)
+                                  :                       kl_num_modc(a, m);
+        break;
+      }
+#endif
+      case KL_JZ:
+        z = kl_vm_stack_pop(vm);
+        if (z.ns == KL_NS_IMMEDIATE && z.val.num == KL_NUM_ZERO) ip += ins->arg.val.ref;
+        break;
+      case KL_JMP:
+        ip += ins->arg.val.ref;
+        break;
+      case KL_SELECT: {
+        /* a reference counts as true, as it does for KL_JZ */
+        y = kl_vm_stack_pop(vm);
+        x = kl_vm_stack_pop(vm);
+        z = kl_vm_stack_pop(vm);
+        kl_num_bits_t m = -(kl_num_bits_t)(z.ns != KL_NS_IMMEDIATE || z.val.num != KL_NUM_ZERO);
+        kl_vm_stack_push(vm, (kl_valref_t){ .ns       = (x.ns & (uint32_t)m) | (y.ns & ~(uint32_t)m),
+                                            .val.bits = (x.val.bits & m) | (y.val.bits & ~m) });
+        break;
+      }
+      case KL_LOADG: {
+        kl_cache_t *cache = &code->cache[ins->arg.val.ref];
+        if (cache->key == vm->globals.version) {
+          kl_vm_stack_push(vm, vm->globals.val[cache->val]);
+        } else {
+          kl_vm_stack_push(vm, kl_vm_loadg(vm, cache, ins->arg.ns));
+        }
+        break;
+      }
+      case KL_STOREG: {
+        kl_cache_t *cache = &code->cache[ins->arg.val.ref];
+        uint32_t    slot  = cache->key == vm->globals.version ? cache->val : kl_vm_global(vm, cache, ins->arg.ns);
+        vm->globals.val[slot] = kl_vm_stack_peek(vm);
+        break;
+      }
+      case KL_LOADI: {
+        kl_cache_t    *cache = &code->cache[ins->arg.val.ref];
+        kl_obj_inst_t *inst  = kl_vm_inst(vm, vm->self);
+        if (inst != NULL && inst->shape == cache->key) {
+          kl_vm_stack_push(vm, inst->field[cache->val]);
+        } else {
+          kl_vm_stack_push(vm, kl_vm_loadi(inst, cache, ins->arg.ns));
+        }
+        break;
+      }
+      case KL_STOREI: {
+        kl_cache_t    *cache = &code->cache[ins->arg.val.ref];
+        kl_obj_inst_t *inst  = kl_vm_inst(vm, vm->self);
+        z = kl_vm_stack_peek(vm);
+        if (inst != NULL && inst->shape == cache->key) {
+          if (vm->heap.phase == KL_GC_MARK) kl_heap_shade(&vm->heap, z);
+          inst->field[cache->val] = z;
+        } else {
+          kl_vm_storei(vm, inst, cache, ins->arg.ns, z);
+        }
+        break;
+      }
     }
 
+#if KL_VM_PROFILE
+    if (t0 != 0) kl_vm_profile_sample(&vm->profile, stats, kl_vm_ticks() - t0);
+#endif
     ip++;
   }
+
+#if KL_VM_SAMPLE
+  vm->code = outer;
+  vm->ins  = outerins;
+#endif
 }
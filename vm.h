@@ -2,24 +2,126 @@
 #define KL_VM_H
 
 #include "compiler.h"
+#include "globals.h"
+#include "heap.h"
 
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
 
 #define KL_VM_STACKSIZE 0x00100000 /* in elements, not bytes */
 
+/* instrumentation, off unless built with -DKL_VM_PROFILE=1.  every instruction executed is counted under
+ * its opcode, and about one in KL_VM_PROFILE_PERIOD, picked at random so that loops don't alias, is timed
+ * with the time stamp counter (the monotonic clock in ns where there is none) into a histogram of
+ * floor(log2(ticks)).  the cost of timing an empty region is measured once and subtracted */
+#ifndef KL_VM_PROFILE
+#define KL_VM_PROFILE 0
+#endif
+
+/* kl_vm_exec keeps its code and current instruction in the vm for the sampling profiler in sampler.h, off
+ * unless built with -DKL_VM_SAMPLE=1 */
+#ifndef KL_VM_SAMPLE
+#define KL_VM_SAMPLE 0
+#endif
+
+#if KL_VM_PROFILE
+#ifndef KL_VM_PROFILE_PERIOD
+#define KL_VM_PROFILE_PERIOD 0x10
+#endif
+#define KL_VM_PROFILE_OPS     0x0200 /* low byte of the opcode, plus 0x100 for unary ones */
+#define KL_VM_PROFILE_BUCKETS 0x20   /* bucket k holds samples of 2^(k-1) up to 2^k - 1 ticks, 0 holds 0 */
+
+typedef struct kl_vm_opstats {
+  int      op;      /* opcode, valid once count is nonzero */
+  uint64_t count;   /* executions */
+  uint64_t samples; /* executions timed */
+  uint64_t ticks;   /* summed over the timed ones */
+  uint64_t hist[KL_VM_PROFILE_BUCKETS];
+} kl_vm_opstats_t;
+
+typedef struct kl_vm_profile {
+  uint32_t        countdown; /* instructions to go before the next timed one */
+  uint32_t        seed;
+  uint64_t        overhead;  /* ticks read around an empty region, 0 until measured */
+  kl_vm_opstats_t op[KL_VM_PROFILE_OPS];
+} kl_vm_profile_t;
+#endif
+
+/* locals occupy stack[fp] .. stack[fp + nlocals - 1], temporaries live above them.  an instruction with
+ * more than one result (KL_SINCOS) pushes them in order, the last on top */
 typedef struct kl_vm {
-  int         sp;
-  int         fp;
-  kl_valref_t stack[KL_VM_STACKSIZE];
+  int          sp;
+  int          fp;
+  kl_globals_t globals;
+  kl_heap_t    heap; /* roots are the stack, the globals and self */
+  kl_valref_t  self; /* instance whose fields @name refers to, immediate if none */
+#if KL_VM_PROFILE
+  kl_vm_profile_t profile;
+#endif
+#if KL_VM_SAMPLE
+  kl_code_t* volatile      code; /* running, NULL between statements */
+  const kl_ins_t* volatile ins;  /* being executed */
+#endif
+  kl_valref_t  stack[KL_VM_STACKSIZE];
 } kl_vm_t;
 
 #define KL_VM_INITIALIZER \
-  { .sp = -1 }
+  { .sp = -1, .fp = 0, .globals = KL_GLOBALS_INITIALIZER, .heap = KL_HEAP_INITIALIZER, \
+    .self = { .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO } }
 
+/* vm must be zeroed, KL_VM_INITIALIZER or initialized before -- a vm in use is reset, its globals table
+ * is kept for reuse and its heap released */
 static inline void kl_vm_init(kl_vm_t* vm) {
-  vm->sp = 0;
+  vm->sp      = -1;
+  vm->fp      = 0;
+  kl_globals_clear(&vm->globals);
+  kl_heap_free(&vm->heap);
+  vm->self    = (kl_valref_t){ .ns = KL_NS_IMMEDIATE, .val.num = KL_NUM_ZERO };
+#if KL_VM_PROFILE
+  memset(&vm->profile, 0, sizeof(vm->profile));
+#endif
+#if KL_VM_SAMPLE
+  vm->code    = NULL;
+  vm->ins     = NULL;
+#endif
 }
 
 void kl_vm_exec(kl_vm_t* vm, kl_code_t* code);
 
+void kl_vm_gc_step(kl_vm_t* vm);
+void kl_vm_gc(kl_vm_t* vm);
+
+/* instances with shape-described fields, see shape.h -- missing fields read as zero */
+kl_valref_t kl_vm_instance(kl_vm_t* vm);
+kl_valref_t kl_vm_getfield(kl_vm_t* vm, kl_valref_t inst, uint32_t sym);
+void        kl_vm_setfield(kl_vm_t* vm, kl_valref_t inst, uint32_t sym, kl_valref_t val);
+
+/* Q16.16 arrays, zero-filled -- arithmetic on them is element-wise with scalars broadcast */
+kl_valref_t  kl_vm_array(kl_vm_t* vm, uint32_t n);
+kl_number_t* kl_vm_array_data(kl_vm_t* vm, kl_valref_t array, uint32_t* n);
+
+#if KL_VM_PROFILE
+/* counters of one opcode, NULL if it never ran since the last reset */
+const kl_vm_opstats_t* kl_vm_profile_op(kl_vm_t* vm, int op);
+void kl_vm_profile_reset(kl_vm_t* vm);
+/* one line per opcode that ran, by name and most executed first */
+void kl_vm_profile_dump(kl_vm_t* vm, FILE* out);
+#endif
+
+/* rough cost of one instruction in dispatches, used by the compiler to decide what it may evaluate
+ * speculatively.  KL_VM_COST_UNSAFE marks instructions with side effects or that can trap */
+#define KL_VM_COST_UNSAFE 0x100
+int kl_vm_opcost(uint32_t op);
+
+/* constant folding -- arg holds three immediates, of which the operator reads as many as it takes */
+int kl_vm_fold(uint32_t op, const kl_valref_t* arg, kl_valref_t* out);
+
+/* pays off allocation debt with one bounded collector step before allocating */
+static inline kl_object_t* kl_vm_alloc(kl_vm_t* vm, int type, size_t size, kl_valref_t* ref) {
+  if (vm->heap.debt >= (ptrdiff_t)vm->heap.stepsize) kl_vm_gc_step(vm);
+
+  return kl_heap_alloc(&vm->heap, type, size, ref);
+}
+
 #endif /* KL_VM_H */